@@ -0,0 +1,307 @@
+#ifndef RAIN_TILE_DISTANT_H
+#define RAIN_TILE_DISTANT_H
+
+unsigned char rain_tile_distant[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x08, 0x06, 0x00, 0x00, 0x00, 0x9A, 0x76, 0x82,
+    0x70, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61,
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 0x44, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xA0,
+    0xBD, 0xA7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00,
+    0x00, 0x0B, 0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45,
+    0x07, 0xDE, 0x03, 0x08, 0x16, 0x31, 0x10, 0xA5, 0xB5, 0x4D, 0xD4, 0x00, 0x00, 0x12, 0x29, 0x49,
+    0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0xDD, 0xA1, 0x72, 0x24, 0x49, 0x96, 0x85, 0xE1, 0x7B, 0x0A,
+    0x68, 0x90, 0x50, 0x17, 0x91, 0xD0, 0xA0, 0x65, 0xF5, 0x02, 0x85, 0x96, 0xED, 0x0B, 0x2C, 0xDA,
+    0x17, 0x98, 0x37, 0x0F, 0x11, 0x25, 0x4A, 0x34, 0x02, 0x7D, 0x96, 0x88, 0xAE, 0xD9, 0x8C, 0x6D,
+    0xC7, 0x95, 0x42, 0xFA, 0x3E, 0xDE, 0x66, 0x5D, 0x9E, 0x65, 0x75, 0xF3, 0xCF, 0x70, 0xF7, 0x98,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0xA9, 0xED, 0xAF, 0xB6, 0xBF, 0xAD, 0x04, 0x00, 0xC0, 0xF5, 0xFC,
+    0xB0, 0x04, 0x5C, 0xD0, 0x6B, 0xDB, 0x3F, 0x2C, 0x03, 0x00, 0x80, 0x00, 0x81, 0xD3, 0x25, 0x79,
+    0x49, 0xF2, 0x6C, 0x25, 0x00, 0x00, 0x04, 0x08, 0xAC, 0x68, 0x7B, 0x6F, 0xFB, 0x68, 0x25, 0x00,
+    0x00, 0x04, 0x08, 0x9C, 0x2E, 0xC9, 0x6D, 0x66, 0x6C, 0xC3, 0x02, 0x00, 0x10, 0x20, 0xB0, 0xE2,
+    0x55, 0x80, 0x00, 0x00, 0x08, 0x10, 0xD8, 0x72, 0xB4, 0x75, 0x0E, 0x04, 0x00, 0x40, 0x80, 0xC0,
+    0x8A, 0x5B, 0x92, 0x9F, 0x96, 0x01, 0x00, 0x40, 0x80, 0xC0, 0xE9, 0x92, 0xBC, 0xCD, 0xCC, 0xB4,
+    0x7D, 0xB0, 0x1A, 0x00, 0x00, 0x02, 0x04, 0x4E, 0xD7, 0xD6, 0x39, 0x10, 0x00, 0x00, 0x01, 0x02,
+    0x3B, 0x92, 0x1C, 0x33, 0xE3, 0x1C, 0x08, 0x00, 0x80, 0x00, 0x81, 0x15, 0xB7, 0x99, 0x71, 0x0E,
+    0x04, 0x00, 0x40, 0x80, 0xC0, 0x4E, 0x80, 0xB4, 0xB5, 0x05, 0x0B, 0x00, 0x40, 0x80, 0xC0, 0xF9,
+    0x92, 0xDC, 0x93, 0x78, 0x1B, 0x3A, 0x00, 0x80, 0x00, 0x81, 0x1D, 0x6D, 0x8F, 0xB6, 0x4F, 0x56,
+    0x02, 0x00, 0x40, 0x80, 0xC0, 0xE9, 0x92, 0x38, 0x07, 0x02, 0x00, 0x20, 0x40, 0x60, 0x8D, 0xAB,
+    0x78, 0x01, 0x00, 0x04, 0x08, 0xAC, 0xF1, 0x04, 0x04, 0x00, 0x40, 0x80, 0xC0, 0x8E, 0xF7, 0x2D,
+    0x58, 0x9E, 0x80, 0x00, 0x00, 0x08, 0x10, 0x58, 0xE3, 0x3A, 0x5E, 0x00, 0x00, 0x01, 0x02, 0x6B,
+    0x9C, 0x03, 0x01, 0x00, 0x10, 0x20, 0xB0, 0xC6, 0x39, 0x10, 0x00, 0xBE, 0x8D, 0xB6, 0xBF, 0xDA,
+    0xFE, 0xB6, 0x12, 0x08, 0x10, 0xF8, 0x38, 0xAF, 0xB6, 0x60, 0x01, 0x60, 0xEE, 0x81, 0x00, 0x81,
+    0x15, 0x49, 0x5E, 0x92, 0x3C, 0x5B, 0x09, 0x00, 0xCC, 0x3D, 0x10, 0x20, 0xB0, 0xA2, 0xED, 0xBD,
+    0xED, 0xA3, 0x95, 0x00, 0xC0, 0xDC, 0x03, 0x01, 0x02, 0xA7, 0x73, 0x1D, 0x2F, 0x00, 0xE6, 0x1E,
+    0x08, 0x10, 0xD8, 0xE4, 0x26, 0x2C, 0x00, 0xCC, 0x3D, 0x10, 0x20, 0xB0, 0xE6, 0x68, 0x6B, 0x3F,
+    0x2C, 0x00, 0xE6, 0x1E, 0x08, 0x10, 0x58, 0x71, 0x4B, 0xE2, 0x2A, 0x5E, 0x00, 0xCC, 0x3D, 0x10,
+    0x20, 0x70, 0xBE, 0x24, 0x6F, 0x33, 0x33, 0x6D, 0x1F, 0xAC, 0x06, 0x00, 0xE6, 0x1E, 0x08, 0x10,
+    0x38, 0x5D, 0x5B, 0xFB, 0x61, 0x01, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0x8E, 0x24, 0xC7, 0xCC, 0xD8,
+    0x0F, 0x0B, 0x80, 0xB9, 0x07, 0x02, 0x04, 0x56, 0xDC, 0x66, 0xC6, 0x7E, 0x58, 0x00, 0xCC, 0x3D,
+    0x10, 0x20, 0xB0, 0xF3, 0x0F, 0x71, 0x5B, 0x8F, 0xA2, 0x01, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0xF9,
+    0x92, 0xDC, 0x93, 0x78, 0x2B, 0x2C, 0x00, 0xE6, 0x1E, 0x08, 0x10, 0xD8, 0xD1, 0xF6, 0x68, 0xFB,
+    0x64, 0x25, 0x00, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0xE9, 0x92, 0xD8, 0x0F, 0x0B, 0x80, 0xB9, 0x07,
+    0x02, 0x04, 0xD6, 0xB8, 0x92, 0x10, 0x00, 0x73, 0x0F, 0x04, 0x08, 0xAC, 0xF1, 0x4B, 0x10, 0x00,
+    0xE6, 0x1E, 0x08, 0x10, 0xD8, 0xF1, 0xFE, 0x28, 0xDA, 0x2F, 0x41, 0x00, 0x98, 0x7B, 0x20, 0x40,
+    0x60, 0x8D, 0x6B, 0x09, 0x01, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0x1A, 0xFB, 0x61, 0x01, 0x30, 0xF7,
+    0x40, 0x80, 0xC0, 0x1A, 0xFB, 0x61, 0x01, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0x9A, 0x57, 0x8F, 0xA2,
+    0x01, 0x30, 0xF7, 0x40, 0x80, 0xC0, 0x8A, 0x24, 0x2F, 0x49, 0x9E, 0xAD, 0x04, 0x00, 0xE6, 0x1E,
+    0x08, 0x10, 0x58, 0xD1, 0xF6, 0xDE, 0xF6, 0xD1, 0x4A, 0x00, 0x60, 0xEE, 0x81, 0x00, 0x81, 0xD3,
+    0xB9, 0x96, 0x10, 0x00, 0x73, 0x0F, 0x04, 0x08, 0x6C, 0x72, 0x23, 0x08, 0x00, 0xE6, 0x1E, 0x08,
+    0x10, 0x58, 0x73, 0xB4, 0xB5, 0x1F, 0x16, 0x00, 0x73, 0x0F, 0x04, 0x08, 0xAC, 0xB8, 0x25, 0x71,
+    0x25, 0x21, 0x00, 0xE6, 0x1E, 0x08, 0x10, 0x38, 0x5F, 0x92, 0xB7, 0x99, 0x99, 0xB6, 0x0F, 0x56,
+    0x03, 0x00, 0x73, 0x0F, 0x04, 0x08, 0x9C, 0xAE, 0xAD, 0xFD, 0xB0, 0x00, 0x98, 0x7B, 0x20, 0x40,
+    0x60, 0x47, 0x92, 0x63, 0x66, 0xEC, 0x87, 0x05, 0xC0, 0xDC, 0x03, 0x01, 0x02, 0x2B, 0x6E, 0x33,
+    0x63, 0x3F, 0x2C, 0x00, 0xE6, 0x1E, 0x08, 0x10, 0xD8, 0xF9, 0x87, 0xB8, 0xAD, 0x47, 0xD1, 0x00,
+    0x98, 0x7B, 0x20, 0x40, 0xE0, 0x7C, 0x49, 0xEE, 0x49, 0xBC, 0x15, 0x16, 0x00, 0x73, 0x0F, 0x04,
+    0x08, 0xEC, 0x68, 0x7B, 0xB4, 0x7D, 0xB2, 0x12, 0x00, 0x98, 0x7B, 0x20, 0x40, 0xE0, 0x74, 0x49,
+    0xEC, 0x87, 0x05, 0xC0, 0xDC, 0x03, 0x01, 0x02, 0x6B, 0x5C, 0x49, 0x08, 0x80, 0xB9, 0x07, 0x02,
+    0x04, 0xD6, 0xF8, 0x25, 0x08, 0x00, 0x73, 0x0F, 0x04, 0x08, 0xEC, 0x78, 0x7F, 0x14, 0xED, 0x97,
+    0x20, 0x00, 0xCC, 0x3D, 0x10, 0x20, 0xB0, 0xC6, 0xB5, 0x84, 0x00, 0x98, 0x7B, 0x20, 0x40, 0x60,
+    0x8D, 0xFD, 0xB0, 0x00, 0x98, 0x7B, 0x00, 0x00, 0x00, 0x7F, 0xB5, 0xB6, 0xBF, 0xDA, 0xFE, 0xB6,
+    0x12, 0x7C, 0x56, 0x9E, 0x80, 0x00, 0x00, 0x7C, 0x2D, 0xAF, 0xB6, 0x60, 0x21, 0x40, 0x00, 0x00,
+    0x58, 0x91, 0xE4, 0x25, 0xC9, 0xB3, 0x95, 0x40, 0x80, 0x00, 0x00, 0xB0, 0xA2, 0xED, 0xBD, 0xED,
+    0xA3, 0x95, 0x40, 0x80, 0x00, 0x00, 0x70, 0x3A, 0xD7, 0xF1, 0x22, 0x40, 0x00, 0x00, 0xD8, 0xE4,
+    0x26, 0x2C, 0x04, 0x08, 0x00, 0x00, 0x6B, 0x8E, 0xB6, 0xCE, 0x81, 0x20, 0x40, 0x00, 0x00, 0x58,
+    0x71, 0x4B, 0xF2, 0xD3, 0x32, 0x20, 0x40, 0x00, 0x00, 0x38, 0x5D, 0x92, 0xB7, 0x99, 0x99, 0xB6,
+    0x0F, 0x56, 0x03, 0x01, 0x02, 0x00, 0xC0, 0xE9, 0xDA, 0x3A, 0x07, 0x82, 0x00, 0x01, 0x00, 0x60,
+    0x47, 0x92, 0x63, 0x66, 0x9C, 0x03, 0x41, 0x80, 0x00, 0x00, 0xB0, 0xE2, 0x36, 0x33, 0xCE, 0x81,
+    0x20, 0x40, 0x00, 0x00, 0xD8, 0x09, 0x90, 0xB6, 0xB6, 0x60, 0x21, 0x40, 0x00, 0x00, 0x38, 0x5F,
+    0x92, 0x7B, 0x12, 0x6F, 0x43, 0x47, 0x80, 0x00, 0x00, 0xB0, 0xA3, 0xED, 0xD1, 0xF6, 0xC9, 0x4A,
+    0x20, 0x40, 0x00, 0x00, 0x38, 0x5D, 0x12, 0xE7, 0x40, 0x10, 0x20, 0x00, 0x00, 0xAC, 0x71, 0x15,
+    0x2F, 0x02, 0x04, 0x00, 0x80, 0x35, 0x9E, 0x80, 0x20, 0x40, 0x00, 0x00, 0xD8, 0xF1, 0xBE, 0x05,
+    0xCB, 0x13, 0x10, 0x04, 0x08, 0x00, 0x00, 0x6B, 0x5C, 0xC7, 0x8B, 0x00, 0x01, 0x00, 0x60, 0x8D,
+    0x73, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0xD3, 0xF6, 0xF1, 0xCF, 0x3F, 0xFF, 0xFC, 0x1F, 0x2B, 0x01, 0x00, 0x00, 0xFC, 0xBB, 0x7E, 0xFC,
+    0xBB, 0xFF, 0x41, 0x92, 0x7B, 0x92, 0x47, 0x4B, 0x07, 0x00, 0x00, 0x9C, 0x1E, 0x20, 0x33, 0x33,
+    0x6D, 0x8F, 0xB6, 0x4F, 0x96, 0x0F, 0x00, 0x00, 0x38, 0x3D, 0x40, 0x92, 0xDC, 0x66, 0xE6, 0xA7,
+    0xE5, 0x03, 0x00, 0x00, 0x4E, 0x0F, 0x90, 0x99, 0x79, 0x9D, 0x99, 0x3F, 0x2C, 0x1F, 0x00, 0x00,
+    0xB0, 0x11, 0x20, 0x9E, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x01, 0xF2, 0xBE, 0x05, 0xCB, 0x13, 0x10,
+    0x00, 0x00, 0xE0, 0xFC, 0x00, 0x99, 0x71, 0x10, 0x1D, 0x00, 0x00, 0x58, 0x0C, 0x10, 0x07, 0xD1,
+    0x01, 0x00, 0x80, 0xB5, 0x00, 0x19, 0x07, 0xD1, 0x01, 0x00, 0x80, 0xC5, 0x00, 0xF1, 0x04, 0x04,
+    0x00, 0x00, 0xD8, 0x09, 0x10, 0x07, 0xD1, 0x01, 0x00, 0x80, 0xB5, 0x00, 0x99, 0x71, 0x10, 0x1D,
+    0x00, 0x00, 0x58, 0x0C, 0x10, 0x07, 0xD1, 0x01, 0x00, 0x80, 0xB5, 0x00, 0x99, 0x99, 0xFB, 0xCC,
+    0x3C, 0x5A, 0x46, 0x00, 0x00, 0x60, 0x23, 0x40, 0x5E, 0xDB, 0x3A, 0x07, 0x02, 0x00, 0x00, 0x9C,
+    0x1F, 0x20, 0x49, 0x5E, 0x92, 0x3C, 0x5B, 0x46, 0x00, 0x00, 0xE0, 0xF4, 0x00, 0x79, 0x77, 0xF3,
+    0x14, 0x04, 0x00, 0x00, 0xD8, 0x0A, 0x10, 0x2F, 0x24, 0x04, 0x00, 0x00, 0x00, 0xF8, 0xAB, 0xB4,
+    0xFD, 0x87, 0x55, 0x00, 0x80, 0xFF, 0xBF, 0x1F, 0x96, 0x00, 0xE0, 0x5F, 0x0A, 0x10, 0xEF, 0x3D,
+    0x02, 0x00, 0x01, 0x02, 0xB0, 0xC3, 0x7B, 0x8F, 0x00, 0x40, 0x80, 0x00, 0x6C, 0x72, 0xDE, 0x0D,
+    0x00, 0x04, 0x08, 0xC0, 0x1A, 0x4F, 0x40, 0x00, 0x40, 0x80, 0x00, 0xEC, 0x78, 0xDF, 0x82, 0xE5,
+    0x09, 0x08, 0x00, 0x08, 0x10, 0x80, 0x35, 0xDE, 0x7B, 0x04, 0x00, 0x02, 0x04, 0x60, 0x8D, 0x73,
+    0x20, 0x00, 0x20, 0x40, 0x00, 0xD6, 0x38, 0x07, 0x02, 0x00, 0x02, 0x04, 0x60, 0xCD, 0xAB, 0x2D,
+    0x58, 0x00, 0x20, 0x40, 0x00, 0x56, 0x24, 0x79, 0x49, 0xF2, 0x6C, 0x25, 0x00, 0x40, 0x80, 0x00,
+    0xAC, 0x68, 0x7B, 0x6F, 0xFB, 0x68, 0x25, 0x00, 0x40, 0x80, 0x00, 0x9C, 0xCE, 0x75, 0xBC, 0x00,
+    0x20, 0x40, 0x00, 0x36, 0xB9, 0x09, 0x0B, 0x00, 0x04, 0x08, 0xC0, 0x9A, 0xA3, 0xAD, 0x73, 0x20,
+    0x00, 0x20, 0x40, 0x00, 0x56, 0xDC, 0x92, 0xB8, 0x8A, 0x17, 0x00, 0x04, 0x08, 0xC0, 0xF9, 0x92,
+    0xBC, 0xCD, 0xCC, 0xB4, 0x7D, 0xB0, 0x1A, 0x00, 0x20, 0x40, 0x00, 0x4E, 0xD7, 0xD6, 0x39, 0x10,
+    0x00, 0x10, 0x20, 0x00, 0x3B, 0x92, 0x1C, 0x33, 0xE3, 0x1C, 0x08, 0x00, 0x08, 0x10, 0x80, 0x15,
+    0xB7, 0x99, 0x71, 0x0E, 0x04, 0x00, 0x04, 0x08, 0xC0, 0x4E, 0x80, 0xB4, 0xB5, 0x05, 0x0B, 0x00,
+    0x04, 0x08, 0xC0, 0xF9, 0x92, 0xDC, 0x93, 0x78, 0x1B, 0x3A, 0x00, 0x08, 0x10, 0x80, 0x1D, 0x6D,
+    0x8F, 0xB6, 0x4F, 0x56, 0x02, 0x00, 0x04, 0x08, 0xC0, 0xE9, 0x92, 0x38, 0x07, 0x02, 0x00, 0x02,
+    0x04, 0x60, 0x8D, 0xAB, 0x78, 0x01, 0x40, 0x80, 0x00, 0xAC, 0xF1, 0x04, 0x04, 0x00, 0x04, 0x08,
+    0xC0, 0x8E, 0xF7, 0x2D, 0x58, 0x9E, 0x80, 0x00, 0x80, 0x00, 0x01, 0x58, 0xE3, 0x3A, 0x5E, 0x00,
+    0x10, 0x20, 0x00, 0x6B, 0x9C, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x43, 0xDB, 0x5F, 0x6D, 0x7F, 0x5B, 0x09,
+    0xF8, 0x1E, 0x7E, 0x58, 0x02, 0x0C, 0x03, 0x00, 0x3E, 0xD8, 0x6B, 0xDB, 0x3F, 0x2C, 0x03, 0x08,
+    0x10, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0xD3, 0x25, 0x79, 0x49, 0xF2, 0x6C, 0x25, 0x40, 0x80, 0x60,
+    0x18, 0x18, 0x06, 0x00, 0xAC, 0x68, 0x7B, 0x6F, 0xFB, 0x68, 0x25, 0x40, 0x80, 0x60, 0x18, 0x18,
+    0x06, 0x00, 0x9C, 0x2E, 0xC9, 0x6D, 0x66, 0x3C, 0x79, 0x07, 0x01, 0x82, 0x61, 0x60, 0x18, 0x00,
+    0xB0, 0xE2, 0xD5, 0xCC, 0x01, 0x01, 0x02, 0x86, 0x01, 0x00, 0x5B, 0x8E, 0xB6, 0xB6, 0xFE, 0x82,
+    0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0x58, 0x71, 0x4B, 0xF2, 0xD3, 0x32, 0x80, 0x00, 0xC1, 0x30,
+    0x30, 0x0C, 0x00, 0x38, 0x5D, 0x92, 0xB7, 0x99, 0x99, 0xB6, 0x0F, 0x56, 0x03, 0x04, 0x08, 0x86,
+    0x81, 0x61, 0x00, 0xC0, 0xE9, 0xDA, 0xDA, 0xFA, 0x0B, 0x02, 0x04, 0xC3, 0xC0, 0x30, 0x00, 0x60,
+    0x47, 0x92, 0x63, 0x66, 0x6C, 0xFD, 0x05, 0x01, 0x82, 0x61, 0x60, 0x18, 0x00, 0xB0, 0xE2, 0x36,
+    0x33, 0xB6, 0xFE, 0x82, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0xD8, 0x99, 0x39, 0x6D, 0x3D, 0x75,
+    0x07, 0x01, 0x82, 0x61, 0x60, 0x18, 0x00, 0x70, 0xBE, 0x24, 0xF7, 0x24, 0x5E, 0x80, 0x0B, 0x02,
+    0x04, 0xC3, 0xC0, 0x30, 0x00, 0x60, 0x47, 0xDB, 0xA3, 0xED, 0x93, 0x95, 0x00, 0x01, 0x82, 0x61,
+    0x60, 0x18, 0x00, 0x70, 0xBA, 0x24, 0xB6, 0xFE, 0x82, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0x58,
+    0xE3, 0xF6, 0x45, 0x10, 0x20, 0x60, 0x18, 0x00, 0xB0, 0xC6, 0x8F, 0x5E, 0x20, 0x40, 0xC0, 0x30,
+    0x00, 0x60, 0xC7, 0xFB, 0x53, 0x77, 0x3F, 0x7A, 0x81, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0x58,
+    0xE3, 0x06, 0x46, 0x10, 0x20, 0x60, 0x18, 0x00, 0xB0, 0xC6, 0xD6, 0x5F, 0x10, 0x20, 0x60, 0x18,
+    0x00, 0xB0, 0xC6, 0xD6, 0x5F, 0x10, 0x20, 0x60, 0x18, 0x00, 0xB0, 0xE6, 0xD5, 0x53, 0x77, 0x10,
+    0x20, 0x60, 0x18, 0x00, 0xB0, 0x22, 0xC9, 0x4B, 0x92, 0x67, 0x2B, 0x01, 0x02, 0x04, 0xC3, 0xC0,
+    0x30, 0x00, 0x60, 0x45, 0xDB, 0x7B, 0xDB, 0x47, 0x2B, 0x01, 0x02, 0x04, 0xC3, 0xC0, 0x30, 0x00,
+    0xE0, 0x74, 0x6E, 0x60, 0x04, 0x01, 0x02, 0x86, 0x01, 0x00, 0x9B, 0x5C, 0x7E, 0x02, 0x02, 0x04,
+    0x0C, 0x03, 0x00, 0xD6, 0x1C, 0x6D, 0x6D, 0xFD, 0x05, 0x01, 0x82, 0x61, 0x60, 0x18, 0x00, 0xB0,
+    0xE2, 0x96, 0xC4, 0xED, 0x8B, 0x20, 0x40, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0xCE, 0x97, 0xE4, 0x6D,
+    0x66, 0xA6, 0xED, 0x83, 0xD5, 0x00, 0x01, 0x82, 0x61, 0x60, 0x18, 0x00, 0x70, 0xBA, 0xB6, 0xB6,
+    0xFE, 0x82, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0xD8, 0x91, 0xE4, 0x98, 0x19, 0x5B, 0x7F, 0x41,
+    0x80, 0x60, 0x18, 0x18, 0x06, 0x00, 0xAC, 0xB8, 0xCD, 0x8C, 0xAD, 0xBF, 0x20, 0x40, 0x30, 0x0C,
+    0x0C, 0x03, 0x00, 0x76, 0x66, 0x4E, 0x5B, 0x4F, 0xDD, 0x41, 0x80, 0x60, 0x18, 0x18, 0x06, 0x00,
+    0x9C, 0x2F, 0xC9, 0x3D, 0x89, 0x17, 0xE0, 0x82, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0xD8, 0xD1,
+    0xF6, 0x68, 0xFB, 0x64, 0x25, 0x40, 0x80, 0x60, 0x18, 0x18, 0x06, 0x00, 0x9C, 0x2E, 0x89, 0xAD,
+    0xBF, 0x20, 0x40, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0xD6, 0xB8, 0x7D, 0x11, 0x04, 0x08, 0x18, 0x06,
+    0x00, 0xAC, 0xF1, 0xA3, 0x17, 0x08, 0x10, 0x30, 0x0C, 0x00, 0xD8, 0xF1, 0xFE, 0xD4, 0xDD, 0x8F,
+    0x5E, 0x20, 0x40, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0xD6, 0xB8, 0x81, 0x11, 0x04, 0x08, 0x18, 0x06,
+    0x00, 0xAC, 0xB1, 0xF5, 0x17, 0x04, 0x08, 0x18, 0x06, 0x00, 0xAC, 0xB1, 0xF5, 0x17, 0x04, 0x08,
+    0x18, 0x06, 0x00, 0xAC, 0x79, 0xF5, 0xD4, 0x1D, 0x04, 0x08, 0x18, 0x06, 0x00, 0xAC, 0x48, 0xF2,
+    0x92, 0xE4, 0xD9, 0x4A, 0x80, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0x58, 0xD1, 0xF6, 0xDE, 0xF6,
+    0xD1, 0x4A, 0x80, 0x00, 0xC1, 0x30, 0x30, 0x0C, 0x00, 0x38, 0x9D, 0x1B, 0x18, 0x41, 0x80, 0x80,
+    0x61, 0x00, 0xC0, 0x26, 0x97, 0x9F, 0x80, 0x00, 0x01, 0xC3, 0x00, 0x80, 0x35, 0x47, 0x5B, 0x5B,
+    0x7F, 0x41, 0x80, 0x60, 0x18, 0x18, 0x06, 0x00, 0xAC, 0xB8, 0x25, 0x71, 0xFB, 0x22, 0x08, 0x10,
+    0x0C, 0x03, 0xC3, 0x00, 0x80, 0xF3, 0x25, 0x79, 0x9B, 0x99, 0x69, 0xFB, 0x60, 0x35, 0x40, 0x80,
+    0x60, 0x18, 0x18, 0x06, 0x00, 0x9C, 0xAE, 0xAD, 0xAD, 0xBF, 0x20, 0x40, 0x30, 0x0C, 0x0C, 0x03,
+    0x00, 0x76, 0x24, 0x39, 0x66, 0xC6, 0xD6, 0x5F, 0x10, 0x20, 0x18, 0x06, 0x86, 0x01, 0x00, 0x2B,
+    0x6E, 0x33, 0x63, 0xEB, 0x2F, 0x08, 0x10, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0x9D, 0x99, 0xD3, 0xD6,
+    0x53, 0x77, 0x10, 0x20, 0x18, 0x06, 0x86, 0x01, 0x00, 0xE7, 0x4B, 0x72, 0x4F, 0xE2, 0x05, 0xB8,
+    0x20, 0x40, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0x76, 0xB4, 0x3D, 0xDA, 0x3E, 0x59, 0x09, 0x10, 0x20,
+    0x18, 0x06, 0x86, 0x01, 0x00, 0xA7, 0x4B, 0x62, 0xEB, 0x2F, 0x08, 0x10, 0x0C, 0x03, 0xC3, 0x00,
+    0x80, 0x35, 0x6E, 0x5F, 0x04, 0x01, 0x02, 0x86, 0x01, 0x00, 0x6B, 0xFC, 0xE8, 0x05, 0x02, 0x04,
+    0x0C, 0x03, 0x00, 0x76, 0xBC, 0x3F, 0x75, 0xF7, 0xA3, 0x17, 0x08, 0x10, 0x0C, 0x03, 0xC3, 0x00,
+    0x80, 0x35, 0x6E, 0x60, 0x04, 0x01, 0x02, 0x86, 0x01, 0x00, 0x6B, 0x6C, 0xFD, 0x05, 0xF8, 0xEE,
+    0xDA, 0xFE, 0x67, 0xDB, 0xFF, 0xB0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x6D,
+    0x7F, 0xB5, 0xFD, 0xFD, 0x15, 0xFE, 0x2C, 0x3F, 0x7C, 0x9C, 0x00, 0x00, 0xF0, 0xE9, 0xBD, 0xB6,
+    0xFD, 0x43, 0x80, 0x00, 0x00, 0x00, 0xA7, 0x4B, 0xF2, 0x92, 0xE4, 0x59, 0x80, 0x00, 0x00, 0x00,
+    0x5B, 0x6E, 0x5F, 0xE1, 0x29, 0x88, 0x00, 0x01, 0x00, 0x80, 0x6B, 0x78, 0x9D, 0x19, 0x01, 0x02,
+    0x00, 0x00, 0xAC, 0xB8, 0xCF, 0xCC, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x36, 0x1C, 0x6D, 0x2F, 0x7F,
+    0x0E, 0x44, 0x80, 0x00, 0x00, 0xC0, 0x35, 0xDC, 0x92, 0xFC, 0x14, 0x20, 0x00, 0x00, 0xC0, 0xE9,
+    0x92, 0xBC, 0xB5, 0xFD, 0x67, 0xDB, 0x4B, 0x6F, 0xC3, 0x12, 0x20, 0x00, 0x00, 0x70, 0x9D, 0x08,
+    0xB9, 0xCD, 0xC5, 0x0F, 0xA2, 0x0B, 0x10, 0x00, 0x00, 0xB8, 0x8E, 0xCB, 0xDF, 0x84, 0x25, 0x40,
+    0x00, 0x00, 0xE0, 0x3A, 0x2E, 0x7F, 0x10, 0x5D, 0x80, 0x00, 0x00, 0xC0, 0x75, 0x5C, 0xFE, 0x20,
+    0xBA, 0x00, 0x01, 0x00, 0x80, 0x8B, 0xF8, 0x0A, 0x07, 0xD1, 0x05, 0x08, 0x00, 0x00, 0x5C, 0x2B,
+    0x42, 0x2E, 0x7D, 0x10, 0x5D, 0x80, 0x00, 0x00, 0xC0, 0xB5, 0x5C, 0xFA, 0x20, 0xBA, 0x00, 0x01,
+    0x00, 0x80, 0x6B, 0xB9, 0xF4, 0x41, 0x74, 0x01, 0x02, 0x00, 0x00, 0xD7, 0x72, 0xE9, 0x83, 0xE8,
+    0x02, 0x04, 0x00, 0x00, 0x2E, 0x24, 0xC9, 0xDB, 0xCC, 0x4C, 0xDB, 0x07, 0x01, 0x02, 0x00, 0x00,
+    0x9C, 0xAE, 0xED, 0x65, 0xCF, 0x81, 0x08, 0x10, 0x00, 0x00, 0xB8, 0x98, 0x24, 0xC7, 0xCC, 0x5C,
+    0xF2, 0x1C, 0x88, 0x00, 0x01, 0x00, 0x80, 0xEB, 0xB9, 0xCD, 0xCC, 0x25, 0xCF, 0x81, 0x08, 0x10,
+    0x00, 0x00, 0xB8, 0x60, 0x80, 0xB4, 0xB5, 0x05, 0x0B, 0x00, 0x00, 0x38, 0x5F, 0x92, 0x7B, 0x92,
+    0xBF, 0x5D, 0xF1, 0x20, 0xBA, 0x00, 0x01, 0x00, 0x80, 0x0B, 0xBA, 0xEA, 0x41, 0x74, 0x01, 0x02,
+    0x00, 0x00, 0x17, 0x74, 0xD5, 0x83, 0xE8, 0x02, 0x04, 0x00, 0x00, 0xAE, 0xE9, 0x92, 0x07, 0xD1,
+    0x05, 0x08, 0x00, 0x00, 0x5C, 0x34, 0x40, 0xAE, 0x78, 0x10, 0x5D, 0x80, 0x00, 0x00, 0xC0, 0x05,
+    0xBD, 0x1F, 0x44, 0x7F, 0x14, 0x20, 0x00, 0x00, 0xC0, 0x8A, 0xB6, 0x47, 0xDB, 0x27, 0x01, 0x02,
+    0x00, 0x00, 0x9C, 0x2E, 0xC9, 0xE5, 0xCE, 0x81, 0x08, 0x10, 0x00, 0x00, 0xB8, 0xAE, 0xCB, 0x5D,
+    0xC5, 0x2B, 0x40, 0x00, 0x00, 0xE0, 0xBA, 0x3C, 0x01, 0x01, 0x00, 0x00, 0x76, 0xBC, 0x6F, 0xC1,
+    0xF2, 0x04, 0x04, 0x00, 0x00, 0xD8, 0x71, 0xB5, 0x83, 0xE8, 0x02, 0x04, 0x00, 0x00, 0x2E, 0xEC,
+    0x6A, 0x07, 0xD1, 0x05, 0x08, 0x00, 0x00, 0x5C, 0xDB, 0xA5, 0x0E, 0xA2, 0x0B, 0x10, 0x00, 0x00,
+    0xB8, 0x36, 0x4F, 0x40, 0x00, 0x00, 0x80, 0x1D, 0x57, 0x3B, 0x88, 0x2E, 0x40, 0x00, 0x00, 0xE0,
+    0xE2, 0xAE, 0x74, 0x10, 0x5D, 0x80, 0x00, 0x00, 0xC0, 0xC5, 0x5D, 0xE9, 0x20, 0xBA, 0x00, 0x01,
+    0x00, 0x80, 0xEB, 0xBB, 0xCF, 0xCC, 0xA3, 0x00, 0x01, 0x00, 0x00, 0x36, 0xBC, 0xB6, 0xBD, 0xC4,
+    0x39, 0x10, 0x01, 0x02, 0x00, 0x00, 0x17, 0x97, 0xE4, 0x25, 0xC9, 0xB3, 0x00, 0x01, 0x00, 0x00,
+    0xB6, 0xDC, 0xAE, 0xF0, 0x14, 0x44, 0x80, 0x00, 0x00, 0xC0, 0xD7, 0x70, 0xA9, 0x17, 0x12, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xA9,
+    0xED, 0xAF, 0xB6, 0xBF, 0xAD, 0x04, 0xC0, 0xFF, 0xED, 0x87, 0x25, 0x00, 0x80, 0xBF, 0xCC, 0x6B,
+    0xDB, 0x3F, 0x2C, 0x03, 0x80, 0x00, 0x01, 0x80, 0xD3, 0x25, 0x79, 0x49, 0xF2, 0x6C, 0x25, 0x00,
+    0x04, 0x08, 0x00, 0xAC, 0x68, 0x7B, 0x6F, 0xFB, 0x68, 0x25, 0x00, 0x04, 0x08, 0x00, 0x9C, 0x2E,
+    0xC9, 0x6D, 0x66, 0x6C, 0xC3, 0x02, 0x10, 0x20, 0x00, 0xB0, 0xE2, 0x55, 0x80, 0x00, 0x08, 0x10,
+    0x00, 0xD8, 0x72, 0xB4, 0x75, 0x0E, 0x04, 0x40, 0x80, 0x00, 0xC0, 0x8A, 0x5B, 0x92, 0x9F, 0x96,
+    0x01, 0x40, 0x80, 0x00, 0xC0, 0xE9, 0x92, 0xBC, 0xCD, 0xCC, 0xB4, 0x7D, 0xB0, 0x1A, 0x00, 0x02,
+    0x04, 0x00, 0x4E, 0xD7, 0xD6, 0x39, 0x10, 0x00, 0x01, 0x02, 0x00, 0x3B, 0x92, 0x1C, 0x33, 0xE3,
+    0x1C, 0x08, 0x80, 0x00, 0x01, 0x80, 0x15, 0xB7, 0x99, 0x71, 0x0E, 0x04, 0x40, 0x80, 0x00, 0xC0,
+    0x4E, 0x80, 0xB4, 0xB5, 0x05, 0x0B, 0x40, 0x80, 0x00, 0xC0, 0xF9, 0x92, 0xDC, 0x93, 0x78, 0x1B,
+    0x3A, 0x80, 0x00, 0x01, 0x80, 0x1D, 0x6D, 0x8F, 0xB6, 0x4F, 0x56, 0x02, 0x40, 0x80, 0x00, 0xC0,
+    0xE9, 0x92, 0x38, 0x07, 0x02, 0x20, 0x40, 0x00, 0x60, 0x8D, 0xAB, 0x78, 0x01, 0x04, 0x08, 0x00,
+    0xAC, 0xF1, 0x04, 0x04, 0x40, 0x80, 0x00, 0xC0, 0x8E, 0xF7, 0x2D, 0x58, 0x9E, 0x80, 0x00, 0x08,
+    0x10, 0x00, 0x58, 0xE3, 0x3A, 0x5E, 0x00, 0x01, 0x02, 0x00, 0x6B, 0x9C, 0x03, 0x01, 0x10, 0x20,
+    0x00, 0xB0, 0xC6, 0x39, 0x10, 0x00, 0x01, 0x02, 0x00, 0x6B, 0x5E, 0x6D, 0xC1, 0x02, 0x10, 0x20,
+    0x00, 0xB0, 0x22, 0xC9, 0x4B, 0x92, 0x67, 0x2B, 0x01, 0x20, 0x40, 0x00, 0x60, 0x45, 0xDB, 0x7B,
+    0xDB, 0x47, 0x2B, 0x01, 0x20, 0x40, 0x00, 0xE0, 0x74, 0xAE, 0xE3, 0x05, 0x10, 0x20, 0x00, 0xB0,
+    0xC9, 0x4D, 0x58, 0x00, 0x02, 0x04, 0x00, 0xD6, 0x1C, 0x6D, 0x9D, 0x03, 0x01, 0x10, 0x20, 0x00,
+    0xB0, 0xE2, 0x96, 0xC4, 0x55, 0xBC, 0x00, 0x02, 0x04, 0x00, 0xCE, 0x97, 0xE4, 0x6D, 0x66, 0xA6,
+    0xED, 0x83, 0xD5, 0x00, 0x10, 0x20, 0x00, 0x70, 0xBA, 0xB6, 0xCE, 0x81, 0x00, 0x08, 0x10, 0x00,
+    0xD8, 0x91, 0xE4, 0x98, 0x19, 0xE7, 0x40, 0x00, 0x04, 0x08, 0x00, 0xAC, 0xB8, 0xCD, 0x8C, 0x73,
+    0x20, 0x00, 0x02, 0x04, 0x00, 0x76, 0x02, 0xA4, 0xAD, 0x2D, 0x58, 0x00, 0x02, 0x04, 0x00, 0xCE,
+    0x97, 0xE4, 0x9E, 0xC4, 0xDB, 0xD0, 0x01, 0x04, 0x08, 0x00, 0xEC, 0x68, 0x7B, 0xB4, 0x7D, 0xB2,
+    0x12, 0x80, 0x00, 0x01, 0x00, 0x4E, 0x97, 0xC4, 0x39, 0x10, 0x00, 0x01, 0x02, 0x00, 0x6B, 0x5C,
+    0xC5, 0x0B, 0x20, 0x40, 0x00, 0x60, 0x8D, 0x27, 0x20, 0x00, 0x02, 0x04, 0x00, 0x76, 0xBC, 0x6F,
+    0xC1, 0xF2, 0x04, 0x04, 0x10, 0x20, 0x96, 0x00, 0x00, 0xD6, 0xB8, 0x8E, 0x17, 0x10, 0x20, 0x96,
+    0x00, 0x00, 0xD6, 0x38, 0x07, 0x02, 0x08, 0x10, 0x4B, 0x00, 0x00, 0x6B, 0x9C, 0x03, 0x01, 0x04,
+    0x88, 0x25, 0x00, 0x80, 0x35, 0xAF, 0xB6, 0x60, 0x01, 0x02, 0x04, 0x00, 0x58, 0x91, 0xE4, 0x25,
+    0xC9, 0xB3, 0x95, 0x00, 0x04, 0x08, 0x00, 0xB0, 0xA2, 0xED, 0xBD, 0xED, 0xA3, 0x95, 0x00, 0x04,
+    0x08, 0x00, 0x70, 0x3A, 0xD7, 0xF1, 0x02, 0x02, 0x04, 0x00, 0xD8, 0xE4, 0x26, 0x2C, 0x40, 0x80,
+    0x00, 0x00, 0x6B, 0x8E, 0xB6, 0xCE, 0x81, 0x00, 0x02, 0x04, 0x00, 0x58, 0x71, 0x4B, 0xE2, 0x2A,
+    0x5E, 0x40, 0x80, 0x00, 0x00, 0xE7, 0x4B, 0xF2, 0x36, 0x33, 0xD3, 0xF6, 0xC1, 0x6A, 0x00, 0x02,
+    0x04, 0x00, 0x38, 0x5D, 0x5B, 0xE7, 0x40, 0x00, 0x01, 0xF2, 0x09, 0xFF, 0x71, 0xFE, 0xD5, 0xF6,
+    0xB7, 0x8F, 0x08, 0x80, 0xAF, 0x26, 0xC9, 0x31, 0x33, 0xCE, 0x81, 0x00, 0x02, 0xE4, 0x93, 0xF1,
+    0xB6, 0x58, 0x00, 0xBE, 0xAA, 0xDB, 0xCC, 0x38, 0x07, 0x02, 0x08, 0x90, 0xCF, 0xC4, 0xDB, 0x62,
+    0x01, 0xF8, 0xCA, 0x01, 0xE2, 0x47, 0x36, 0x40, 0x80, 0x7C, 0x42, 0xDE, 0x16, 0x0B, 0xC0, 0x57,
+    0x94, 0xE4, 0x9E, 0xC4, 0x7C, 0x03, 0x04, 0xC8, 0x27, 0xFC, 0x07, 0xDA, 0xDB, 0x62, 0x01, 0xF8,
+    0x92, 0xDA, 0x1E, 0x6D, 0x9F, 0xAC, 0x04, 0x20, 0x40, 0x3E, 0x17, 0xB7, 0x84, 0x00, 0xF0, 0x25,
+    0xBD, 0xFF, 0xC8, 0xE6, 0x1C, 0x08, 0x20, 0x40, 0x3E, 0x19, 0x6F, 0x8B, 0x05, 0xE0, 0xAB, 0xF2,
+    0x23, 0x1B, 0x20, 0x40, 0x3E, 0x21, 0x6F, 0x8B, 0x05, 0xE0, 0xAB, 0xF2, 0x04, 0x04, 0x10, 0x20,
+    0x9F, 0x8D, 0xB7, 0xC5, 0x02, 0xF0, 0x55, 0x39, 0xE7, 0x08, 0x08, 0x90, 0x4F, 0xCA, 0xDB, 0x62,
+    0x01, 0xF8, 0xC2, 0x5C, 0xC7, 0x0B, 0x08, 0x90, 0xCF, 0xC6, 0xDB, 0x62, 0x01, 0xF8, 0xC2, 0xFC,
+    0xC8, 0x06, 0xF0, 0xD9, 0xB4, 0xFD, 0x7B, 0xDB, 0xFF, 0xB2, 0x12, 0x00, 0x00, 0x70, 0x7D, 0x3F,
+    0x2E, 0xF0, 0xFF, 0xE8, 0xF1, 0x34, 0x00, 0x00, 0x08, 0x90, 0x1D, 0xDE, 0x16, 0x0B, 0x00, 0x00,
+    0x02, 0x64, 0x95, 0xB7, 0xC5, 0x02, 0x00, 0x80, 0x00, 0x59, 0xE3, 0x6D, 0xB1, 0x00, 0x00, 0x20,
+    0x40, 0x36, 0xB9, 0x25, 0x04, 0x00, 0x00, 0x04, 0xC8, 0x1A, 0x4F, 0x40, 0x00, 0x00, 0x40, 0x80,
+    0xEC, 0xF0, 0xB6, 0x58, 0x00, 0x00, 0x10, 0x20, 0xDB, 0x5C, 0xC7, 0x0B, 0x00, 0x00, 0x02, 0x64,
+    0x8D, 0x73, 0x20, 0x00, 0x00, 0x20, 0x40, 0xD6, 0x38, 0x07, 0x02, 0x00, 0x00, 0x02, 0x64, 0xCD,
+    0xAB, 0x2D, 0x58, 0x00, 0x00, 0x20, 0x40, 0x56, 0x24, 0x79, 0x49, 0xF2, 0xEC, 0x23, 0x03, 0x00,
+    0x00, 0x01, 0xB2, 0xA2, 0xED, 0xBD, 0xED, 0xA3, 0x8F, 0x0D, 0x00, 0x00, 0x04, 0xC8, 0xE9, 0x5C,
+    0xC7, 0x0B, 0x00, 0x00, 0x02, 0x64, 0x93, 0x9B, 0xB0, 0x00, 0x00, 0x40, 0x80, 0xAC, 0x39, 0xDA,
+    0x3A, 0x07, 0x02, 0x00, 0x00, 0x02, 0x64, 0xC5, 0x2D, 0x89, 0xAB, 0x78, 0x01, 0x00, 0x40, 0x80,
+    0x9C, 0x2F, 0xC9, 0xDB, 0xCC, 0x4C, 0xDB, 0x07, 0x1F, 0x1D, 0x00, 0x00, 0x08, 0x90, 0xD3, 0xB5,
+    0x75, 0x0E, 0x04, 0x00, 0x00, 0x04, 0xC8, 0x8E, 0x24, 0xC7, 0xCC, 0x38, 0x07, 0x02, 0x00, 0x00,
+    0x02, 0x64, 0xC5, 0x6D, 0x66, 0x9C, 0x03, 0x01, 0x00, 0x00, 0x01, 0xB2, 0x13, 0x20, 0x6D, 0x6D,
+    0xC1, 0x02, 0x00, 0x00, 0x01, 0x72, 0xBE, 0x24, 0xF7, 0x24, 0xDE, 0x86, 0x0E, 0x00, 0x00, 0x02,
+    0x64, 0x47, 0xDB, 0xA3, 0xED, 0x93, 0x8F, 0x0F, 0x00, 0x00, 0x04, 0xC8, 0xE9, 0x92, 0x38, 0x07,
+    0x02, 0x00, 0x00, 0x02, 0x64, 0x8D, 0xAB, 0x78, 0x01, 0x00, 0x3E, 0x58, 0xDB, 0x5F, 0x6D, 0x7F,
+    0x5B, 0x09, 0xBE, 0x43, 0x80, 0x78, 0x02, 0x02, 0x00, 0xF0, 0xF1, 0x5E, 0x5D, 0x0E, 0xC4, 0xB7,
+    0x08, 0x90, 0xF7, 0x2D, 0x58, 0xFE, 0xB2, 0x03, 0x00, 0x7C, 0xEC, 0x77, 0xB2, 0x97, 0x24, 0xDE,
+    0xCF, 0xC6, 0xD7, 0x0F, 0x90, 0x77, 0xAE, 0xE3, 0x05, 0x00, 0xF0, 0x9D, 0x0C, 0x01, 0xB2, 0xC6,
+    0x39, 0x10, 0x00, 0x00, 0xDF, 0xC9, 0x10, 0x20, 0x7B, 0xB5, 0x3D, 0xCE, 0x81, 0x00, 0x00, 0x7C,
+    0xB4, 0xFB, 0xCC, 0x78, 0x47, 0x1B, 0xDF, 0x22, 0x40, 0x1C, 0x7A, 0x02, 0x00, 0xF8, 0x78, 0x47,
+    0x5B, 0xE7, 0x40, 0xF8, 0xFA, 0x01, 0xE2, 0xD0, 0x13, 0x00, 0xC0, 0xA7, 0x70, 0x4B, 0x62, 0x57,
+    0x0A, 0x5F, 0x3F, 0x40, 0x66, 0x66, 0xDA, 0xDE, 0xDB, 0x7A, 0xE4, 0x07, 0x00, 0xF0, 0x41, 0x92,
+    0xBC, 0xB5, 0xFD, 0xA7, 0xEF, 0x64, 0x7C, 0x8B, 0x00, 0x71, 0x1D, 0x2F, 0x00, 0x80, 0xEF, 0x64,
+    0x08, 0x90, 0x4D, 0x6E, 0x5D, 0x00, 0x00, 0xF0, 0x9D, 0x0C, 0x01, 0xB2, 0xC6, 0xA1, 0x27, 0x00,
+    0x00, 0xDF, 0xC9, 0x10, 0x20, 0x6B, 0x1C, 0x7A, 0x02, 0x00, 0xF0, 0x9D, 0x0C, 0x01, 0xB2, 0x23,
+    0xC9, 0xDB, 0xCC, 0x4C, 0xDB, 0x07, 0x1F, 0x25, 0x00, 0xC0, 0xC7, 0x7D, 0x27, 0x73, 0x10, 0x9D,
+    0x6F, 0x11, 0x20, 0xEF, 0xF1, 0x61, 0xCF, 0x21, 0x00, 0xC0, 0xC7, 0x47, 0x88, 0x83, 0xE8, 0x7C,
+    0x8F, 0x00, 0x49, 0x72, 0xCC, 0x8C, 0x3D, 0x87, 0x00, 0x00, 0x1F, 0xCB, 0x8F, 0xC2, 0x7C, 0x8F,
+    0x00, 0x99, 0x99, 0xDB, 0xCC, 0xD8, 0x73, 0x08, 0x00, 0xF0, 0xB1, 0x1C, 0x44, 0xE7, 0xFB, 0x04,
+    0x48, 0x5B, 0xB5, 0x0D, 0x00, 0xF0, 0xC1, 0xDF, 0xC9, 0x1C, 0x44, 0xE7, 0x5B, 0x04, 0x48, 0x92,
+    0x7B, 0x12, 0x07, 0x9E, 0x00, 0x00, 0x3E, 0xF6, 0x3B, 0x99, 0xCB, 0x81, 0xF8, 0x1E, 0x01, 0xF2,
+    0xFE, 0x17, 0xFD, 0x68, 0xFB, 0xE4, 0xE3, 0x04, 0x00, 0xF8, 0xD0, 0xEF, 0x64, 0xCE, 0x81, 0xF0,
+    0x3D, 0x02, 0xE4, 0xFD, 0xD6, 0x05, 0x8F, 0xFC, 0x00, 0x00, 0x3E, 0xF6, 0x3B, 0x99, 0xCB, 0x81,
+    0xF8, 0x1E, 0x01, 0x32, 0x6E, 0x5D, 0x00, 0x00, 0xF8, 0x0C, 0xFC, 0x28, 0xCC, 0xB7, 0x09, 0x10,
+    0x7F, 0xD9, 0x01, 0x00, 0x3E, 0xC1, 0x77, 0x32, 0x97, 0x03, 0xF1, 0x2D, 0x02, 0xC4, 0x8B, 0x6F,
+    0x00, 0x00, 0x3E, 0xC5, 0x77, 0xB2, 0x7B, 0x92, 0xBF, 0x39, 0x88, 0xCE, 0xB7, 0xD0, 0xF6, 0xBF,
+    0x15, 0x37, 0x00, 0x00, 0x7C, 0x6E, 0x3F, 0xBE, 0xD0, 0x9F, 0xC5, 0x39, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x17, 0xFD, 0x2F, 0x9D, 0xB3, 0x03, 0x48, 0xC8, 0x3A, 0x5A, 0xC2,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82 
+};
+unsigned int rain_tile_distant_len = sizeof(rain_tile_distant);
+
+#endif
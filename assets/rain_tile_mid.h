@@ -0,0 +1,304 @@
+#ifndef RAIN_TILE_MID_H
+#define RAIN_TILE_MID_H
+
+unsigned char rain_tile_mid[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x08, 0x06, 0x00, 0x00, 0x00, 0x9A, 0x76, 0x82,
+    0x70, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61,
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 0x44, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xA0,
+    0xBD, 0xA7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00,
+    0x00, 0x0B, 0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45,
+    0x07, 0xDE, 0x03, 0x08, 0x16, 0x36, 0x2B, 0x5B, 0xFF, 0x32, 0x37, 0x00, 0x00, 0x11, 0xFD, 0x49,
+    0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0xDD, 0x31, 0x72, 0x1B, 0x4B, 0x96, 0x85, 0xE1, 0x7B, 0x14,
+    0xE3, 0xD0, 0xA6, 0xAB, 0xE7, 0x8A, 0x6B, 0xD0, 0xB8, 0xED, 0xB6, 0xDD, 0xAE, 0x36, 0x32, 0xF6,
+    0xB8, 0xB3, 0x8F, 0xD9, 0x11, 0xCB, 0x2D, 0xB8, 0xB0, 0xE9, 0xBD, 0x33, 0x86, 0x18, 0xF1, 0xBA,
+    0xA3, 0x47, 0x12, 0x08, 0xB2, 0x92, 0x92, 0xF0, 0x7D, 0x2B, 0x50, 0x14, 0x28, 0x5C, 0xFC, 0x55,
+    0x95, 0x99, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0x9B, 0x69, 0xFB, 0xB9, 0xED, 0x17, 0x57, 0x02, 0x00, 0x80, 0x5F,
+    0xD9, 0x07, 0x97, 0xE0, 0x97, 0xB1, 0xCF, 0xCC, 0x1F, 0x2E, 0x03, 0x00, 0x00, 0x02, 0x84, 0xC3,
+    0x25, 0x39, 0x09, 0x10, 0x00, 0x00, 0x04, 0x08, 0xCB, 0xB4, 0xDD, 0xDA, 0x7E, 0x72, 0x25, 0x00,
+    0x00, 0x10, 0x20, 0x1C, 0x2E, 0x89, 0xD7, 0xB0, 0x00, 0x00, 0x10, 0x20, 0x2C, 0x73, 0x9E, 0x99,
+    0x7B, 0x97, 0x01, 0x00, 0x00, 0x01, 0xC2, 0x0A, 0x7B, 0x5B, 0x4F, 0x40, 0x00, 0x00, 0x10, 0x20,
+    0x1C, 0x2F, 0xC9, 0x96, 0xC4, 0x1A, 0x10, 0x00, 0x00, 0x04, 0x08, 0xCB, 0xEC, 0x6D, 0x3F, 0xBA,
+    0x0C, 0x00, 0x00, 0x08, 0x10, 0x96, 0x04, 0xC8, 0x58, 0x88, 0x0E, 0x00, 0x80, 0x00, 0x61, 0x11,
+    0xE7, 0x81, 0x00, 0x00, 0x20, 0x40, 0x58, 0xC6, 0x42, 0x74, 0x00, 0x00, 0x04, 0x08, 0x6B, 0x58,
+    0x88, 0x0E, 0x00, 0x80, 0x00, 0x61, 0x35, 0x0B, 0xD1, 0x01, 0x00, 0x10, 0x20, 0xAC, 0x0B, 0x90,
+    0xB1, 0x0E, 0x04, 0x00, 0x00, 0x01, 0xC2, 0x22, 0x16, 0xA2, 0x03, 0x00, 0x20, 0x40, 0x58, 0xC6,
+    0x42, 0x74, 0x00, 0x00, 0x04, 0x08, 0x6B, 0x58, 0x88, 0x0E, 0x00, 0x80, 0x00, 0x61, 0xA9, 0xB6,
+    0xE7, 0xB6, 0xF7, 0xAE, 0x04, 0x00, 0x00, 0x02, 0x84, 0xC3, 0x25, 0xD9, 0x67, 0xC6, 0x4E, 0x58,
+    0x00, 0x00, 0x08, 0x10, 0x96, 0xB0, 0x13, 0x16, 0x00, 0xC0, 0x3B, 0x6B, 0xFB, 0xB9, 0xED, 0x17,
+    0x57, 0x42, 0x80, 0xDC, 0x82, 0xAD, 0xED, 0x83, 0xCB, 0x00, 0x00, 0xF0, 0xAE, 0xDC, 0x14, 0x16,
+    0x20, 0xB7, 0xF3, 0xC7, 0x9E, 0xC4, 0x2B, 0x58, 0x00, 0x00, 0xEF, 0x28, 0x89, 0xE3, 0x11, 0x04,
+    0xC8, 0xCD, 0xFC, 0xB1, 0x3F, 0xB5, 0x7D, 0xB2, 0x10, 0x1D, 0x00, 0xE0, 0xDD, 0xED, 0x6D, 0xDD,
+    0x18, 0x16, 0x20, 0x37, 0x11, 0x21, 0x16, 0xA2, 0x03, 0x00, 0xFC, 0x04, 0x01, 0x32, 0x9E, 0x82,
+    0x08, 0x10, 0x7F, 0xEC, 0x00, 0x00, 0x2C, 0xE2, 0x35, 0x2C, 0x01, 0x72, 0x33, 0x2C, 0x44, 0x07,
+    0x00, 0x78, 0x7F, 0x7B, 0x5B, 0x01, 0x22, 0x40, 0x6E, 0xE3, 0x8F, 0xDD, 0x42, 0x74, 0x00, 0x80,
+    0xF7, 0x95, 0x64, 0x4B, 0xF2, 0xC9, 0x95, 0x10, 0x20, 0xB7, 0xF0, 0xC7, 0xFE, 0x34, 0x33, 0xD3,
+    0xF6, 0xCE, 0xD5, 0x00, 0x00, 0x78, 0x3F, 0x6D, 0xCF, 0x36, 0x07, 0x12, 0x20, 0xB7, 0xF2, 0xC7,
+    0xEE, 0x9D, 0x43, 0x00, 0x80, 0x77, 0x66, 0x73, 0x20, 0x01, 0x72, 0x4B, 0x7F, 0xEC, 0x8F, 0x33,
+    0xE3, 0x91, 0x1F, 0x00, 0xC0, 0xFB, 0xB2, 0x39, 0x90, 0x00, 0xF1, 0xC7, 0x0E, 0x00, 0xC0, 0x32,
+    0x36, 0x07, 0x12, 0x20, 0x37, 0xE3, 0x64, 0xD7, 0x05, 0x00, 0x80, 0x77, 0x67, 0x73, 0x20, 0x01,
+    0x72, 0x1B, 0x92, 0x9C, 0x93, 0xDC, 0x59, 0x88, 0x0E, 0x00, 0xF0, 0xAE, 0xBF, 0xC9, 0x6C, 0x0E,
+    0x24, 0x40, 0x6E, 0x87, 0x85, 0xE8, 0x00, 0x00, 0x7E, 0x93, 0x09, 0x10, 0x56, 0x16, 0xB7, 0x85,
+    0xE8, 0x00, 0x00, 0x7E, 0x93, 0x09, 0x10, 0x96, 0xB1, 0x10, 0x1D, 0x00, 0xC0, 0x6F, 0x32, 0x01,
+    0xC2, 0x32, 0x16, 0xA2, 0x03, 0x00, 0xF8, 0x4D, 0x26, 0x40, 0x58, 0xC3, 0x42, 0x74, 0x00, 0x80,
+    0x9F, 0xE6, 0x37, 0x99, 0xD3, 0xD0, 0x05, 0xC8, 0x6D, 0xB0, 0xE8, 0x09, 0x00, 0xE0, 0xA7, 0xF8,
+    0x4D, 0xB6, 0xB5, 0xB5, 0x0E, 0x44, 0x80, 0xDC, 0x44, 0x71, 0x5B, 0xF4, 0x04, 0x00, 0xF0, 0xFE,
+    0xBF, 0xC9, 0xAC, 0x03, 0x11, 0x20, 0x37, 0xE3, 0x3C, 0x33, 0x1E, 0xF9, 0x01, 0x00, 0xBC, 0xAF,
+    0x7D, 0x66, 0x1C, 0x48, 0x28, 0x40, 0x6E, 0xE6, 0x8F, 0x5D, 0x6D, 0x03, 0x00, 0xF8, 0x4D, 0x26,
+    0x40, 0x38, 0x5E, 0x12, 0x6B, 0x40, 0x00, 0x00, 0xFC, 0x26, 0x13, 0x20, 0xAC, 0x63, 0xD1, 0x13,
+    0x00, 0xC0, 0x4F, 0x61, 0x6F, 0xEB, 0x35, 0x2C, 0x01, 0x72, 0x13, 0xC5, 0xED, 0x91, 0x1F, 0x00,
+    0xC0, 0x4F, 0x10, 0x20, 0x7E, 0x93, 0x01, 0x00, 0x00, 0x4B, 0xB4, 0xFD, 0x5B, 0xDB, 0x7F, 0xB8,
+    0x12, 0xFF, 0x3F, 0x4F, 0x40, 0x00, 0x00, 0xE0, 0x6D, 0xED, 0x4E, 0x44, 0x17, 0x20, 0x00, 0x00,
+    0xB0, 0x44, 0x92, 0x2D, 0x89, 0x75, 0xB9, 0x02, 0x04, 0x00, 0x00, 0xD6, 0x68, 0x7B, 0x6E, 0xEB,
+    0x8C, 0x36, 0x01, 0x02, 0x00, 0x00, 0xC7, 0x7B, 0xDE, 0x1C, 0xC8, 0x4E, 0x58, 0x02, 0x04, 0x00,
+    0x00, 0x96, 0xB0, 0x13, 0x96, 0x00, 0x01, 0xE0, 0x52, 0x6D, 0x3F, 0xB7, 0xFD, 0xE2, 0x4A, 0x00,
+    0x5C, 0x6D, 0x6B, 0xFB, 0xE0, 0x32, 0x08, 0x10, 0x00, 0x2E, 0xE3, 0xCE, 0x1D, 0xC0, 0x2B, 0xBF,
+    0x47, 0x93, 0x78, 0x05, 0x4B, 0x80, 0x00, 0x70, 0x89, 0x24, 0x27, 0x01, 0x02, 0xF0, 0xAA, 0xEF,
+    0xD1, 0xA7, 0x99, 0x99, 0xB6, 0x77, 0xAE, 0x86, 0x00, 0x01, 0xE0, 0x32, 0x7B, 0x5B, 0x77, 0xEF,
+    0x00, 0xAE, 0xD4, 0xD6, 0xCD, 0x1C, 0x01, 0x02, 0xC0, 0x4B, 0x02, 0xC4, 0xE0, 0x04, 0xB8, 0x5E,
+    0x92, 0xC7, 0x99, 0x71, 0x1E, 0x88, 0x00, 0x01, 0xE0, 0x42, 0xEE, 0xDC, 0x01, 0xBC, 0x8E, 0x1B,
+    0x39, 0x02, 0x04, 0x80, 0x97, 0x0C, 0xCE, 0xB6, 0x06, 0x27, 0xC0, 0xF5, 0x4E, 0xBE, 0x47, 0x05,
+    0x08, 0x00, 0x17, 0x4A, 0xB2, 0x25, 0xF1, 0xEA, 0x00, 0xC0, 0xF5, 0xDF, 0xA3, 0xE7, 0x24, 0x4E,
+    0x43, 0x17, 0x20, 0x00, 0x5C, 0xAA, 0xED, 0xB9, 0xAD, 0xE1, 0x09, 0x70, 0xFD, 0xF7, 0xE8, 0xD6,
+    0xD6, 0xCD, 0x1C, 0x01, 0x02, 0xC0, 0x25, 0x92, 0xEC, 0x33, 0x63, 0x27, 0x2C, 0x80, 0xD7, 0x7D,
+    0x8F, 0x7A, 0x0D, 0x4B, 0x80, 0x00, 0x70, 0x21, 0x83, 0x13, 0xE0, 0xF5, 0xDF, 0xA3, 0x6E, 0xE4,
+    0x08, 0x10, 0x00, 0x2E, 0xB4, 0xB5, 0x7D, 0x70, 0x19, 0x00, 0x5E, 0x15, 0x20, 0x6E, 0xE4, 0x08,
+    0x10, 0x00, 0x2E, 0x1D, 0x9C, 0x49, 0xDC, 0xB9, 0x03, 0xB8, 0x52, 0x12, 0x5B, 0x9A, 0x0B, 0x10,
+    0x00, 0x5E, 0x30, 0x38, 0x9F, 0x66, 0x66, 0xDA, 0xDE, 0xB9, 0x1A, 0x00, 0x57, 0xDB, 0xDB, 0xBA,
+    0x99, 0x23, 0x40, 0x00, 0xB8, 0x44, 0x5B, 0x77, 0xEF, 0x00, 0x5E, 0x19, 0x20, 0xBE, 0x47, 0x05,
+    0x08, 0x00, 0x17, 0x4A, 0xF2, 0x38, 0x33, 0xB6, 0x90, 0x04, 0xB8, 0x9E, 0x1B, 0x39, 0x02, 0x04,
+    0x80, 0x17, 0x70, 0xE7, 0x0E, 0xE0, 0x95, 0xDF, 0xA3, 0x4E, 0x44, 0x17, 0x20, 0x00, 0x5C, 0xEE,
+    0x64, 0x70, 0x02, 0x5C, 0x2F, 0xC9, 0x96, 0xC4, 0x93, 0x64, 0x01, 0x02, 0xC0, 0x85, 0x83, 0xF3,
+    0x9C, 0xC4, 0x69, 0xE8, 0x00, 0xAF, 0xD0, 0xF6, 0xDC, 0xD6, 0x77, 0xA9, 0x00, 0x01, 0xE0, 0xC2,
+    0xC1, 0xB9, 0xB5, 0x75, 0xF7, 0x0E, 0xE0, 0x4A, 0xCF, 0x27, 0xA2, 0xDB, 0x09, 0x4B, 0x80, 0x00,
+    0xF0, 0x82, 0xC1, 0xE9, 0x35, 0x2C, 0x80, 0xEB, 0xF9, 0x1E, 0x15, 0x20, 0x00, 0xBC, 0x70, 0x70,
+    0xBA, 0x73, 0x07, 0x70, 0xBD, 0xAD, 0xED, 0x83, 0xCB, 0x20, 0x40, 0x00, 0xB8, 0x3C, 0x40, 0xDC,
+    0xB9, 0x03, 0x78, 0xC5, 0xF7, 0x68, 0x12, 0x37, 0x72, 0x04, 0x08, 0x00, 0x97, 0x48, 0x62, 0x0F,
+    0x7B, 0x80, 0xD7, 0x7D, 0x8F, 0x3E, 0xCD, 0xCC, 0xB4, 0xBD, 0x13, 0x20, 0x00, 0x70, 0x99, 0xBD,
+    0xAD, 0xBB, 0x77, 0x00, 0x57, 0x6A, 0xEB, 0x66, 0x8E, 0x00, 0x01, 0xE0, 0x25, 0x01, 0x62, 0x70,
+    0x02, 0x5C, 0x2F, 0xC9, 0xE3, 0xCC, 0xDC, 0xFC, 0x8E, 0x82, 0x02, 0x04, 0x80, 0x4B, 0xB9, 0x73,
+    0x07, 0xF0, 0x3A, 0x6E, 0xE4, 0x08, 0x10, 0x00, 0x5E, 0x32, 0x38, 0x9D, 0x88, 0x0E, 0xF0, 0x2A,
+    0x27, 0xDF, 0xA3, 0x02, 0x04, 0x80, 0x0B, 0x25, 0xD9, 0x92, 0x38, 0x8C, 0x10, 0xE0, 0xFA, 0xEF,
+    0xD1, 0x73, 0x92, 0x9B, 0x3F, 0x0D, 0x5D, 0x80, 0x00, 0x70, 0xB1, 0xB6, 0xE7, 0xB6, 0xF7, 0xAE,
+    0x04, 0xC0, 0xD5, 0xDF, 0xA3, 0x5B, 0xDB, 0x9B, 0xBE, 0x99, 0x23, 0x40, 0x00, 0xB8, 0xD8, 0xF3,
+    0x89, 0xE8, 0x76, 0xC2, 0x02, 0x78, 0xDD, 0xF7, 0xA8, 0xD7, 0x59, 0x01, 0xE0, 0x12, 0x6D, 0xFF,
+    0xDE, 0xF6, 0xEF, 0xAE, 0x04, 0x00, 0xD7, 0xF2, 0x04, 0x04, 0x80, 0x97, 0xD8, 0xDA, 0x3E, 0xB8,
+    0x0C, 0x00, 0x08, 0x10, 0x00, 0x56, 0xD8, 0x93, 0x78, 0x05, 0x0B, 0x00, 0x01, 0x02, 0xC0, 0xF1,
+    0x92, 0x3C, 0xCD, 0xCC, 0xB4, 0xBD, 0x73, 0x35, 0x00, 0x10, 0x20, 0x00, 0x1C, 0xAE, 0xAD, 0x03,
+    0x09, 0x01, 0x10, 0x20, 0x00, 0xAC, 0x91, 0xE4, 0x71, 0x66, 0x9C, 0x07, 0x02, 0x80, 0x00, 0x01,
+    0x60, 0x09, 0x5B, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x1B, 0x6B, 0xFB, 0xB9, 0xED, 0x17, 0x57, 0x02, 0x00, 0x00, 0x7E,
+    0x6F, 0x1F, 0x7E, 0x92, 0x7F, 0xC7, 0x3E, 0x33, 0x7F, 0xF8, 0x38, 0x00, 0x00, 0x40, 0x80, 0x1C,
+    0x2E, 0xC9, 0x49, 0x80, 0x00, 0x00, 0x80, 0x00, 0x59, 0xA6, 0xED, 0xD6, 0xF6, 0x93, 0x8F, 0x04,
+    0x00, 0x00, 0x04, 0xC8, 0xE1, 0x92, 0x78, 0x0D, 0x0B, 0x00, 0x00, 0x04, 0xC8, 0x32, 0xE7, 0x99,
+    0xB9, 0xF7, 0x91, 0x00, 0x00, 0x80, 0x00, 0x59, 0x61, 0x6F, 0xEB, 0x09, 0x08, 0x00, 0x00, 0x08,
+    0x90, 0xE3, 0x25, 0xD9, 0x92, 0x58, 0x03, 0x02, 0x00, 0x00, 0x02, 0x64, 0x99, 0xBD, 0xED, 0x47,
+    0x1F, 0x0B, 0x00, 0x00, 0x08, 0x90, 0x25, 0x01, 0x32, 0x16, 0xA2, 0x03, 0x00, 0x80, 0x00, 0x59,
+    0xC4, 0x79, 0x20, 0x00, 0x00, 0x20, 0x40, 0x96, 0xB1, 0x10, 0x1D, 0x00, 0x00, 0x04, 0xC8, 0x1A,
+    0x16, 0xA2, 0x03, 0x00, 0x80, 0x00, 0x59, 0xCD, 0x42, 0x74, 0x00, 0x00, 0x10, 0x20, 0xEB, 0x02,
+    0x64, 0xAC, 0x03, 0x01, 0x00, 0x00, 0x01, 0xB2, 0x88, 0x85, 0xE8, 0x00, 0x00, 0x20, 0x40, 0x96,
+    0xB1, 0x10, 0x1D, 0x00, 0x00, 0x04, 0xC8, 0x1A, 0x16, 0xA2, 0x03, 0x00, 0x80, 0x00, 0x59, 0xAA,
+    0xED, 0xB9, 0xED, 0xBD, 0x8F, 0x07, 0x00, 0x00, 0x04, 0xC8, 0xE1, 0x92, 0xEC, 0x33, 0x63, 0x27,
+    0x2C, 0x00, 0x00, 0x10, 0x20, 0x4B, 0xD8, 0x09, 0x0B, 0x00, 0x00, 0x04, 0xC8, 0x32, 0x5B, 0xDB,
+    0x07, 0x1F, 0x0F, 0x00, 0x00, 0x08, 0x90, 0x15, 0xF6, 0x24, 0x5E, 0xC1, 0x02, 0x00, 0x00, 0x01,
+    0x72, 0xBC, 0x24, 0x4F, 0x6D, 0x9F, 0x2C, 0x44, 0x07, 0x00, 0x00, 0x01, 0xB2, 0x2A, 0x42, 0x2C,
+    0x44, 0x07, 0x00, 0x00, 0x01, 0xB2, 0x8C, 0x85, 0xE8, 0x00, 0x00, 0x20, 0x40, 0x96, 0xB1, 0x10,
+    0x1D, 0x00, 0x00, 0x04, 0xC8, 0x32, 0x16, 0xA2, 0x03, 0x00, 0x80, 0x00, 0x59, 0x23, 0xC9, 0xD3,
+    0xCC, 0x4C, 0xDB, 0x3B, 0x1F, 0x13, 0x00, 0x00, 0x08, 0x90, 0xC3, 0xB5, 0x3D, 0x8D, 0x75, 0x20,
+    0x00, 0x00, 0xDF, 0xFB, 0xBD, 0xF4, 0xB9, 0xED, 0x17, 0x57, 0x02, 0x01, 0xF2, 0x06, 0x92, 0x3C,
+    0xCE, 0xCC, 0x27, 0x1F, 0x13, 0x86, 0x01, 0x00, 0x7C, 0x93, 0x8D, 0x7B, 0x10, 0x20, 0xFE, 0x43,
+    0x81, 0xBF, 0x5D, 0x00, 0xD6, 0x48, 0xE2, 0x8D, 0x11, 0x04, 0xC8, 0x1B, 0x3A, 0xB5, 0xF5, 0x1F,
+    0x0A, 0xC3, 0x00, 0x00, 0xBE, 0x6F, 0x6F, 0x6B, 0xF3, 0x1E, 0x04, 0xC8, 0x1B, 0xFC, 0x88, 0x3B,
+    0x27, 0xB9, 0xB3, 0x10, 0x1D, 0xC3, 0x00, 0x00, 0xBE, 0x3F, 0x73, 0xC6, 0x8D, 0x2F, 0x04, 0xC8,
+    0xDB, 0xB0, 0x10, 0x1D, 0xC3, 0x00, 0x00, 0x7E, 0xC8, 0xEF, 0x25, 0x04, 0xC8, 0x5B, 0xB1, 0x10,
+    0x1D, 0xC3, 0x00, 0x00, 0x7E, 0x68, 0xF7, 0xDA, 0x3A, 0x02, 0xE4, 0x0D, 0xFF, 0x43, 0xF9, 0x11,
+    0x87, 0x61, 0x00, 0x00, 0xDF, 0x96, 0x64, 0x4B, 0xE2, 0x86, 0x2D, 0x02, 0xE4, 0x8D, 0x58, 0x88,
+    0x8E, 0x61, 0x00, 0x00, 0x3F, 0xD0, 0xF6, 0xDC, 0xF6, 0xDE, 0x95, 0x40, 0x80, 0xBC, 0xFE, 0x47,
+    0x9C, 0x85, 0xE8, 0x18, 0x06, 0x00, 0xF0, 0xE3, 0xDF, 0x4C, 0xFB, 0xCC, 0xD8, 0xFC, 0x04, 0x01,
+    0xF2, 0x46, 0x3F, 0xE2, 0xBC, 0x4B, 0x8F, 0x61, 0x00, 0x00, 0xDF, 0xE7, 0xB5, 0x75, 0x04, 0xC8,
+    0x1B, 0xFE, 0x88, 0xB3, 0x10, 0x1D, 0xC3, 0x00, 0x00, 0xBE, 0x6F, 0x6B, 0xFB, 0xE0, 0x32, 0x20,
+    0x40, 0xDE, 0xC6, 0x79, 0x66, 0xBC, 0xC6, 0x82, 0x61, 0x00, 0x00, 0xDF, 0xB6, 0x27, 0xF1, 0xD4,
+    0x1D, 0x01, 0xF2, 0x56, 0xFF, 0xA1, 0xC6, 0x5D, 0x64, 0x0C, 0x03, 0x00, 0xF8, 0xA6, 0x24, 0x4F,
+    0x33, 0x33, 0xD6, 0xCD, 0x22, 0x40, 0xDE, 0xE6, 0x3F, 0x94, 0x35, 0x20, 0x18, 0x06, 0x00, 0xF0,
+    0x03, 0xD6, 0xCD, 0x22, 0x40, 0xDE, 0xF6, 0x3F, 0xD4, 0xD6, 0xD6, 0x3A, 0x10, 0x0C, 0x03, 0x00,
+    0xF8, 0x06, 0xEB, 0x66, 0x11, 0x20, 0x6F, 0xFB, 0x1F, 0xCA, 0x6B, 0x58, 0x18, 0x06, 0x00, 0xF0,
+    0x7D, 0x7E, 0x2F, 0xF1, 0xD3, 0xFB, 0x8F, 0x5F, 0xE8, 0x47, 0xDC, 0xFF, 0xFA, 0xB8, 0xF8, 0x85,
+    0x87, 0xC1, 0x7F, 0xBA, 0x0C, 0x00, 0x2C, 0xE0, 0x00, 0x67, 0x7E, 0x7A, 0x1F, 0x5C, 0x02, 0x30,
+    0x0C, 0x00, 0xF8, 0x3D, 0x3C, 0x1F, 0xE0, 0x6C, 0xE7, 0x50, 0x04, 0x08, 0x18, 0x06, 0x86, 0x01,
+    0x00, 0x6B, 0x58, 0x37, 0x8B, 0x00, 0x01, 0x0C, 0x03, 0x00, 0x96, 0xB1, 0x6E, 0x16, 0x01, 0x02,
+    0x18, 0x06, 0x00, 0xAC, 0xB4, 0xCF, 0x8C, 0x33, 0xA8, 0x10, 0x20, 0x60, 0x18, 0x18, 0x06, 0x00,
+    0x2C, 0x9B, 0x39, 0x6E, 0x7A, 0x21, 0x40, 0xC0, 0x30, 0x30, 0x0C, 0x00, 0x38, 0x9E, 0x03, 0x9C,
+    0x11, 0x20, 0x80, 0x61, 0x00, 0xC0, 0x6A, 0x7B, 0x5B, 0x4F, 0xDE, 0x11, 0x20, 0x60, 0x18, 0x18,
+    0x06, 0x00, 0xAC, 0x99, 0x39, 0xE3, 0xC6, 0x17, 0x02, 0x04, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0x45,
+    0x3C, 0x79, 0x47, 0x80, 0x00, 0x86, 0x01, 0x00, 0xCB, 0xEC, 0x0E, 0xC1, 0x45, 0x80, 0x00, 0x86,
+    0x01, 0x00, 0x4B, 0x24, 0xD9, 0x92, 0x38, 0x7F, 0x0A, 0x01, 0x02, 0x86, 0x81, 0x61, 0x00, 0xC0,
+    0x1A, 0x6D, 0xCF, 0x6D, 0xEF, 0x5D, 0x09, 0x04, 0x08, 0x18, 0x06, 0x86, 0x01, 0x00, 0x87, 0x7B,
+    0x3E, 0x04, 0xD7, 0xE6, 0x27, 0x08, 0x10, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0x96, 0xB0, 0xF9, 0x09,
+    0x02, 0x04, 0x30, 0x0C, 0x00, 0x58, 0x66, 0x6B, 0xFB, 0xE0, 0x32, 0x20, 0x40, 0xC0, 0x30, 0x30,
+    0x0C, 0x00, 0x58, 0x61, 0x4F, 0xE2, 0xA9, 0x3B, 0x02, 0x04, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0xE3,
+    0x25, 0x79, 0x9A, 0x99, 0x69, 0x7B, 0xE7, 0x6A, 0x20, 0x40, 0xC0, 0x30, 0x30, 0x0C, 0x00, 0x38,
+    0x5C, 0x5B, 0x67, 0x50, 0x21, 0x40, 0xC0, 0x30, 0x30, 0x0C, 0x00, 0x58, 0x23, 0xC9, 0xE3, 0xCC,
+    0xD8, 0x02, 0x1E, 0x01, 0x02, 0x86, 0x81, 0x61, 0x00, 0xC0, 0x12, 0x36, 0x3F, 0x41, 0x80, 0x00,
+    0x86, 0x01, 0x00, 0xCB, 0x9C, 0xDA, 0x9A, 0x39, 0x08, 0x10, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0x8E,
+    0x97, 0xE4, 0x9C, 0xC4, 0x01, 0xB8, 0x08, 0x10, 0x30, 0x0C, 0x0C, 0x03, 0x00, 0xD6, 0x68, 0xBB,
+    0xB5, 0xF5, 0xEA, 0x2F, 0x02, 0x04, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0xE3, 0x25, 0xF1, 0xEA, 0x2F,
+    0x02, 0x04, 0x0C, 0x03, 0xC3, 0x00, 0x80, 0x65, 0xF6, 0x99, 0x71, 0x06, 0x15, 0x02, 0x04, 0x0C,
+    0x03, 0xC3, 0x00, 0x80, 0x65, 0x33, 0xC7, 0x4D, 0x2F, 0x04, 0x08, 0x18, 0x06, 0x86, 0x01, 0x00,
+    0xC7, 0x4B, 0xE2, 0xFC, 0x29, 0x04, 0x08, 0x18, 0x06, 0x86, 0x01, 0x00, 0x4B, 0xED, 0x6D, 0x3D,
+    0x79, 0x47, 0x80, 0x80, 0x61, 0x60, 0x18, 0x00, 0xB0, 0x66, 0xE6, 0x8C, 0x1B, 0x5F, 0x08, 0x10,
+    0x30, 0x0C, 0x0C, 0x03, 0x00, 0x16, 0xF1, 0xE4, 0x1D, 0x01, 0x02, 0x18, 0x06, 0x00, 0x2C, 0xB3,
+    0x3B, 0x04, 0x17, 0x01, 0x02, 0x18, 0x06, 0x00, 0x2C, 0x91, 0x64, 0x4B, 0xE2, 0xFC, 0x29, 0x04,
+    0x08, 0x18, 0x06, 0x86, 0x01, 0x00, 0x6B, 0xB4, 0x3D, 0xB7, 0xBD, 0x77, 0x25, 0x10, 0x20, 0x60,
+    0x18, 0x18, 0x06, 0x00, 0x1C, 0xEE, 0xF9, 0x10, 0x5C, 0x9B, 0x9F, 0x20, 0x40, 0xC0, 0x30, 0x30,
+    0x0C, 0x00, 0x58, 0xC2, 0xE6, 0x27, 0x08, 0x10, 0xC0, 0x30, 0x00, 0x60, 0x99, 0xAD, 0xED, 0x83,
+    0xCB, 0x80, 0x00, 0x01, 0xC3, 0xC0, 0x30, 0x00, 0x60, 0x85, 0x3D, 0x89, 0xA7, 0xEE, 0x08, 0x10,
+    0x30, 0x0C, 0x0C, 0x03, 0x00, 0x8E, 0x97, 0xE4, 0x69, 0x66, 0xA6, 0xED, 0x9D, 0xAB, 0x81, 0x00,
+    0x01, 0xC3, 0xC0, 0x30, 0x00, 0xE0, 0x70, 0x6D, 0x9D, 0x41, 0x85, 0x00, 0x01, 0xC3, 0xC0, 0x30,
+    0x00, 0x60, 0x8D, 0x24, 0x8F, 0x33, 0x63, 0x0B, 0x78, 0x04, 0x08, 0x18, 0x06, 0x86, 0x01, 0x00,
+    0x4B, 0xD8, 0xFC, 0x04, 0x01, 0x02, 0x18, 0x06, 0x00, 0x2C, 0x73, 0x6A, 0x6B, 0xE6, 0x20, 0x40,
+    0xC0, 0x30, 0x30, 0x0C, 0x00, 0x38, 0x5E, 0x92, 0x73, 0x12, 0x07, 0xE0, 0x22, 0x40, 0xC0, 0x30,
+    0x30, 0x0C, 0x00, 0x58, 0xA3, 0xED, 0xD6, 0xD6, 0xAB, 0xBF, 0x08, 0x10, 0x30, 0x0C, 0x0C, 0x03,
+    0x00, 0x8E, 0x97, 0xC4, 0xAB, 0xBF, 0x00, 0x02, 0xA4, 0xFF, 0x68, 0xFB, 0x37, 0x57, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x89, 0xB6, 0x9F,
+    0xDB, 0x7E, 0x71, 0x25, 0x00, 0xF8, 0x9D, 0x7D, 0x70, 0x09, 0x00, 0x7E, 0x1A, 0xFB, 0xCC, 0xFC,
+    0xE1, 0x32, 0x00, 0x20, 0x40, 0x00, 0x38, 0x5C, 0x92, 0x93, 0x00, 0x01, 0x40, 0x80, 0x00, 0xB0,
+    0xD2, 0xDE, 0xF6, 0xA3, 0xCB, 0x00, 0x80, 0x00, 0x01, 0x60, 0x49, 0x80, 0x8C, 0xA7, 0x20, 0x00,
+    0x08, 0x10, 0x00, 0x16, 0xF1, 0x1A, 0x16, 0x00, 0x02, 0x04, 0x80, 0x65, 0xF6, 0xB6, 0x02, 0x04,
+    0x00, 0x01, 0x02, 0xC0, 0xF1, 0x92, 0x6C, 0x49, 0x3E, 0xB9, 0x12, 0x00, 0x08, 0x10, 0x00, 0x96,
+    0x68, 0x7B, 0x6E, 0x7B, 0xEF, 0x4A, 0x00, 0x20, 0x40, 0x00, 0x38, 0x5C, 0x92, 0x7D, 0x66, 0xEC,
+    0x84, 0x05, 0x80, 0x00, 0x01, 0x60, 0x09, 0x3B, 0x61, 0x01, 0x20, 0x40, 0x00, 0x58, 0x66, 0x6B,
+    0xFB, 0xE0, 0x32, 0x00, 0x20, 0x40, 0x00, 0x58, 0x61, 0x4F, 0xE2, 0x15, 0x2C, 0x00, 0x04, 0x08,
+    0x00, 0xC7, 0x4B, 0xF2, 0x34, 0x33, 0xD3, 0xF6, 0xCE, 0xD5, 0x00, 0x40, 0x80, 0x00, 0x70, 0xB8,
+    0xB6, 0x0E, 0x24, 0x04, 0x40, 0x80, 0x00, 0xB0, 0x46, 0x92, 0xC7, 0x99, 0x71, 0x1E, 0x08, 0x00,
+    0x02, 0x04, 0x80, 0x25, 0xEC, 0x84, 0x05, 0x80, 0x00, 0x01, 0x60, 0x99, 0x53, 0x5B, 0x01, 0x02,
+    0x80, 0x00, 0x01, 0xE0, 0x78, 0x49, 0xCE, 0x49, 0x9C, 0x86, 0x0E, 0x80, 0x00, 0x01, 0x60, 0x8D,
+    0xB6, 0x5B, 0x5B, 0xEB, 0x40, 0x00, 0x10, 0x20, 0x00, 0x1C, 0x2F, 0x89, 0x75, 0x20, 0x00, 0x08,
+    0x10, 0x00, 0x96, 0xD9, 0x67, 0xC6, 0x81, 0x84, 0x00, 0x08, 0x10, 0x00, 0x96, 0x05, 0x88, 0x27,
+    0x20, 0x00, 0x08, 0x10, 0x00, 0x8E, 0x97, 0xC4, 0x61, 0x84, 0x00, 0x08, 0x10, 0x00, 0x96, 0xDA,
+    0xDB, 0x7A, 0x0D, 0x0B, 0x00, 0x01, 0x02, 0xC0, 0x9A, 0x00, 0x19, 0x4F, 0x41, 0x00, 0x10, 0x20,
+    0x00, 0x2C, 0xE2, 0x35, 0x2C, 0x00, 0x04, 0x08, 0x00, 0xCB, 0xEC, 0x4E, 0x44, 0x07, 0x40, 0x80,
+    0x00, 0xB0, 0x44, 0x92, 0x2D, 0x89, 0xC3, 0x08, 0x01, 0x10, 0x20, 0x00, 0xAC, 0xD1, 0xF6, 0xDC,
+    0xF6, 0xDE, 0x95, 0x00, 0x40, 0x80, 0x00, 0x70, 0xB8, 0xE7, 0x13, 0xD1, 0xED, 0x84, 0x05, 0x80,
+    0x00, 0x01, 0x60, 0x09, 0x3B, 0x61, 0x01, 0x20, 0x40, 0x00, 0x58, 0x66, 0x6B, 0xFB, 0xE0, 0x32,
+    0x00, 0x20, 0x40, 0x00, 0x58, 0x61, 0x4F, 0xE2, 0x15, 0x2C, 0x00, 0x04, 0x08, 0x00, 0xC7, 0x4B,
+    0xF2, 0x34, 0x33, 0xD3, 0xF6, 0xCE, 0xD5, 0x00, 0x40, 0x80, 0x00, 0x70, 0xB8, 0xB6, 0x0E, 0x24,
+    0x04, 0x40, 0x80, 0x00, 0xB0, 0x46, 0x92, 0xC7, 0x99, 0x71, 0x1E, 0x08, 0x00, 0x02, 0x04, 0x80,
+    0x25, 0xEC, 0x84, 0x05, 0x80, 0x00, 0x01, 0x60, 0x99, 0x53, 0x5B, 0x01, 0x02, 0x80, 0x00, 0x39,
+    0x4A, 0xDB, 0xCF, 0x6D, 0xBF, 0xF8, 0x88, 0x00, 0x66, 0x92, 0x9C, 0x93, 0x38, 0x0D, 0x1D, 0x00,
+    0x01, 0x72, 0x20, 0xAF, 0x1B, 0x00, 0xFC, 0x93, 0xB6, 0x5B, 0x5B, 0xEB, 0x40, 0x00, 0x10, 0x20,
+    0x47, 0x48, 0x62, 0xC7, 0x17, 0x80, 0x7F, 0xFD, 0x5E, 0x74, 0x63, 0x06, 0x00, 0x01, 0x72, 0xB0,
+    0xBD, 0xAD, 0xC3, 0xB7, 0x00, 0x9E, 0xBF, 0x13, 0x67, 0xC6, 0x77, 0x22, 0x00, 0x02, 0xE4, 0xE0,
+    0x61, 0xEB, 0x6E, 0x1F, 0x80, 0xEF, 0x44, 0x00, 0x04, 0xC8, 0x12, 0x5E, 0xC3, 0x02, 0x78, 0xE6,
+    0xD5, 0x54, 0x00, 0x04, 0xC8, 0xF1, 0x76, 0xDB, 0x4E, 0x02, 0xFC, 0xDB, 0xF7, 0xA2, 0xD7, 0xB0,
+    0x00, 0x10, 0x20, 0x47, 0x48, 0xB2, 0x25, 0xB1, 0xE3, 0x0B, 0xC0, 0x3F, 0x05, 0xC8, 0x78, 0x0A,
+    0x02, 0x80, 0x00, 0x39, 0x4E, 0xDB, 0x73, 0x5B, 0x7B, 0xDF, 0x03, 0x7C, 0xE5, 0x35, 0x2C, 0x00,
+    0x04, 0xC8, 0x91, 0x9E, 0xB7, 0x9D, 0xF4, 0xBA, 0x01, 0xC0, 0x57, 0x5E, 0x4D, 0x05, 0x40, 0x80,
+    0x1C, 0x3D, 0x6C, 0xC7, 0xDD, 0x3E, 0x80, 0x99, 0xF1, 0x6A, 0x2A, 0x00, 0x02, 0x64, 0x85, 0xAD,
+    0xED, 0x83, 0x8F, 0x0A, 0xE0, 0x2B, 0xAF, 0xA6, 0x02, 0x20, 0x40, 0x8E, 0xB5, 0x27, 0xF1, 0x0A,
+    0x16, 0xC0, 0x33, 0xAF, 0xA6, 0x02, 0x20, 0x40, 0x8E, 0x1D, 0xB4, 0x4F, 0x33, 0x33, 0x6D, 0xEF,
+    0x7C, 0x5C, 0x00, 0x33, 0xE3, 0xD5, 0x54, 0x00, 0x04, 0xC8, 0xB1, 0xDA, 0xDA, 0xF5, 0x05, 0xE0,
+    0x2F, 0x5E, 0x4D, 0x05, 0x40, 0x80, 0x1C, 0x29, 0xC9, 0xE3, 0xCC, 0x58, 0x74, 0x09, 0xF0, 0x95,
+    0x57, 0x53, 0x01, 0x10, 0x20, 0x47, 0x0F, 0xDB, 0xF1, 0x04, 0x04, 0x60, 0x66, 0xBC, 0x9A, 0x0A,
+    0x80, 0x00, 0x59, 0xE1, 0x64, 0xDF, 0x7B, 0x80, 0xBF, 0x78, 0x35, 0x15, 0x00, 0x01, 0x72, 0xA0,
+    0x24, 0xE7, 0x24, 0xB6, 0x9C, 0x04, 0xF8, 0xEB, 0x7B, 0xD1, 0xAB, 0xA9, 0x00, 0x08, 0x90, 0x23,
+    0xB5, 0xDD, 0xDA, 0x1A, 0xB6, 0x00, 0x5F, 0x79, 0x35, 0x15, 0x00, 0x01, 0x72, 0xA4, 0xE7, 0x7D,
+    0xEF, 0x0D, 0x5B, 0x80, 0xAF, 0xBC, 0x9A, 0x0A, 0x80, 0x00, 0x39, 0x98, 0x83, 0xB7, 0x00, 0x9E,
+    0x79, 0x35, 0x15, 0x00, 0x01, 0xB2, 0x26, 0x40, 0xDC, 0xED, 0x03, 0x78, 0xE6, 0xD5, 0x54, 0x00,
+    0x04, 0xC8, 0x81, 0x92, 0xD8, 0xF1, 0x05, 0xE0, 0x5F, 0xBF, 0x17, 0xDD, 0x98, 0x01, 0x80, 0x23,
+    0xB5, 0xFD, 0xAF, 0xB6, 0x5E, 0xC3, 0x02, 0x00, 0x80, 0x5F, 0xD4, 0x87, 0x5F, 0xEC, 0xDF, 0xEB,
+    0x6E, 0x1F, 0x00, 0x00, 0x08, 0x90, 0x65, 0xBC, 0x86, 0x05, 0x00, 0x00, 0x02, 0x64, 0x99, 0xDD,
+    0xB6, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x3B, 0x6B, 0x7B, 0xFF, 0xE7, 0x9F, 0x7F, 0xFE, 0xB7, 0x2B, 0x01, 0x00,
+    0x00, 0xBF, 0x96, 0x0F, 0xBF, 0xE2, 0x3F, 0x3A, 0xC9, 0x39, 0xC9, 0xBD, 0x8F, 0x0F, 0x00, 0x00,
+    0x04, 0xC8, 0x12, 0x6D, 0xB7, 0xB6, 0x9F, 0x7C, 0x84, 0x00, 0x00, 0x20, 0x40, 0x0E, 0x97, 0x64,
+    0x9F, 0x99, 0x3F, 0x7C, 0x84, 0x00, 0x00, 0x20, 0x40, 0x56, 0xD8, 0x67, 0xE6, 0xA3, 0x8F, 0x10,
+    0x00, 0x00, 0x04, 0xC8, 0xAA, 0x00, 0xF1, 0x04, 0x04, 0x00, 0x00, 0x04, 0xC8, 0xF1, 0x92, 0x9C,
+    0x04, 0x08, 0x00, 0x00, 0x08, 0x90, 0x95, 0xF6, 0xB6, 0x5E, 0xC3, 0x02, 0x00, 0x00, 0x01, 0xB2,
+    0x26, 0x40, 0xC6, 0x53, 0x10, 0x00, 0x00, 0x10, 0x20, 0x8B, 0x78, 0x0D, 0x0B, 0x00, 0x00, 0x04,
+    0xC8, 0x32, 0x7B, 0x5B, 0x01, 0x02, 0x00, 0x00, 0x02, 0xE4, 0x78, 0x49, 0xB6, 0x24, 0x0E, 0x23,
+    0x04, 0x00, 0x00, 0x01, 0xB2, 0x46, 0xDB, 0x73, 0xDB, 0x7B, 0x1F, 0x25, 0x00, 0x00, 0x08, 0x90,
+    0xC3, 0x3D, 0x9F, 0x88, 0x6E, 0x27, 0x2C, 0x00, 0x00, 0x10, 0x20, 0x4B, 0xD8, 0x09, 0x0B, 0x00,
+    0x00, 0x04, 0xC8, 0x32, 0x5B, 0xDB, 0x07, 0x1F, 0x25, 0x00, 0x00, 0x08, 0x90, 0x15, 0xF6, 0x24,
+    0x5E, 0xC1, 0x02, 0x00, 0x00, 0x01, 0x72, 0xBC, 0x24, 0x4F, 0x33, 0x33, 0x6D, 0xEF, 0x7C, 0x9C,
+    0x00, 0x00, 0x20, 0x40, 0x0E, 0xD7, 0xD6, 0x81, 0x84, 0x00, 0x00, 0x20, 0x40, 0xD6, 0x48, 0xF2,
+    0x38, 0x33, 0xCE, 0x03, 0x01, 0x00, 0x00, 0x01, 0xB2, 0x84, 0x9D, 0xB0, 0x00, 0x00, 0x40, 0x80,
+    0x2C, 0x73, 0x6A, 0x2B, 0x40, 0x00, 0x00, 0x40, 0x80, 0x1C, 0x2F, 0xC9, 0x39, 0x89, 0xD3, 0xD0,
+    0x01, 0x00, 0x40, 0x80, 0xAC, 0xD1, 0x76, 0x6B, 0x6B, 0x1D, 0x08, 0x00, 0x00, 0x08, 0x90, 0xE3,
+    0x25, 0xB1, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3D, 0xB5, 0xBD, 0x6B, 0xFB, 0x3F, 0xAE,
+    0x04, 0x5C, 0xEE, 0x83, 0x4B, 0x00, 0x00, 0x70, 0x1D, 0x07, 0x22, 0x83, 0x00, 0x01, 0x00, 0x58,
+    0xCA, 0x81, 0xC8, 0x20, 0x40, 0x00, 0x00, 0x96, 0x71, 0x20, 0x32, 0x08, 0x10, 0x00, 0x80, 0x95,
+    0x6C, 0x84, 0x03, 0x02, 0x04, 0x00, 0x60, 0x19, 0x07, 0x22, 0x83, 0x00, 0x01, 0x00, 0x58, 0xC3,
+    0x81, 0xC8, 0x20, 0x40, 0x00, 0x00, 0x96, 0x72, 0x20, 0x32, 0x08, 0x10, 0x00, 0x80, 0x65, 0x1C,
+    0x88, 0x0C, 0x02, 0x04, 0x00, 0x60, 0xA5, 0x7D, 0x66, 0x3E, 0xBA, 0x0C, 0x20, 0x40, 0x00, 0x00,
+    0x56, 0x05, 0x88, 0x27, 0x20, 0x20, 0x40, 0x00, 0x00, 0x8E, 0x97, 0xC4, 0x61, 0x84, 0x20, 0x40,
+    0x00, 0x00, 0x96, 0xDA, 0xDB, 0x7A, 0x0D, 0x0B, 0x04, 0x08, 0x00, 0xC0, 0x9A, 0x00, 0x19, 0x4F,
+    0x41, 0x40, 0x80, 0x00, 0x00, 0x2C, 0xE2, 0x35, 0x2C, 0x10, 0x20, 0x00, 0x00, 0xCB, 0xEC, 0x4E,
+    0x44, 0x07, 0x01, 0x02, 0x00, 0xB0, 0x44, 0x92, 0x2D, 0x89, 0xC3, 0x08, 0x41, 0x80, 0x00, 0x00,
+    0xAC, 0xD1, 0xF6, 0xDC, 0xF6, 0xDE, 0x95, 0x00, 0x01, 0x02, 0x00, 0x70, 0xB8, 0xE7, 0x13, 0xD1,
+    0xED, 0x84, 0x05, 0x02, 0x04, 0x00, 0x60, 0x09, 0x3B, 0x61, 0x81, 0x00, 0x01, 0x00, 0x58, 0x66,
+    0x6B, 0xFB, 0xE0, 0x32, 0x80, 0x00, 0x01, 0x00, 0x58, 0x61, 0x4F, 0xE2, 0x15, 0x2C, 0x10, 0x20,
+    0x00, 0x00, 0xC7, 0x4B, 0xF2, 0x34, 0x33, 0xD3, 0xF6, 0xCE, 0xD5, 0x00, 0x01, 0x02, 0x00, 0x70,
+    0xB8, 0xB6, 0x0E, 0x24, 0x04, 0x01, 0x02, 0x00, 0xB0, 0x46, 0x92, 0xC7, 0x99, 0x71, 0x1E, 0x08,
+    0x08, 0x10, 0x00, 0x80, 0x25, 0xEC, 0x84, 0x05, 0x02, 0x04, 0x00, 0x60, 0x99, 0x53, 0x5B, 0x01,
+    0x02, 0x02, 0x04, 0x00, 0xE0, 0x78, 0x49, 0xCE, 0x49, 0x9C, 0x86, 0x0E, 0x02, 0x04, 0x00, 0x60,
+    0x8D, 0xB6, 0x5B, 0x5B, 0xEB, 0x40, 0x40, 0x80, 0x00, 0x00, 0x1C, 0x2F, 0x89, 0x75, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE6, 0xFF, 0x00, 0xA9, 0x85, 0xBB, 0x5D,
+    0x42, 0x50, 0x24, 0x98, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+};
+unsigned int rain_tile_mid_len = sizeof(rain_tile_mid);
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef RAIN_TILE_NEAR_H
+#define RAIN_TILE_NEAR_H
+
+unsigned char rain_tile_near[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x02, 0x58, 0x08, 0x06, 0x00, 0x00, 0x00, 0x9A, 0x76, 0x82,
+    0x70, 0x00, 0x00, 0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61,
+    0x05, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 0x44, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xA0,
+    0xBD, 0xA7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00,
+    0x00, 0x0B, 0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45,
+    0x07, 0xDE, 0x03, 0x08, 0x16, 0x31, 0x35, 0xEE, 0xB1, 0x99, 0x93, 0x00, 0x00, 0x11, 0xFA, 0x49,
+    0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0xDD, 0xE1, 0x71, 0x23, 0xC7, 0x11, 0x86, 0xE1, 0xE9, 0x4B,
+    0x80, 0x21, 0x40, 0x19, 0x40, 0x19, 0x00, 0x99, 0x5C, 0x08, 0x0E, 0xC5, 0x21, 0x5C, 0x28, 0xB7,
+    0x19, 0x1C, 0x32, 0x20, 0x32, 0x80, 0x99, 0xC0, 0x7C, 0xFE, 0x21, 0xD3, 0x96, 0x4B, 0xA7, 0x93,
+    0x2C, 0x63, 0x1B, 0xE0, 0xEE, 0xF3, 0x04, 0x20, 0x97, 0xBB, 0x58, 0xD7, 0x78, 0x39, 0x33, 0xC4,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8F, 0x93, 0xE4, 0x73, 0x92, 0x2F, 0x26, 0x01, 0x00, 0xC0, 0x27, 0x23, 0xA0, 0xC1, 0x65, 0x8C,
+    0xF1, 0xB3, 0x31, 0x00, 0x00, 0x00, 0x2D, 0x92, 0xC4, 0x14, 0x00, 0x00, 0x70, 0x02, 0x42, 0x57,
+    0x80, 0x2C, 0x49, 0x4E, 0x26, 0x01, 0x00, 0x20, 0x40, 0x60, 0x75, 0x55, 0xE5, 0x1A, 0x16, 0x00,
+    0x00, 0x02, 0x84, 0x36, 0xD7, 0x31, 0xC6, 0x4F, 0xC6, 0x00, 0x00, 0x20, 0x40, 0xA0, 0xC3, 0x25,
+    0x89, 0x13, 0x10, 0x00, 0x00, 0xA0, 0x87, 0x87, 0xE8, 0x00, 0x00, 0x38, 0x01, 0xA1, 0xD3, 0x25,
+    0xC9, 0xD1, 0x18, 0x00, 0x00, 0x04, 0x08, 0xB4, 0x04, 0xC8, 0xF0, 0x10, 0x1D, 0x00, 0x40, 0x80,
+    0x80, 0x00, 0x01, 0x00, 0x40, 0x80, 0xB0, 0xB9, 0x00, 0xF1, 0x10, 0x1D, 0x00, 0x00, 0x68, 0xE3,
+    0x21, 0x3A, 0x00, 0xC0, 0xBE, 0x39, 0x01, 0xA1, 0x9B, 0x87, 0xE8, 0x00, 0x00, 0x02, 0x04, 0xFA,
+    0x02, 0x64, 0x78, 0x07, 0x02, 0x00, 0x20, 0x40, 0x40, 0x80, 0x00, 0x00, 0x20, 0x40, 0xD8, 0x5C,
+    0x80, 0x78, 0x88, 0x0E, 0x00, 0x00, 0xB4, 0xF1, 0x10, 0x1D, 0x00, 0x60, 0xBF, 0x9C, 0x80, 0xF0,
+    0x88, 0x00, 0xB9, 0x26, 0x39, 0x98, 0x04, 0x00, 0x80, 0x00, 0x81, 0xD5, 0x55, 0x95, 0x77, 0x20,
+    0x00, 0x00, 0x02, 0x04, 0xDA, 0x08, 0x10, 0x00, 0x80, 0x07, 0x4B, 0xF2, 0x39, 0xC9, 0x17, 0x01,
+    0xC2, 0x1E, 0x2C, 0x49, 0xCE, 0xC6, 0x00, 0x00, 0xF0, 0x50, 0x7E, 0x29, 0xCC, 0x6E, 0x6A, 0xFB,
+    0x25, 0xC9, 0xCD, 0x24, 0x00, 0x00, 0x1E, 0xFE, 0xB9, 0xAC, 0xFD, 0x8F, 0x03, 0x39, 0x01, 0xA1,
+    0x5D, 0x55, 0xBD, 0x25, 0xF9, 0x87, 0x87, 0xE8, 0x00, 0x00, 0x0F, 0x77, 0x49, 0x72, 0x14, 0x20,
+    0xEC, 0x21, 0x42, 0x1C, 0xF9, 0x01, 0x00, 0x3C, 0x41, 0x80, 0x74, 0x7F, 0x26, 0x13, 0x20, 0xEC,
+    0xE6, 0x87, 0x1D, 0x00, 0x00, 0x01, 0xC2, 0x7E, 0x79, 0x88, 0x0E, 0x00, 0xF0, 0x04, 0x01, 0x92,
+    0xC4, 0x2F, 0x85, 0xD9, 0x3E, 0x0F, 0xD1, 0x01, 0x00, 0x9E, 0xE6, 0x73, 0x59, 0xEB, 0x43, 0x74,
+    0x27, 0x20, 0x3C, 0x44, 0x55, 0xBD, 0xBD, 0x87, 0x88, 0x69, 0x00, 0x00, 0x3C, 0x34, 0x40, 0xAE,
+    0x9D, 0x7F, 0x1C, 0x48, 0x80, 0xF0, 0xC8, 0x1F, 0x76, 0xEF, 0x40, 0x00, 0x00, 0x1E, 0xAC, 0xFB,
+    0x8F, 0x03, 0x09, 0x10, 0x1E, 0xF9, 0xC3, 0xBE, 0x8C, 0x31, 0xCE, 0x26, 0x01, 0x00, 0xF0, 0x50,
+    0x02, 0x04, 0x3F, 0xEC, 0x00, 0x00, 0xB4, 0xF1, 0xC7, 0x81, 0xD8, 0x87, 0x24, 0x87, 0x39, 0xE7,
+    0xAB, 0x49, 0x00, 0x00, 0x3C, 0xF4, 0x33, 0x99, 0x3F, 0x0E, 0xC4, 0xAE, 0x7E, 0xE0, 0x6F, 0x1E,
+    0xA2, 0x03, 0x00, 0xEC, 0xE7, 0x33, 0x99, 0x2B, 0x58, 0x3C, 0xFA, 0x87, 0xDD, 0x35, 0x2C, 0x00,
+    0x80, 0x1D, 0x7D, 0x26, 0x13, 0x20, 0x3C, 0x94, 0x87, 0xE8, 0x00, 0x00, 0xFB, 0xFA, 0x4C, 0x26,
+    0x40, 0x78, 0x34, 0x27, 0x20, 0x00, 0x00, 0x3E, 0x93, 0x41, 0x0F, 0x0F, 0xD1, 0x01, 0x00, 0x7C,
+    0x26, 0x83, 0xEE, 0x1F, 0x78, 0x0F, 0xD1, 0x01, 0x00, 0x1E, 0xFF, 0x99, 0x2C, 0x1D, 0xFF, 0x3B,
+    0xAE, 0x60, 0xF1, 0x0C, 0x3F, 0xEC, 0x8E, 0xFC, 0x00, 0x00, 0x1E, 0xFF, 0x99, 0x6C, 0x49, 0x72,
+    0x12, 0x20, 0x6C, 0x9E, 0x87, 0xE8, 0x00, 0x00, 0x4F, 0xF1, 0x99, 0xAC, 0xE5, 0x97, 0xC2, 0x02,
+    0x84, 0x67, 0x70, 0x1D, 0x63, 0xFC, 0x64, 0x0C, 0x00, 0x00, 0x0F, 0x25, 0x40, 0xF0, 0xC3, 0x0E,
+    0x00, 0x80, 0xCF, 0x64, 0x70, 0x77, 0x5D, 0x8F, 0x9E, 0x00, 0x00, 0x78, 0xEC, 0x67, 0x32, 0x27,
+    0x20, 0x3C, 0xCB, 0x0F, 0x7B, 0xCB, 0xA3, 0x27, 0x00, 0x00, 0x7E, 0xE8, 0x92, 0xE4, 0x28, 0x40,
+    0xD8, 0xBC, 0xAE, 0x47, 0x4F, 0x00, 0x00, 0xFC, 0x38, 0x40, 0x7C, 0x26, 0x03, 0x00, 0x00, 0x5A,
+    0x24, 0xF9, 0x5B, 0x92, 0xBF, 0xAF, 0xF9, 0xBF, 0xE1, 0x04, 0x04, 0x00, 0x00, 0x78, 0x77, 0x49,
+    0xE2, 0x04, 0x04, 0x00, 0x00, 0xE8, 0xB1, 0xF6, 0x43, 0x74, 0x27, 0x20, 0x00, 0x00, 0xC0, 0xAF,
+    0x03, 0xE4, 0x9A, 0xE4, 0x20, 0x40, 0x00, 0x00, 0x80, 0xD5, 0xAD, 0xFD, 0xC7, 0x81, 0x04, 0x08,
+    0x00, 0x00, 0xF0, 0x6B, 0x02, 0x04, 0x00, 0x00, 0x68, 0xB3, 0x24, 0x39, 0x1B, 0x03, 0x00, 0x00,
+    0xB0, 0xBA, 0x24, 0x2F, 0x49, 0x6E, 0x6B, 0xFD, 0xF7, 0x9D, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x56,
+    0x55, 0x6F, 0xEF, 0x21, 0x22, 0x40, 0x00, 0x00, 0x80, 0xD5, 0x25, 0x59, 0xED, 0x1D, 0x88, 0x00,
+    0x01, 0x00, 0x00, 0xFE, 0x4B, 0x55, 0x2D, 0x63, 0x8C, 0xB3, 0x00, 0x01, 0x00, 0x00, 0x3A, 0xAC,
+    0xFA, 0x97, 0xB0, 0x00, 0x00, 0x00, 0xFE, 0x2D, 0xC9, 0x61, 0xCE, 0xF9, 0x6A, 0x12, 0x00, 0x00,
+    0x40, 0x57, 0x84, 0x64, 0x8D, 0xFF, 0xAE, 0x2B, 0x58, 0x00, 0x00, 0xC0, 0xF7, 0x02, 0x64, 0x49,
+    0x72, 0x12, 0x20, 0x00, 0x00, 0xC0, 0xEA, 0xAA, 0x6A, 0x95, 0x77, 0x20, 0x02, 0x04, 0x00, 0x00,
+    0xF8, 0x1E, 0x01, 0x02, 0x00, 0x00, 0x7C, 0xEC, 0x00, 0x01, 0x00, 0x00, 0xF8, 0xAE, 0x35, 0x1E,
+    0xA2, 0x3B, 0x01, 0x01, 0x00, 0x00, 0x7E, 0xCF, 0x25, 0xC9, 0x51, 0x80, 0x00, 0x00, 0x00, 0x2D,
+    0x01, 0x32, 0xEE, 0x7C, 0x0D, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x78, 0x7C,
+    0x80, 0x24, 0xF1, 0x10, 0x1D, 0x00, 0x00, 0xE8, 0x71, 0xEF, 0x87, 0xE8, 0x4E, 0x40, 0x00, 0x00,
+    0x80, 0x1F, 0x05, 0xC8, 0x35, 0xC9, 0x41, 0x80, 0x00, 0x00, 0x00, 0xAB, 0xBB, 0xF7, 0x37, 0xA2,
+    0x0B, 0x10, 0x80, 0x3B, 0x48, 0xF2, 0x39, 0xC9, 0x17, 0x93, 0x00, 0x60, 0x83, 0x04, 0x08, 0xC0,
+    0xD6, 0xFF, 0x71, 0x06, 0x80, 0x27, 0xB2, 0x24, 0x39, 0x1B, 0x03, 0xC0, 0x93, 0x59, 0xE3, 0xDB,
+    0x62, 0x01, 0xE0, 0x09, 0xF6, 0xDB, 0x4B, 0x92, 0xDB, 0xBD, 0xFE, 0x7B, 0x4E, 0x40, 0x00, 0xEE,
+    0xE7, 0xEE, 0xDF, 0x16, 0x0B, 0x00, 0x8F, 0x56, 0x55, 0x6F, 0xEF, 0x21, 0x22, 0x40, 0x00, 0x9E,
+    0x2C, 0x40, 0x86, 0x6B, 0x58, 0x00, 0x6C, 0x50, 0x92, 0xBB, 0xED, 0x38, 0x01, 0x02, 0x20, 0x40,
+    0x00, 0xE0, 0x87, 0xAA, 0x6A, 0x19, 0x63, 0x9C, 0x05, 0x08, 0xC0, 0x93, 0x05, 0x88, 0x6F, 0x8B,
+    0x05, 0x60, 0xAB, 0x3B, 0x6E, 0xF8, 0x25, 0x1B, 0xC0, 0xF3, 0xF1, 0x10, 0x1D, 0x80, 0x8D, 0xEE,
+    0xB7, 0xC3, 0x9C, 0xF3, 0xD5, 0x24, 0x00, 0x9E, 0xCC, 0x9C, 0xF3, 0xF5, 0x9E, 0xDF, 0x16, 0x0B,
+    0x00, 0x4F, 0x14, 0x21, 0x77, 0xF9, 0x25, 0x9B, 0x2B, 0x58, 0x00, 0x77, 0x74, 0xEF, 0x6F, 0x8B,
+    0x05, 0x80, 0x27, 0x0A, 0x90, 0x25, 0xC9, 0x49, 0x80, 0x00, 0x3C, 0x17, 0x01, 0x02, 0xC0, 0x26,
+    0xF9, 0x25, 0x1B, 0xC0, 0x13, 0x4A, 0x72, 0x9A, 0x73, 0x7E, 0x35, 0x09, 0x00, 0x00, 0xA0, 0x23,
+    0x40, 0xEE, 0xFA, 0x6D, 0xB1, 0x00, 0xB0, 0x35, 0xAE, 0x60, 0x01, 0xDC, 0xD1, 0xBD, 0xBF, 0x2D,
+    0x16, 0x00, 0x04, 0x08, 0x00, 0x3F, 0x74, 0xCF, 0x6F, 0x8B, 0x05, 0x00, 0x01, 0x02, 0xC0, 0x0F,
+    0xDD, 0xF3, 0xDB, 0x62, 0x01, 0x40, 0x80, 0x00, 0xF0, 0x47, 0x9C, 0x80, 0x00, 0x00, 0x00, 0x3D,
+    0x7C, 0x5B, 0x2C, 0x00, 0x00, 0xD0, 0x1D, 0x21, 0x31, 0x05, 0x00, 0xF8, 0x2D, 0x57, 0xB0, 0x00,
+    0xD6, 0x09, 0x90, 0xBB, 0x7C, 0x5B, 0x2C, 0x00, 0x08, 0x10, 0x00, 0xFE, 0x90, 0x6F, 0x8B, 0x05,
+    0x00, 0x01, 0x02, 0xD0, 0x49, 0x80, 0x00, 0x80, 0x00, 0x01, 0x10, 0x20, 0x00, 0x00, 0xC0, 0x06,
+    0x79, 0x88, 0x0E, 0x00, 0xBF, 0xE5, 0x04, 0x04, 0x60, 0x3D, 0x97, 0x24, 0x47, 0x63, 0x00, 0x00,
+    0x01, 0x02, 0xD0, 0x12, 0x20, 0xC3, 0x35, 0x2C, 0x00, 0x10, 0x20, 0x00, 0x02, 0x04, 0x00, 0x04,
+    0x08, 0xC0, 0xE6, 0x02, 0x24, 0x89, 0x00, 0x01, 0x00, 0x00, 0x7A, 0x78, 0x88, 0x0E, 0x00, 0xFF,
+    0xCD, 0x09, 0x08, 0xC0, 0xBA, 0x01, 0x72, 0x4D, 0x72, 0x30, 0x09, 0x00, 0x10, 0x20, 0x00, 0xAB,
+    0xF3, 0x8D, 0xE8, 0x00, 0x20, 0x40, 0x00, 0x3A, 0x09, 0x10, 0x00, 0x10, 0x20, 0x00, 0x6D, 0x96,
+    0x24, 0x67, 0x63, 0x00, 0x00, 0x00, 0x56, 0x97, 0xE4, 0x25, 0xC9, 0xCD, 0x24, 0x00, 0xE0, 0x17,
+    0x4E, 0x40, 0x00, 0x56, 0x54, 0x55, 0x6F, 0xEF, 0x21, 0x62, 0x1A, 0x00, 0x20, 0x40, 0x00, 0x56,
+    0x97, 0xC4, 0x3B, 0x10, 0x00, 0x10, 0x20, 0x00, 0x3D, 0xAA, 0x6A, 0x19, 0x63, 0x9C, 0x4D, 0x02,
+    0x00, 0x04, 0x08, 0x40, 0x07, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x5A, 0x92, 0x7C, 0x4E, 0xF2, 0xC5, 0x24, 0x00, 0x00, 0xA0, 0xCF, 0xA7,
+    0x1D, 0xFF, 0x7F, 0xBF, 0x8C, 0x31, 0x7E, 0xF6, 0x23, 0x00, 0x00, 0x00, 0xB4, 0x48, 0x12, 0x53,
+    0x00, 0x00, 0x80, 0x3E, 0x7B, 0x3E, 0x01, 0x19, 0x49, 0x96, 0x24, 0x27, 0x3F, 0x06, 0x00, 0x00,
+    0x20, 0x40, 0x56, 0x57, 0x55, 0xAE, 0x61, 0x01, 0x00, 0x80, 0x00, 0x69, 0x73, 0x1D, 0x63, 0xFC,
+    0xE4, 0xC7, 0x00, 0x00, 0x00, 0x04, 0x48, 0x87, 0x4B, 0x12, 0x27, 0x20, 0x00, 0x00, 0x40, 0x0F,
+    0x0F, 0xD1, 0x01, 0x00, 0xA0, 0xCF, 0x27, 0x23, 0x18, 0x97, 0x24, 0x47, 0x63, 0x00, 0x00, 0x00,
+    0x01, 0xD2, 0x12, 0x20, 0xC3, 0x43, 0x74, 0x00, 0x00, 0x10, 0x20, 0x02, 0x04, 0x00, 0x00, 0x04,
+    0xC8, 0xE6, 0x02, 0xC4, 0x43, 0x74, 0x00, 0x00, 0xA0, 0x8D, 0x87, 0xE8, 0x00, 0x00, 0xD0, 0xC3,
+    0x09, 0xC8, 0x2F, 0x3C, 0x44, 0x07, 0x00, 0x00, 0x01, 0xD2, 0x17, 0x20, 0xC3, 0x3B, 0x10, 0x00,
+    0x00, 0x10, 0x20, 0x02, 0x04, 0x00, 0x00, 0x04, 0xC8, 0xE6, 0x02, 0xC4, 0x43, 0x74, 0x00, 0x00,
+    0xA0, 0x8D, 0x87, 0xE8, 0x00, 0x00, 0xB0, 0x3E, 0x27, 0x20, 0xFF, 0x09, 0x90, 0x6B, 0x92, 0x83,
+    0x49, 0x00, 0x00, 0x80, 0x00, 0x59, 0x5D, 0x55, 0x79, 0x07, 0x02, 0x00, 0x00, 0x02, 0xA4, 0x8D,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0xD2, 0x66, 0x49, 0x72, 0x36, 0x06, 0x00, 0x00, 0x60, 0x75, 0x49,
+    0x5E, 0x92, 0xDC, 0x4C, 0x02, 0x00, 0x00, 0xD6, 0xE3, 0x04, 0xE4, 0x5F, 0xAA, 0xEA, 0x2D, 0xC9,
+    0x3F, 0x3C, 0x44, 0x07, 0x00, 0x00, 0x01, 0xD2, 0x15, 0x21, 0xDE, 0x81, 0x00, 0x00, 0x80, 0x00,
+    0x69, 0x23, 0x40, 0x00, 0x00, 0x40, 0x80, 0xB4, 0xF1, 0x10, 0x1D, 0x00, 0x00, 0xE8, 0xE1, 0x21,
+    0x3A, 0x00, 0x00, 0xAC, 0xCB, 0x09, 0xC8, 0xAF, 0x54, 0xD5, 0xDB, 0x7B, 0x88, 0x98, 0x06, 0x00,
+    0x00, 0x08, 0x90, 0xD5, 0x25, 0xF1, 0x0E, 0x04, 0x00, 0x00, 0x04, 0x48, 0x8F, 0xAA, 0x5A, 0xC6,
+    0x18, 0x67, 0x93, 0x00, 0x00, 0x00, 0x01, 0xD2, 0xC1, 0x09, 0x08, 0x00, 0x00, 0xD0, 0x23, 0xC9,
+    0x61, 0xCE, 0xF9, 0x6A, 0x12, 0x00, 0x00, 0x40, 0x57, 0x84, 0xDC, 0x3C, 0x44, 0x07, 0x00, 0x80,
+    0xFB, 0x73, 0x05, 0xEB, 0xFB, 0x01, 0xE2, 0x1A, 0x16, 0x00, 0x00, 0x08, 0x90, 0x1E, 0x1E, 0xA2,
+    0x03, 0x00, 0x80, 0x00, 0xE9, 0xE4, 0x04, 0x04, 0x00, 0x00, 0xE8, 0xE1, 0x21, 0x3A, 0x00, 0x00,
+    0xD0, 0x1D, 0x21, 0x1E, 0xA2, 0x03, 0x00, 0xC0, 0x9D, 0xB9, 0x82, 0xF5, 0xFB, 0x01, 0xE2, 0x1A,
+    0x16, 0x00, 0x00, 0x08, 0x90, 0x1E, 0x1E, 0xA2, 0x03, 0x00, 0x80, 0x00, 0xE9, 0x74, 0x1D, 0x63,
+    0xFC, 0x64, 0x0C, 0x00, 0x00, 0x20, 0x40, 0x3A, 0xB8, 0x82, 0x05, 0x00, 0x00, 0xF4, 0x49, 0x12,
+    0x53, 0x00, 0x00, 0x80, 0xFB, 0x71, 0x02, 0xF2, 0xE3, 0x00, 0x59, 0x92, 0x9C, 0x4C, 0x02, 0x00,
+    0x00, 0x04, 0xC8, 0xEA, 0xAA, 0xCA, 0x35, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x23,
+    0xC9, 0xE7, 0x24, 0x5F, 0x4C, 0x62, 0x5F, 0x3E, 0x19, 0x01, 0x60, 0x19, 0x00, 0xF0, 0x20, 0x97,
+    0x31, 0xC6, 0xCF, 0xC6, 0x00, 0xB0, 0xEF, 0x00, 0x39, 0x26, 0xF9, 0x66, 0x12, 0x00, 0x34, 0xED,
+    0x9D, 0x98, 0x02, 0x80, 0x65, 0x60, 0x19, 0x00, 0xD0, 0xB5, 0x73, 0xBE, 0x25, 0x39, 0x9A, 0xC4,
+    0x7E, 0xB8, 0x82, 0x05, 0x7C, 0xCF, 0xC5, 0x32, 0x00, 0xA0, 0x6B, 0xE7, 0x0C, 0xD7, 0xB0, 0x04,
+    0x08, 0x60, 0x19, 0x58, 0x06, 0x00, 0xD8, 0x39, 0x08, 0x10, 0xC0, 0x32, 0x00, 0x60, 0x73, 0x3B,
+    0x27, 0x89, 0x9D, 0x03, 0xB0, 0x67, 0x49, 0x4E, 0x73, 0xCE, 0xAF, 0x26, 0x01, 0x40, 0xD3, 0xDE,
+    0xF1, 0xF6, 0x10, 0xC0, 0x32, 0xB0, 0x0C, 0x00, 0xE8, 0x31, 0xE7, 0x7C, 0x4D, 0x72, 0x30, 0x89,
+    0x7D, 0x70, 0x05, 0x0B, 0xF8, 0xBD, 0x00, 0xB9, 0x5A, 0x06, 0x00, 0x74, 0xA8, 0x2A, 0x57, 0x7F,
+    0x05, 0x08, 0x60, 0x19, 0x58, 0x06, 0x00, 0xB4, 0xB1, 0x73, 0x04, 0x08, 0x80, 0x65, 0x00, 0x40,
+    0x9B, 0x25, 0xC9, 0xD9, 0x18, 0x00, 0x76, 0xCC, 0x43, 0x74, 0x00, 0x1A, 0x77, 0xCE, 0x4B, 0x92,
+    0x9B, 0x49, 0x00, 0x58, 0x06, 0x96, 0x01, 0x00, 0x5D, 0x7B, 0xE7, 0x96, 0xE4, 0xC5, 0x24, 0xB6,
+    0xCF, 0x15, 0x2C, 0xE0, 0xBB, 0xAA, 0xEA, 0xED, 0x3D, 0x44, 0x4C, 0x03, 0x80, 0x86, 0x00, 0x71,
+    0xF5, 0x57, 0x80, 0x00, 0x96, 0x81, 0x65, 0x00, 0x40, 0x8F, 0xAA, 0x5A, 0xC6, 0x18, 0x67, 0x93,
+    0x10, 0x20, 0x80, 0x65, 0x60, 0x19, 0x00, 0xD0, 0xC1, 0x2F, 0xBD, 0x04, 0x08, 0x80, 0x65, 0x00,
+    0x40, 0xDF, 0xCE, 0x49, 0x62, 0xE7, 0x00, 0xEC, 0x59, 0x92, 0xC3, 0x9C, 0xF3, 0xD5, 0x24, 0x00,
+    0x68, 0xDA, 0x3B, 0x31, 0x05, 0x00, 0xCB, 0xC0, 0x32, 0x00, 0xA0, 0xC5, 0x9C, 0xF3, 0x6B, 0x92,
+    0x93, 0x49, 0x6C, 0x9B, 0x2B, 0x58, 0xC0, 0x1F, 0x05, 0xC8, 0x62, 0x19, 0x00, 0xD0, 0xA1, 0xAA,
+    0x5C, 0xFD, 0x15, 0x20, 0x80, 0x65, 0x60, 0x19, 0x00, 0xD0, 0xC6, 0xCE, 0x11, 0x20, 0x00, 0x96,
+    0x01, 0x00, 0x76, 0x0E, 0x00, 0x4D, 0x92, 0x1C, 0x93, 0x7C, 0x33, 0x09, 0x00, 0x9A, 0xF6, 0x8E,
+    0xB7, 0x87, 0x00, 0x96, 0x81, 0x65, 0x00, 0x40, 0xDB, 0xCE, 0xF9, 0x96, 0xE4, 0x68, 0x12, 0xDB,
+    0xE5, 0x0A, 0x16, 0xF0, 0x67, 0x5C, 0x2C, 0x03, 0x00, 0xBA, 0x76, 0xCE, 0x70, 0x0D, 0x4B, 0x80,
+    0x00, 0x96, 0x81, 0x65, 0x00, 0x80, 0x9D, 0x83, 0x00, 0x01, 0x2C, 0x03, 0x00, 0x36, 0xB7, 0x73,
+    0x7C, 0x23, 0x3A, 0xC0, 0xCE, 0x25, 0x39, 0xCD, 0x39, 0xBF, 0x9A, 0x04, 0x00, 0x4D, 0x7B, 0xC7,
+    0xDB, 0x43, 0x00, 0xCB, 0xC0, 0x32, 0x00, 0xA0, 0xC7, 0x9C, 0xF3, 0x35, 0xC9, 0xC1, 0x24, 0xB6,
+    0xC9, 0x15, 0x2C, 0xE0, 0xCF, 0x06, 0xC8, 0xD5, 0x32, 0x00, 0xA0, 0x83, 0x2F, 0xC1, 0x15, 0x20,
+    0x00, 0x96, 0x01, 0x00, 0x9D, 0xEC, 0x1C, 0x01, 0x02, 0x60, 0x19, 0x00, 0xD0, 0x66, 0x49, 0x72,
+    0x36, 0x06, 0x80, 0x1D, 0xF3, 0x10, 0x1D, 0x80, 0xC6, 0x9D, 0xF3, 0x92, 0xE4, 0x66, 0x12, 0x00,
+    0x96, 0x81, 0x65, 0x00, 0x40, 0xD7, 0xDE, 0xB9, 0x25, 0x79, 0x31, 0x89, 0xED, 0x71, 0x05, 0x0B,
+    0xF8, 0x53, 0xAA, 0xEA, 0xED, 0x3D, 0x44, 0x4C, 0x03, 0x80, 0x86, 0x00, 0x71, 0xF5, 0x57, 0x80,
+    0x00, 0x96, 0x81, 0x65, 0x00, 0x40, 0x8F, 0xAA, 0x5A, 0xC6, 0x18, 0x67, 0x93, 0x10, 0x20, 0x80,
+    0x65, 0x60, 0x19, 0x00, 0xD0, 0xC1, 0x2F, 0xBD, 0x04, 0x08, 0x80, 0x65, 0x00, 0x40, 0xDF, 0xCE,
+    0x49, 0x62, 0xE7, 0x00, 0xEC, 0x59, 0x92, 0xC3, 0x9C, 0xF3, 0xD5, 0x24, 0x00, 0x68, 0xDA, 0x3B,
+    0x31, 0x05, 0x00, 0xCB, 0xC0, 0x32, 0x00, 0xA0, 0xC5, 0x9C, 0xF3, 0x6B, 0x92, 0x93, 0x49, 0x6C,
+    0x8B, 0x2B, 0x58, 0xC0, 0xFF, 0x1A, 0x20, 0x8B, 0x65, 0x00, 0x40, 0x87, 0xAA, 0x72, 0xF5, 0x57,
+    0x80, 0x00, 0x96, 0x81, 0x65, 0x00, 0x40, 0x1B, 0x3B, 0x47, 0x80, 0x00, 0x58, 0x06, 0x00, 0xD8,
+    0x39, 0x00, 0x34, 0x49, 0x72, 0x4C, 0xF2, 0xCD, 0x24, 0x00, 0x68, 0xDA, 0x3B, 0xDE, 0x1E, 0x02,
+    0x58, 0x06, 0x96, 0x01, 0x00, 0x6D, 0x3B, 0xE7, 0x5B, 0x92, 0xA3, 0x49, 0x6C, 0x87, 0x2B, 0x58,
+    0xC0, 0x5F, 0x71, 0xB1, 0x0C, 0x00, 0xE8, 0xDA, 0x39, 0xC3, 0x35, 0x2C, 0x01, 0x02, 0x58, 0x06,
+    0x96, 0x01, 0x00, 0x76, 0x0E, 0x02, 0x04, 0xB0, 0x0C, 0x00, 0xD8, 0xDC, 0xCE, 0xF1, 0x8D, 0xE8,
+    0x00, 0x3B, 0x97, 0xE4, 0x34, 0xE7, 0xFC, 0x6A, 0x12, 0x00, 0x34, 0xED, 0x1D, 0x6F, 0x0F, 0x01,
+    0x2C, 0x03, 0xCB, 0x00, 0x80, 0x1E, 0x73, 0xCE, 0xD7, 0x24, 0x07, 0x93, 0xD8, 0x06, 0x57, 0xB0,
+    0x80, 0xBF, 0x1A, 0x20, 0x57, 0xCB, 0x00, 0x80, 0x0E, 0xBE, 0x04, 0x57, 0x80, 0x00, 0x58, 0x06,
+    0x00, 0x74, 0xB2, 0x73, 0x04, 0x08, 0x80, 0x65, 0x00, 0x40, 0x9B, 0x25, 0xC9, 0xD9, 0x18, 0x00,
+    0x76, 0xCC, 0x43, 0x74, 0x00, 0x1A, 0x77, 0xCE, 0x4B, 0x92, 0x9B, 0x49, 0x00, 0x58, 0x06, 0x96,
+    0x01, 0x00, 0x5D, 0x7B, 0xE7, 0x96, 0xE4, 0xC5, 0x24, 0x3E, 0x3E, 0x57, 0xB0, 0x80, 0xBF, 0xA4,
+    0xAA, 0xDE, 0xDE, 0x43, 0xC4, 0x34, 0x00, 0x68, 0x08, 0x10, 0x57, 0x7F, 0x05, 0x08, 0x60, 0x19,
+    0x58, 0x06, 0x00, 0xF4, 0xA8, 0xAA, 0x65, 0x8C, 0x71, 0x36, 0x09, 0x01, 0x02, 0x58, 0x06, 0x96,
+    0x01, 0x00, 0x1D, 0xFC, 0xD2, 0x4B, 0x80, 0x00, 0x58, 0x06, 0x00, 0xF4, 0xED, 0x9C, 0x24, 0x76,
+    0x0E, 0xC0, 0x9E, 0x25, 0x39, 0xCC, 0x39, 0x5F, 0x4D, 0x02, 0x80, 0xA6, 0xBD, 0x13, 0x53, 0x00,
+    0xB0, 0x0C, 0x2C, 0x03, 0x00, 0x5A, 0xCC, 0x39, 0xBF, 0x26, 0x39, 0x99, 0xC4, 0xC7, 0xE6, 0x0A,
+    0x16, 0xF0, 0xFF, 0x06, 0xC8, 0x62, 0x19, 0x00, 0xD0, 0xA1, 0xAA, 0x5C, 0xFD, 0x05, 0x10, 0x20,
+    0xF9, 0x7B, 0x92, 0xBF, 0x99, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x4B, 0xF2, 0x39, 0xC9, 0x17, 0x93, 0x00,
+    0xB6, 0xEE, 0x93, 0x11, 0x00, 0xC0, 0x53, 0xB8, 0x8C, 0x31, 0x7E, 0x36, 0x06, 0x00, 0x00, 0xA0,
+    0x45, 0x92, 0x98, 0x02, 0xB0, 0x75, 0x4E, 0x40, 0x00, 0xE0, 0x79, 0x5C, 0x92, 0x1C, 0x8D, 0x01,
+    0x10, 0x20, 0x00, 0x40, 0x4B, 0x80, 0x0C, 0xD7, 0xB0, 0x00, 0x01, 0x02, 0x00, 0x08, 0x10, 0x00,
+    0x01, 0x02, 0x00, 0x9B, 0x0B, 0x90, 0x24, 0x02, 0x04, 0x00, 0x00, 0xE8, 0xE1, 0x21, 0x3A, 0xB0,
+    0x75, 0x4E, 0x40, 0x00, 0xE0, 0xB9, 0x02, 0xE4, 0x9A, 0xE4, 0x60, 0x12, 0x80, 0x00, 0x01, 0x00,
+    0x56, 0x57, 0x55, 0xDE, 0x81, 0x00, 0x02, 0x04, 0x00, 0x68, 0x23, 0x40, 0x00, 0x01, 0x02, 0x00,
+    0xB4, 0x59, 0x92, 0x9C, 0x8D, 0x01, 0x00, 0x00, 0x58, 0x5D, 0x92, 0x97, 0x24, 0x37, 0x93, 0x00,
+    0xB6, 0xCA, 0x09, 0x08, 0x00, 0x3C, 0x91, 0xAA, 0x7A, 0x7B, 0x0F, 0x11, 0xD3, 0x00, 0x04, 0x08,
+    0x00, 0xB0, 0xBA, 0x24, 0xDE, 0x81, 0x00, 0x02, 0x04, 0x00, 0xE8, 0x51, 0x55, 0xCB, 0x18, 0xE3,
+    0x6C, 0x12, 0x80, 0x00, 0x01, 0x00, 0x3A, 0x38, 0x01, 0x01, 0x00, 0x00, 0x7A, 0x24, 0x39, 0xCC,
+    0x39, 0x5F, 0x4D, 0x02, 0x00, 0x00, 0xE8, 0x8A, 0x90, 0x98, 0x02, 0xB0, 0x45, 0xAE, 0x60, 0x01,
+    0xC0, 0x73, 0x06, 0xC8, 0x92, 0xE4, 0x64, 0x12, 0x80, 0x00, 0x01, 0x00, 0x56, 0x57, 0x55, 0xDE,
+    0x81, 0x00, 0x02, 0x04, 0x00, 0x68, 0x23, 0x40, 0x00, 0x01, 0x02, 0x00, 0x08, 0x10, 0x00, 0x00,
+    0x60, 0x83, 0x3C, 0x44, 0x07, 0xB6, 0xC8, 0x09, 0x08, 0x00, 0x3C, 0xAF, 0x4B, 0x92, 0xA3, 0x31,
+    0x00, 0x02, 0x04, 0x00, 0x68, 0x09, 0x90, 0xE1, 0x1A, 0x16, 0x20, 0x40, 0x00, 0x00, 0x01, 0x02,
+    0x20, 0x40, 0x00, 0x60, 0x73, 0x01, 0x92, 0x44, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x3C, 0x44, 0x07,
+    0xB6, 0xC6, 0x09, 0x08, 0x00, 0x3C, 0x77, 0x80, 0x5C, 0x93, 0x1C, 0x4C, 0x02, 0x10, 0x20, 0x00,
+    0xC0, 0xEA, 0x7C, 0x23, 0x3A, 0x20, 0x40, 0x00, 0x80, 0x4E, 0x02, 0x04, 0x10, 0x20, 0x00, 0x40,
+    0x9B, 0x25, 0xC9, 0xD9, 0x18, 0x00, 0x00, 0x80, 0xD5, 0x25, 0x79, 0x49, 0x72, 0x33, 0x09, 0x60,
+    0x2B, 0x9C, 0x80, 0x00, 0xC0, 0x13, 0xAB, 0xAA, 0xB7, 0xF7, 0x10, 0x31, 0x0D, 0x40, 0x80, 0x00,
+    0x00, 0xAB, 0x4B, 0xE2, 0x1D, 0x08, 0x20, 0x40, 0x00, 0x80, 0x1E, 0x55, 0xB5, 0x8C, 0x31, 0xCE,
+    0x26, 0x01, 0x08, 0x10, 0x00, 0xA0, 0x83, 0x13, 0x10, 0x00, 0x00, 0xA0, 0x47, 0x92, 0xC3, 0x9C,
+    0xF3, 0xD5, 0x24, 0x00, 0x00, 0x80, 0xAE, 0x08, 0x89, 0x29, 0x00, 0x5B, 0xE0, 0x0A, 0x16, 0x00,
+    0x7C, 0x8C, 0x00, 0x59, 0x92, 0x9C, 0x4C, 0x02, 0x10, 0x20, 0x00, 0xC0, 0xEA, 0xAA, 0xCA, 0x3B,
+    0x10, 0x40, 0x80, 0x00, 0x00, 0x6D, 0x04, 0x08, 0x20, 0x40, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+    0x6C, 0x90, 0x87, 0xE8, 0xC0, 0x16, 0x38, 0x01, 0x01, 0x80, 0x8F, 0xE3, 0x92, 0xE4, 0x68, 0x0C,
+    0x80, 0x00, 0x01, 0x00, 0x5A, 0x02, 0x64, 0xB8, 0x86, 0x05, 0x08, 0x10, 0x00, 0x40, 0x80, 0x00,
+    0x08, 0x10, 0x00, 0xD8, 0x5C, 0x80, 0x24, 0x11, 0x20, 0x00, 0x00, 0x40, 0x0F, 0x0F, 0xD1, 0x81,
+    0x8F, 0xCE, 0x09, 0x08, 0x00, 0x7C, 0xAC, 0x00, 0xB9, 0x26, 0x39, 0x98, 0x04, 0x20, 0x40, 0x00,
+    0x80, 0xD5, 0xF9, 0x46, 0x74, 0x40, 0x80, 0x00, 0x00, 0x9D, 0x04, 0x08, 0x20, 0x40, 0x00, 0x80,
+    0x36, 0x4B, 0x92, 0xB3, 0x31, 0x00, 0x00, 0x00, 0xAB, 0x4B, 0xF2, 0x92, 0xE4, 0x66, 0x12, 0xC0,
+    0x47, 0xE5, 0x04, 0x04, 0x00, 0x3E, 0x90, 0xAA, 0x7A, 0x7B, 0x0F, 0x11, 0xD3, 0x00, 0x04, 0x08,
+    0x00, 0xB0, 0xBA, 0x24, 0xDE, 0x81, 0x00, 0x02, 0x04, 0x00, 0xE8, 0x51, 0x55, 0xCB, 0x18, 0xE3,
+    0x6C, 0x12, 0x80, 0x00, 0x01, 0x00, 0x3A, 0x38, 0x01, 0x01, 0x00, 0x00, 0x7A, 0x24, 0x39, 0xCC,
+    0x39, 0x5F, 0x4D, 0x02, 0x00, 0x00, 0xE8, 0x8A, 0x90, 0x98, 0x02, 0xF0, 0x11, 0xB9, 0x82, 0x05,
+    0x00, 0x1F, 0x33, 0x40, 0x96, 0x24, 0x27, 0x93, 0x00, 0x04, 0x08, 0x00, 0xB0, 0xBA, 0xAA, 0xF2,
+    0x0E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xC3, 0x4B, 0xF2, 0x39, 0xC9, 0x17, 0x93, 0x00, 0x00, 0x78, 0xBC, 0x4F, 0x46, 0xC0, 0x0E,
+    0x5C, 0xC6, 0x18, 0x3F, 0x1B, 0x03, 0x00, 0x00, 0xD0, 0x22, 0x49, 0x4C, 0x01, 0x00, 0xE0, 0xF1,
+    0x9C, 0x80, 0xB0, 0x17, 0x97, 0x24, 0x47, 0x63, 0x00, 0x00, 0x10, 0x20, 0xD0, 0x12, 0x20, 0xC3,
+    0x35, 0x2C, 0x00, 0x00, 0x01, 0x02, 0x02, 0x04, 0x00, 0x40, 0x80, 0xC0, 0xE6, 0x02, 0x24, 0x89,
+    0x00, 0x01, 0x00, 0x00, 0x7A, 0x78, 0x88, 0x0E, 0x00, 0xF0, 0x78, 0x4E, 0x40, 0xD8, 0x53, 0x80,
+    0x5C, 0x93, 0x1C, 0x4C, 0x02, 0x00, 0x40, 0x80, 0xC0, 0xEA, 0xAA, 0xCA, 0x3B, 0x10, 0x00, 0x00,
+    0x01, 0x02, 0x6D, 0x04, 0x08, 0x00, 0x80, 0x00, 0x81, 0x36, 0x4B, 0x92, 0xB3, 0x31, 0x00, 0x00,
+    0x00, 0xAB, 0x4B, 0xF2, 0x92, 0xE4, 0x66, 0x12, 0x00, 0x00, 0x8F, 0xE3, 0x04, 0x84, 0xDD, 0xA8,
+    0xAA, 0xB7, 0xF7, 0x10, 0x31, 0x0D, 0x00, 0x00, 0x01, 0x02, 0xAB, 0x4B, 0xE2, 0x1D, 0x08, 0x00,
+    0x80, 0x00, 0x81, 0x1E, 0x55, 0xB5, 0x8C, 0x31, 0xCE, 0x26, 0x01, 0x00, 0x20, 0x40, 0xA0, 0x83,
+    0x13, 0x10, 0x00, 0x00, 0xA0, 0x47, 0x92, 0xC3, 0x9C, 0xF3, 0xD5, 0x24, 0x00, 0x00, 0x80, 0xAE,
+    0x08, 0x89, 0x29, 0x00, 0x00, 0x3C, 0x86, 0x2B, 0x58, 0xEC, 0x31, 0x40, 0x96, 0x24, 0x27, 0x93,
+    0x00, 0x00, 0x10, 0x20, 0xB0, 0xBA, 0xAA, 0xF2, 0x0E, 0x04, 0x00, 0x40, 0x80, 0x40, 0x1B, 0x01,
+    0x02, 0x00, 0x20, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x21, 0x3A, 0x00, 0xC0, 0x63,
+    0x38, 0x01, 0x61, 0xAF, 0x2E, 0x49, 0x8E, 0xC6, 0x00, 0x00, 0x20, 0x40, 0xA0, 0x25, 0x40, 0x86,
+    0x6B, 0x58, 0x00, 0x00, 0x02, 0x04, 0x04, 0x08, 0x00, 0x80, 0x00, 0x81, 0xCD, 0x05, 0x48, 0x12,
+    0x01, 0x02, 0x00, 0x00, 0xF4, 0xF0, 0x10, 0x1D, 0x00, 0xA0, 0x9F, 0x13, 0x10, 0xF6, 0x1C, 0x20,
+    0xD7, 0x24, 0x07, 0x93, 0x00, 0x00, 0x10, 0x20, 0xB0, 0x3A, 0xDF, 0x88, 0x0E, 0x00, 0x20, 0x40,
+    0xA0, 0x93, 0x00, 0x01, 0x00, 0x10, 0x20, 0xD0, 0x66, 0x49, 0x72, 0x36, 0x06, 0x00, 0x00, 0x60,
+    0x75, 0x49, 0x5E, 0x92, 0xDC, 0x4C, 0x02, 0x00, 0xA0, 0x8F, 0x13, 0x10, 0x76, 0xAB, 0xAA, 0xDE,
+    0xDE, 0x43, 0xC4, 0x34, 0x00, 0x00, 0x04, 0x08, 0xAC, 0x2E, 0x89, 0x77, 0x20, 0x00, 0x00, 0x02,
+    0x04, 0x7A, 0x54, 0xD5, 0x32, 0xC6, 0x38, 0x9B, 0x04, 0x00, 0x80, 0x00, 0x81, 0x0E, 0x4E, 0x40,
+    0x00, 0x00, 0x80, 0x1E, 0x49, 0x0E, 0x73, 0xCE, 0x57, 0x93, 0x00, 0x00, 0x00, 0xBA, 0x22, 0x24,
+    0xA6, 0x00, 0x00, 0xD0, 0xC3, 0x15, 0x2C, 0x04, 0x48, 0xB2, 0x24, 0x39, 0x99, 0x04, 0x00, 0x80,
+    0x00, 0x81, 0xD5, 0x55, 0x95, 0x77, 0x20, 0x00, 0x00, 0x02, 0x04, 0xDA, 0x08, 0x10, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x04, 0x00, 0x00, 0xD8, 0x20, 0x0F, 0xD1, 0x01, 0x00, 0x7A, 0x38, 0x01, 0x81,
+    0x5F, 0x5C, 0x92, 0x1C, 0x8D, 0x01, 0x00, 0x40, 0x80, 0x40, 0x4B, 0x80, 0x0C, 0xD7, 0xB0, 0x00,
+    0x00, 0x04, 0x08, 0x08, 0x10, 0x00, 0x00, 0x01, 0x02, 0x9B, 0x0B, 0x90, 0x24, 0x02, 0x04, 0x00,
+    0x00, 0xE8, 0xE1, 0x21, 0x3A, 0x00, 0xC0, 0xFA, 0x9C, 0x80, 0xC0, 0x7F, 0x02, 0xE4, 0x9A, 0xE4,
+    0x60, 0x12, 0x00, 0x00, 0x02, 0x04, 0x56, 0xE7, 0x1B, 0xD1, 0x01, 0x00, 0x04, 0x08, 0x74, 0x12,
+    0x20, 0x00, 0x00, 0x02, 0x04, 0xDA, 0x2C, 0x49, 0xCE, 0xC6, 0x00, 0x00, 0x00, 0xAC, 0x2E, 0xC9,
+    0x4B, 0x92, 0x9B, 0x49, 0x00, 0x60, 0xEF, 0xC1, 0x7A, 0x9C, 0x80, 0xC0, 0xBF, 0x54, 0xD5, 0xDB,
+    0xFB, 0x3F, 0xC8, 0xA6, 0x01, 0x80, 0xBD, 0x07, 0x02, 0x04, 0x56, 0x97, 0xC4, 0x3B, 0x10, 0x00,
+    0xEC, 0x3D, 0x10, 0x20, 0xD0, 0xA3, 0xAA, 0x96, 0x31, 0xC6, 0xD9, 0x24, 0x00, 0xB0, 0xF7, 0x40,
+    0x80, 0x40, 0x07, 0xBF, 0x09, 0x02, 0xC0, 0xDE, 0x03, 0xA0, 0x47, 0x92, 0xC3, 0x9C, 0xF3, 0xD5,
+    0x24, 0x00, 0xB0, 0xF7, 0x00, 0xE8, 0xFA, 0xC7, 0x38, 0xA6, 0x00, 0x80, 0xBD, 0x07, 0xEB, 0x70,
+    0x05, 0x0B, 0x7E, 0xFB, 0x0F, 0xF1, 0x92, 0xE4, 0x64, 0x12, 0x00, 0xD8, 0x7B, 0x20, 0x40, 0x60,
+    0x75, 0x55, 0xE5, 0x3E, 0x2C, 0x00, 0xF6, 0x1E, 0x00, 0x00, 0xC0, 0xBD, 0x25, 0xF9, 0x9C, 0xE4,
+    0x8B, 0x49, 0xD0, 0xC5, 0x09, 0x08, 0x00, 0xC0, 0xBE, 0x39, 0x01, 0x01, 0x00, 0x00, 0xFA, 0x78,
+    0x88, 0x4E, 0x27, 0x27, 0x20, 0x00, 0x00, 0x5C, 0x92, 0x1C, 0x8D, 0x01, 0x01, 0x02, 0x00, 0x40,
+    0x4B, 0x80, 0x0C, 0xD7, 0xB0, 0x10, 0x20, 0x00, 0x00, 0x08, 0x10, 0x04, 0x08, 0x00, 0x00, 0x9B,
+    0x0B, 0x90, 0x24, 0x02, 0x04, 0x00, 0x00, 0xE8, 0xE1, 0x21, 0x3A, 0x5D, 0x9C, 0x80, 0x00, 0x00,
+    0x30, 0x92, 0x5C, 0x93, 0x1C, 0x4C, 0x02, 0x01, 0x02, 0x00, 0xC0, 0xEA, 0x7C, 0x23, 0x3A, 0x02,
+    0x04, 0x00, 0x80, 0x4E, 0x02, 0x04, 0x01, 0x02, 0x00, 0x40, 0x9B, 0x25, 0xC9, 0xD9, 0x18, 0x00,
+    0x00, 0x80, 0xD5, 0x25, 0x79, 0x49, 0x72, 0x33, 0x09, 0xD6, 0xE6, 0x04, 0x04, 0x00, 0x80, 0x51,
+    0x55, 0x6F, 0xEF, 0x21, 0x62, 0x1A, 0x08, 0x10, 0x00, 0x00, 0x56, 0x97, 0xC4, 0x3B, 0x10, 0x04,
+    0x08, 0x00, 0x00, 0x3D, 0xAA, 0x6A, 0x19, 0x63, 0x9C, 0x4D, 0x02, 0x01, 0x02, 0x00, 0x40, 0x07,
+    0x27, 0x20, 0x00, 0x00, 0x40, 0x8F, 0x24, 0x87, 0x39, 0xE7, 0xAB, 0x49, 0x00, 0x00, 0x00, 0x5D,
+    0x11, 0x12, 0x53, 0x60, 0x4D, 0xAE, 0x60, 0x01, 0x00, 0xF0, 0xEB, 0x00, 0x59, 0x92, 0x9C, 0x4C,
+    0x02, 0x01, 0x02, 0x00, 0xC0, 0xEA, 0xAA, 0xCA, 0x3B, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x63, 0xF9, 0x27, 0x0B, 0x2A, 0x93, 0x38, 0x60, 0x3D, 0xE5,
+    0xAD, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82 
+};
+unsigned int rain_tile_near_len = sizeof(rain_tile_near);
+
+#endif
@@ -0,0 +1,652 @@
+#ifndef TOASTER_ATLAS_H
+#define TOASTER_ATLAS_H
+
+// Generated by utils/png_to_c.py --atlas from:
+//   toaster=img/toaster-sprite.gif:64
+//   toast0=img/toast0.gif
+//   toast1=img/toast1.gif
+//   toast2=img/toast2.gif
+//   toast3=img/toast3.gif
+
+#ifndef ATLAS_TYPES_DEFINED
+#define ATLAS_TYPES_DEFINED
+typedef struct { int x, y, w, h; } AtlasFrame;      // Atlas pixels
+typedef struct { int first, count; } AtlasSprite;   // Range in the frame table
+#endif
+
+#define TOASTER_ATLAS_WIDTH 256
+#define TOASTER_ATLAS_HEIGHT 256
+
+enum {
+    TOASTER_ATLAS_TOASTER,
+    TOASTER_ATLAS_TOAST0,
+    TOASTER_ATLAS_TOAST1,
+    TOASTER_ATLAS_TOAST2,
+    TOASTER_ATLAS_TOAST3,
+    TOASTER_ATLAS_SPRITE_COUNT
+};
+
+static const AtlasSprite toaster_atlas_sprites[] = {
+    {0, 4}, // toaster
+    {4, 1}, // toast0
+    {5, 1}, // toast1
+    {6, 1}, // toast2
+    {7, 1}, // toast3
+};
+
+static const AtlasFrame toaster_atlas_frames[] = {
+    {2, 2, 64, 64},
+    {70, 2, 64, 64},
+    {138, 2, 64, 64},
+    {2, 70, 64, 64},
+    {70, 70, 64, 64},
+    {138, 70, 64, 64},
+    {2, 138, 64, 64},
+    {70, 138, 64, 64},
+};
+
+static const unsigned char toaster_atlas[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x5C, 0x72, 0xA8,
+    0x66, 0x00, 0x00, 0x25, 0x44, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xED, 0x5D, 0xBF, 0x8F, 0x2B,
+    0xD7, 0x75, 0x3E, 0x7C, 0x10, 0x5C, 0x5A, 0xDE, 0x01, 0xDC, 0x28, 0x85, 0x44, 0x2A, 0xFF, 0xC1,
+    0x30, 0x0F, 0x8A, 0x20, 0x40, 0x80, 0xA0, 0x8D, 0x0B, 0xE5, 0xB9, 0xF1, 0xB2, 0x91, 0x0A, 0x75,
+    0x24, 0x6C, 0xA4, 0x48, 0xC9, 0xA7, 0x26, 0x72, 0x93, 0x5D, 0xB8, 0x72, 0x00, 0x23, 0x02, 0xA7,
+    0x53, 0x11, 0x35, 0x5C, 0x35, 0x79, 0x50, 0x21, 0x50, 0xB2, 0x21, 0x40, 0x48, 0x1E, 0x1C, 0xCE,
+    0x7F, 0x10, 0x93, 0x72, 0x00, 0xAB, 0x31, 0x40, 0xE6, 0xB9, 0x4C, 0xC3, 0x14, 0xE4, 0x19, 0x9E,
+    0x39, 0x3C, 0xF7, 0xCE, 0x1D, 0x72, 0x86, 0xE4, 0x72, 0xBE, 0x0F, 0x58, 0x0C, 0x97, 0x8F, 0x3F,
+    0xDE, 0x9E, 0x7B, 0xBF, 0xEF, 0x7C, 0xE7, 0xDC, 0x3B, 0x33, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x0F, 0x2D, 0x7E, 0xB0, 0x5A, 0xAD, 0x2A, 0xFD, 0xE0, 0xE5, 0x72, 0x99, 0xFB, 0xC0, 0xAB,
+    0xAB, 0xAB, 0xD6, 0x59, 0x07, 0xA2, 0x95, 0xFF, 0xEF, 0x55, 0x1D, 0x8F, 0x07, 0x37, 0x31, 0x10,
+    0x0F, 0x6F, 0x3C, 0x20, 0x00, 0x05, 0xA4, 0xBF, 0xBA, 0xBA, 0x92, 0xCF, 0x9F, 0xBD, 0x10, 0x60,
+    0xC2, 0x23, 0x1E, 0x10, 0x80, 0x8A, 0x89, 0x2F, 0x91, 0xA6, 0x69, 0xF6, 0x38, 0x8E, 0xE3, 0x16,
+    0x26, 0x3C, 0x04, 0x00, 0x02, 0x70, 0x01, 0x02, 0xE0, 0x23, 0xBF, 0x24, 0xBD, 0x7C, 0x4C, 0x44,
+    0xD4, 0xEF, 0xF7, 0x5B, 0x98, 0xF0, 0x10, 0x00, 0x08, 0xC0, 0x69, 0xF1, 0x52, 0x15, 0x96, 0xDF,
+    0xCA, 0xFA, 0x69, 0x9A, 0xE6, 0x48, 0xDF, 0xEF, 0xF7, 0x9D, 0x62, 0x00, 0x00, 0xC0, 0x03, 0x13,
+    0x80, 0x10, 0xF2, 0x4B, 0xD2, 0x37, 0x94, 0xFC, 0x2B, 0xD9, 0xFF, 0xD8, 0xC4, 0xAB, 0x85, 0x69,
+    0x07, 0x3C, 0xF8, 0x12, 0x60, 0xB9, 0x5C, 0xAE, 0x5C, 0xF5, 0x7E, 0x11, 0xD9, 0x2F, 0xBD, 0x07,
+    0xF0, 0x90, 0x9B, 0xA1, 0x28, 0x01, 0xD0, 0x03, 0x38, 0x98, 0xFC, 0x4C, 0xFC, 0xA2, 0xBA, 0x3F,
+    0x49, 0x92, 0xA0, 0x2F, 0x3D, 0x46, 0xBF, 0xA0, 0x8A, 0x09, 0x5F, 0xB6, 0x19, 0xBA, 0x71, 0x49,
+    0xAD, 0x4B, 0x8D, 0xC7, 0xA1, 0x38, 0xE7, 0x78, 0x34, 0x56, 0x00, 0x7C, 0xD6, 0x5F, 0xD7, 0xFE,
+    0xB2, 0x04, 0x68, 0xB5, 0x5A, 0x34, 0x1A, 0x8D, 0xD8, 0x01, 0xEC, 0xF5, 0x9F, 0xD5, 0x84, 0x39,
+    0xA7, 0x09, 0x5F, 0xA6, 0x19, 0xDA, 0xEF, 0xF7, 0x2F, 0x3E, 0x1E, 0x87, 0x10, 0xFE, 0x21, 0xC4,
+    0xA3, 0xD1, 0x02, 0x50, 0x64, 0xFD, 0xD5, 0xA0, 0x7A, 0x27, 0xF9, 0x60, 0xD0, 0x2D, 0xFC, 0x8C,
+    0xD1, 0x68, 0x5A, 0xFB, 0x40, 0x1F, 0x32, 0xE1, 0x8B, 0x44, 0xB1, 0x69, 0xF1, 0xA8, 0x92, 0xF4,
+    0xE7, 0x1A, 0x8F, 0x46, 0x0A, 0x40, 0x28, 0xF9, 0x7D, 0x93, 0xDC, 0x35, 0xA0, 0x2E, 0xCD, 0x4F,
+    0x89, 0x68, 0x36, 0x5B, 0x7F, 0xE7, 0x64, 0x32, 0x31, 0xDC, 0x46, 0x22, 0x27, 0x42, 0xEB, 0xD8,
+    0x13, 0x3E, 0x84, 0xFC, 0x4D, 0x8A, 0xC7, 0xA1, 0xA4, 0x7F, 0x28, 0xF1, 0x68, 0x9C, 0x00, 0x84,
+    0x4E, 0xF4, 0xD0, 0x41, 0xE5, 0x57, 0xF5, 0x8D, 0xCF, 0xE9, 0x4C, 0x16, 0x3B, 0xCF, 0xCD, 0x66,
+    0x33, 0xA7, 0xED, 0x4B, 0x92, 0x41, 0x8E, 0x60, 0xFB, 0x0C, 0xF4, 0x21, 0x02, 0xE0, 0x8A, 0xC9,
+    0x3E, 0xF1, 0xB0, 0x62, 0xF2, 0x90, 0xE2, 0x51, 0x44, 0xFC, 0x7D, 0xE2, 0xA1, 0x63, 0x72, 0x0E,
+    0xF1, 0x80, 0x00, 0x14, 0x4C, 0xF4, 0xEB, 0xEB, 0x6B, 0xEA, 0x74, 0x96, 0x85, 0x84, 0xD7, 0x83,
+    0xE9, 0x1A, 0xC8, 0x6E, 0x77, 0x3B, 0x49, 0xA6, 0xD3, 0x69, 0xE1, 0x40, 0x97, 0x1D, 0xE4, 0x7D,
+    0x26, 0xBC, 0x8B, 0xFC, 0x65, 0xE2, 0x51, 0x34, 0xB9, 0x1F, 0x52, 0x3C, 0xCA, 0x10, 0xDF, 0x17,
+    0x0F, 0x19, 0x93, 0x73, 0x8D, 0x47, 0x23, 0x05, 0x40, 0x4F, 0xF6, 0xD0, 0x89, 0xEE, 0x22, 0x7D,
+    0xD1, 0x60, 0xBA, 0x32, 0xAB, 0x5C, 0x4E, 0xD3, 0x83, 0x9D, 0xA6, 0x29, 0x0D, 0x87, 0x43, 0xEA,
+    0x74, 0x96, 0xA5, 0x06, 0xBA, 0xEC, 0x84, 0x3F, 0x24, 0x1E, 0x2E, 0xD2, 0x3F, 0xE4, 0x78, 0x1C,
+    0x4A, 0xFC, 0x87, 0x16, 0x8F, 0xA6, 0x09, 0xC0, 0x6A, 0xB9, 0x5C, 0x66, 0x01, 0xDF, 0x87, 0xF8,
+    0xAE, 0x41, 0x95, 0xCA, 0x1D, 0xDA, 0x48, 0xD3, 0x03, 0xCD, 0x83, 0x1C, 0xC7, 0x71, 0xB6, 0x0A,
+    0x51, 0x76, 0x90, 0xCB, 0x4C, 0x78, 0xED, 0x86, 0x9A, 0x1E, 0x8F, 0x2A, 0x88, 0xFF, 0xD0, 0xE2,
+    0xD1, 0x28, 0x01, 0xE0, 0x6C, 0x57, 0x76, 0xA2, 0x87, 0x0C, 0xAA, 0x6B, 0x40, 0x7B, 0x9D, 0x65,
+    0x50, 0x0D, 0x58, 0x76, 0x42, 0xF0, 0xEB, 0x97, 0xCB, 0x25, 0xCD, 0x66, 0xB3, 0x6C, 0x53, 0x52,
+    0x59, 0x01, 0x28, 0x13, 0x0F, 0xFE, 0xFF, 0x57, 0x19, 0x0F, 0x89, 0xBB, 0x80, 0x78, 0x24, 0x49,
+    0x52, 0x6A, 0xD2, 0xEF, 0x23, 0x00, 0x65, 0x89, 0xFF, 0x90, 0xE3, 0xD1, 0x38, 0x01, 0x18, 0x8F,
+    0xC7, 0xB9, 0xC9, 0x7E, 0x7D, 0x7D, 0xBD, 0x26, 0xE3, 0x66, 0x20, 0xAC, 0x0C, 0x27, 0x07, 0x56,
+    0x0F, 0xAA, 0x24, 0x23, 0x0F, 0x68, 0x51, 0x43, 0xB0, 0x0C, 0xD9, 0x43, 0x32, 0x83, 0xAC, 0x2B,
+    0xBB, 0xDD, 0x6E, 0xAB, 0x8C, 0x00, 0x84, 0xC4, 0x43, 0x67, 0xB8, 0xB2, 0xF1, 0x08, 0xE9, 0x99,
+    0x94, 0x5D, 0x92, 0x0D, 0x9D, 0xF4, 0x65, 0x05, 0x40, 0x93, 0xBF, 0xAE, 0x78, 0x14, 0xF5, 0x4C,
+    0x8E, 0x15, 0x8F, 0xC6, 0x08, 0x40, 0x92, 0x24, 0xAB, 0x5E, 0xAF, 0x97, 0x0D, 0x96, 0x1E, 0xD8,
+    0xA2, 0xAC, 0xEF, 0x52, 0x73, 0x6B, 0x82, 0xC7, 0xD3, 0x15, 0x19, 0x7B, 0xE7, 0x6B, 0x21, 0xBC,
+    0x51, 0x57, 0x06, 0x09, 0x40, 0xDD, 0xF1, 0xD8, 0x67, 0x82, 0x17, 0xFD, 0x7D, 0x9D, 0x4E, 0x27,
+    0x7B, 0xFC, 0xFA, 0xEB, 0xAF, 0xAF, 0xBF, 0xAF, 0xD7, 0xA9, 0x44, 0x00, 0x42, 0xE3, 0xE1, 0xCA,
+    0xFA, 0x21, 0xF1, 0xF0, 0x35, 0x05, 0x4F, 0x15, 0x8F, 0x46, 0x08, 0x40, 0xD1, 0xE0, 0xEE, 0x3B,
+    0xD1, 0xCB, 0x4C, 0x70, 0xB5, 0x7F, 0xDE, 0xF9, 0x87, 0xA4, 0x69, 0x9A, 0x1B, 0x58, 0x1F, 0xD9,
+    0xAD, 0x73, 0x14, 0x06, 0x83, 0x41, 0xA1, 0x00, 0x84, 0xC4, 0x63, 0xDF, 0x89, 0xDE, 0xDF, 0x23,
+    0x1E, 0x12, 0xE3, 0xF1, 0x38, 0xF7, 0xFB, 0x62, 0xB1, 0x30, 0x5F, 0x17, 0x45, 0x51, 0x50, 0xD6,
+    0x0B, 0x11, 0x80, 0x26, 0xC7, 0xE3, 0xE2, 0x05, 0x20, 0xC4, 0xD2, 0x15, 0xD9, 0x39, 0x1E, 0x2C,
+    0x2B, 0xDB, 0xF3, 0xC0, 0x16, 0x29, 0x38, 0x7F, 0x6E, 0xC8, 0xF6, 0x50, 0xD7, 0xC9, 0x47, 0xC6,
+    0x39, 0x09, 0xBA, 0x2F, 0xD0, 0x2A, 0x9A, 0xF0, 0x75, 0xC4, 0xC3, 0x9A, 0xE8, 0xA1, 0xF1, 0xE0,
+    0xBF, 0x49, 0x4F, 0xEC, 0xF9, 0x7C, 0xEE, 0x9C, 0xF0, 0x71, 0x1C, 0x53, 0x14, 0x45, 0x44, 0x44,
+    0xD9, 0xA4, 0x9F, 0x4E, 0x57, 0x7B, 0x09, 0x40, 0x19, 0xCB, 0x5F, 0x26, 0x1E, 0x5A, 0x30, 0xCE,
+    0x35, 0x1E, 0x97, 0x82, 0x97, 0x7C, 0xF5, 0x5C, 0xA7, 0xD3, 0xA1, 0xD9, 0x6C, 0x96, 0x1B, 0xDC,
+    0x38, 0x8E, 0x89, 0xD2, 0xD4, 0xAB, 0xEA, 0x21, 0xC4, 0x97, 0xAF, 0xB3, 0x54, 0x7C, 0x36, 0x9B,
+    0x99, 0xE7, 0x14, 0xF8, 0xE0, 0x12, 0x09, 0xF9, 0xFC, 0x72, 0xB9, 0xDC, 0x99, 0x40, 0x45, 0xE2,
+    0x52, 0x75, 0x3C, 0x5C, 0x19, 0x2E, 0x34, 0x1E, 0x7A, 0x42, 0xF3, 0x24, 0xD7, 0x99, 0xCD, 0x12,
+    0x42, 0x39, 0xE9, 0x79, 0x07, 0x5D, 0x59, 0xD4, 0x11, 0x0F, 0x4D, 0xFC, 0x87, 0x14, 0x8F, 0x8B,
+    0x13, 0x00, 0x1E, 0xDC, 0x7C, 0xDD, 0xB4, 0xE4, 0xA8, 0x05, 0xAB, 0x7A, 0xD1, 0xEE, 0x2D, 0x1E,
+    0x58, 0xF9, 0x39, 0x7A, 0x50, 0x07, 0x83, 0x41, 0xE9, 0x7A, 0x9F, 0x9B, 0x48, 0x16, 0x5C, 0x6B,
+    0xCB, 0x45, 0xC2, 0x52, 0x45, 0x3C, 0x7C, 0xD6, 0x36, 0x34, 0x1E, 0x1A, 0x3C, 0xD9, 0xDB, 0xED,
+    0xB6, 0xF7, 0x6F, 0x98, 0xCF, 0xE7, 0x14, 0x45, 0x51, 0x36, 0xE9, 0xEF, 0xEE, 0xEE, 0x68, 0x38,
+    0x1C, 0xEE, 0x35, 0x69, 0xAA, 0x8C, 0x87, 0x45, 0xFC, 0x87, 0x16, 0x8F, 0x8B, 0x12, 0x00, 0xAE,
+    0xEB, 0x24, 0x26, 0x93, 0x49, 0xB6, 0x8B, 0x8A, 0x4F, 0xBC, 0xE0, 0x81, 0xB0, 0x36, 0x65, 0x48,
+    0xF2, 0x5B, 0x03, 0xEB, 0xB2, 0x6F, 0x72, 0x82, 0x4D, 0x26, 0x13, 0x1A, 0x0C, 0x06, 0x14, 0x72,
+    0xCD, 0x01, 0x3D, 0x19, 0x79, 0x89, 0x2F, 0xB4, 0x4C, 0xF0, 0x39, 0x80, 0xAA, 0xE2, 0xE1, 0x9B,
+    0xE8, 0xBE, 0x78, 0xB8, 0x6A, 0x57, 0x46, 0xD1, 0x44, 0x2F, 0xFB, 0xBA, 0x90, 0xEC, 0x7F, 0x29,
+    0xF1, 0x18, 0x0C, 0x06, 0x8D, 0x24, 0xBD, 0xB7, 0x07, 0x30, 0x99, 0x4C, 0x56, 0x7A, 0xE0, 0xD4,
+    0x05, 0x3D, 0x0F, 0x26, 0xBF, 0xAB, 0x6E, 0x8B, 0xA2, 0x28, 0x23, 0x63, 0xA8, 0x00, 0xF8, 0x6A,
+    0xFF, 0xD0, 0xFA, 0xDF, 0x57, 0xF3, 0x9E, 0x32, 0x1E, 0x75, 0x81, 0x2D, 0x6F, 0x9A, 0xA6, 0x34,
+    0x1A, 0x8D, 0x4A, 0xF5, 0x00, 0x1E, 0x62, 0x3C, 0xE6, 0xF3, 0x39, 0xB5, 0xDB, 0xED, 0xEC, 0xE8,
+    0x7A, 0xCD, 0x78, 0x3C, 0xA6, 0xC5, 0x62, 0xD1, 0xDC, 0x26, 0x60, 0xAF, 0xD7, 0x5B, 0x49, 0x82,
+    0xB8, 0x06, 0xD9, 0xD5, 0xC5, 0xE5, 0xC1, 0x8D, 0xA7, 0xAB, 0xC2, 0x86, 0x8D, 0x1E, 0xD4, 0x28,
+    0x8A, 0x68, 0xB1, 0x58, 0xD0, 0xF5, 0xF5, 0x75, 0x29, 0xF2, 0xFB, 0x4A, 0x81, 0x90, 0xCC, 0xC2,
+    0xA7, 0x8D, 0x5A, 0x13, 0xFE, 0x94, 0xF1, 0xD0, 0x71, 0xA9, 0x9A, 0xFC, 0xFB, 0x08, 0xC0, 0x39,
+    0xC4, 0xA3, 0x6A, 0x11, 0xE0, 0xF9, 0xD6, 0x54, 0x01, 0x78, 0xE4, 0xAA, 0xA1, 0x88, 0xD6, 0x5B,
+    0x28, 0xE5, 0x36, 0x4A, 0x09, 0xBD, 0xC7, 0x5A, 0x0F, 0xAE, 0x6C, 0xB6, 0xCD, 0x66, 0xB3, 0x6C,
+    0x70, 0x27, 0x93, 0xC9, 0xCE, 0x64, 0xD1, 0xE4, 0xB7, 0x1A, 0x36, 0x56, 0x66, 0xE7, 0xEF, 0x90,
+    0x3F, 0xFC, 0x6F, 0xFC, 0x9D, 0xD6, 0x8F, 0xB8, 0x66, 0x61, 0x2B, 0x64, 0xE2, 0x9C, 0x22, 0x1E,
+    0xDA, 0xF2, 0x46, 0x51, 0x14, 0xF4, 0x53, 0x84, 0x2A, 0xB2, 0xE9, 0x29, 0xE3, 0x21, 0x7F, 0x77,
+    0xFD, 0xBD, 0x1C, 0x0B, 0xFE, 0xBF, 0x6A, 0xF2, 0xF3, 0xF3, 0x51, 0x14, 0x99, 0x4B, 0xC7, 0x8D,
+    0x6F, 0x02, 0x6A, 0x95, 0x74, 0x91, 0x72, 0x3A, 0x9D, 0x52, 0xA7, 0xD3, 0x59, 0x6F, 0xA6, 0x88,
+    0x63, 0xEA, 0xDC, 0x4D, 0x9C, 0xAA, 0xCE, 0x9F, 0xA3, 0x3F, 0x9B, 0xC9, 0x2F, 0x07, 0xB5, 0xD7,
+    0xEB, 0x15, 0x66, 0x7F, 0x69, 0x35, 0xCB, 0x96, 0x05, 0x65, 0x2F, 0x16, 0x71, 0xCA, 0x78, 0x58,
+    0xF5, 0xAD, 0xD5, 0xE5, 0xF6, 0x75, 0xBB, 0xEB, 0xCA, 0xA6, 0xC7, 0x8E, 0x87, 0xEF, 0x68, 0xFD,
+    0xED, 0x2C, 0x4A, 0xDC, 0xEC, 0x73, 0x95, 0x01, 0x9C, 0xFD, 0x21, 0x00, 0x44, 0x59, 0x53, 0xE4,
+    0xEE, 0xEE, 0x2E, 0x37, 0xE9, 0x64, 0x90, 0x79, 0xF9, 0x87, 0x07, 0xF0, 0x0F, 0x7F, 0xF8, 0x83,
+    0xB9, 0x64, 0x23, 0x55, 0x7D, 0x3E, 0x9F, 0xEF, 0x64, 0x09, 0x39, 0x88, 0xFC, 0x6F, 0x65, 0x26,
+    0xAB, 0xAF, 0x79, 0xC7, 0xFF, 0x66, 0x2C, 0xF9, 0x95, 0x22, 0xFF, 0xA9, 0xE2, 0xE1, 0x6B, 0x6A,
+    0x95, 0x69, 0xE8, 0x71, 0xB7, 0xDB, 0x53, 0x62, 0xAC, 0x5C, 0xB6, 0xF7, 0x9C, 0xE2, 0xE1, 0x3B,
+    0xC6, 0x71, 0xEC, 0x15, 0x45, 0x99, 0x30, 0x8A, 0x7A, 0x01, 0x8D, 0x6E, 0x02, 0x46, 0x51, 0xB4,
+    0xE2, 0xE5, 0x9C, 0xD9, 0xEC, 0x2A, 0x1B, 0x64, 0x3D, 0xE9, 0x78, 0x90, 0x7D, 0xA7, 0x63, 0xF2,
+    0xE0, 0xDE, 0xDD, 0xDD, 0x51, 0x14, 0x45, 0x3B, 0x01, 0xD7, 0x83, 0x58, 0xA6, 0xF6, 0x77, 0xED,
+    0xFA, 0xB3, 0xEA, 0x7C, 0x89, 0xEB, 0xEB, 0xEB, 0xE0, 0x1A, 0xEF, 0x94, 0xF1, 0x90, 0x02, 0xE6,
+    0x22, 0x2E, 0xAF, 0xBD, 0x17, 0x81, 0xC9, 0xE5, 0x5A, 0x32, 0x73, 0xD5, 0xBD, 0xE7, 0x14, 0x8F,
+    0x10, 0xF2, 0x4B, 0x6B, 0xEF, 0x9A, 0x33, 0x9A, 0xFC, 0xB2, 0x19, 0xCA, 0x0E, 0xA0, 0xD1, 0x4D,
+    0xC0, 0x6E, 0xB7, 0xB5, 0xCA, 0x93, 0xE8, 0x2A, 0xA7, 0xF6, 0x72, 0xA0, 0x65, 0xD6, 0xB6, 0x06,
+    0x77, 0x30, 0xE8, 0x52, 0x1C, 0xF7, 0x77, 0xDE, 0x63, 0x0D, 0x22, 0x93, 0x9F, 0x88, 0x6A, 0xE9,
+    0xFC, 0x73, 0xD6, 0x2A, 0xBB, 0xF3, 0xED, 0x94, 0xF1, 0x90, 0xF6, 0xDD, 0xF5, 0xD9, 0x87, 0x62,
+    0x30, 0x18, 0x94, 0x12, 0x80, 0x53, 0xC5, 0xC3, 0x22, 0x3D, 0xAF, 0xDF, 0xBB, 0xEA, 0x7B, 0x19,
+    0x3F, 0xEB, 0x35, 0xED, 0x76, 0x3B, 0xFB, 0xBC, 0x5F, 0xFD, 0xEA, 0x57, 0xA5, 0xE7, 0x47, 0x23,
+    0x04, 0xC0, 0x35, 0xD0, 0x72, 0xC0, 0x58, 0xE9, 0xA5, 0xAA, 0xF3, 0xE0, 0x86, 0xD6, 0x72, 0x65,
+    0xD6, 0xFD, 0x8B, 0xBA, 0xFD, 0x3A, 0xF3, 0xCB, 0x9D, 0x5E, 0x87, 0x0A, 0xC0, 0x31, 0xE2, 0x21,
+    0xC9, 0x3F, 0x99, 0x4C, 0xF6, 0x5E, 0xA7, 0xD6, 0x67, 0xD3, 0x95, 0x99, 0x0B, 0xE7, 0x14, 0x8F,
+    0xA2, 0x8C, 0xEF, 0x3A, 0xEA, 0x8C, 0xEF, 0x5A, 0x05, 0x90, 0xF5, 0x3F, 0xB6, 0x02, 0x3B, 0xC0,
+    0xB6, 0x4F, 0xD7, 0x7F, 0xAC, 0xB0, 0xDD, 0x6E, 0xD7, 0x39, 0xB8, 0x4C, 0xBE, 0x22, 0xF2, 0xEF,
+    0x3B, 0xC9, 0x99, 0xF4, 0x3A, 0xEB, 0xB3, 0xF2, 0xEB, 0xBF, 0xA1, 0x0A, 0xD4, 0x19, 0x0F, 0x49,
+    0xFE, 0xB2, 0xBB, 0x20, 0xB5, 0x10, 0x5A, 0x65, 0x92, 0x47, 0x14, 0x56, 0x1C, 0xC3, 0xB2, 0x7D,
+    0x92, 0x3A, 0xE3, 0xA1, 0xC9, 0xCF, 0x02, 0xE3, 0x22, 0x36, 0xFF, 0x0D, 0xFC, 0xF9, 0x3E, 0xF2,
+    0x5B, 0x7F, 0x43, 0xA3, 0x7B, 0x00, 0x52, 0xE1, 0x6F, 0x6E, 0x6E, 0x89, 0x88, 0xE8, 0xFE, 0xFE,
+    0xA9, 0xA9, 0xF8, 0x96, 0xDA, 0xBB, 0x06, 0x57, 0xDB, 0x59, 0xDD, 0xBD, 0x0D, 0xB1, 0xFE, 0xA1,
+    0x67, 0xFB, 0x69, 0x31, 0x61, 0x85, 0xE7, 0x01, 0xDE, 0xD7, 0x01, 0x1C, 0x23, 0x1E, 0xD2, 0x32,
+    0x17, 0x59, 0x7E, 0xB6, 0xC0, 0xFB, 0x96, 0x49, 0xEB, 0x49, 0xDF, 0x71, 0x8A, 0x87, 0x75, 0x7A,
+    0xF4, 0x29, 0xE6, 0x87, 0x74, 0x46, 0x3C, 0x5F, 0x8A, 0xC8, 0x1F, 0xB2, 0x72, 0x71, 0xE8, 0xFC,
+    0xB8, 0x14, 0x3C, 0xB2, 0x9E, 0xBC, 0xB9, 0xB9, 0xA5, 0xF9, 0xFC, 0x9E, 0xE6, 0xF3, 0xFB, 0x6C,
+    0xA0, 0xB5, 0x5A, 0xB2, 0xDA, 0x73, 0x96, 0xDD, 0x67, 0x70, 0xD9, 0xEE, 0x86, 0x64, 0xBA, 0x38,
+    0x8E, 0x73, 0x6B, 0xF9, 0xE3, 0xF1, 0x98, 0xC6, 0xE3, 0xF1, 0x66, 0x1B, 0x6A, 0x92, 0x1D, 0xF5,
+    0xE0, 0xEA, 0xE7, 0xF6, 0xC1, 0xB1, 0xE2, 0x11, 0x4A, 0x5C, 0xD9, 0xD5, 0xF6, 0x11, 0x3E, 0x8E,
+    0xE3, 0xDC, 0x0F, 0xBF, 0x86, 0x5F, 0xE7, 0xDA, 0x27, 0x71, 0x2E, 0xF1, 0x70, 0xAD, 0x5E, 0xEC,
+    0x4B, 0x7E, 0xDD, 0x1F, 0xA8, 0x6A, 0x7E, 0x5C, 0x9C, 0x03, 0x90, 0xB1, 0xEC, 0xF7, 0x63, 0x6A,
+    0xB7, 0x6F, 0x4C, 0xB5, 0x67, 0xA5, 0x4F, 0x92, 0x01, 0xB5, 0xDB, 0x37, 0xB9, 0x75, 0x57, 0x1F,
+    0xF6, 0xA9, 0xFD, 0x5D, 0xCB, 0x47, 0x3E, 0x68, 0x75, 0xDF, 0xD7, 0x01, 0xD4, 0x1D, 0x0F, 0x4D,
+    0xEA, 0xD0, 0xB3, 0x1F, 0x2D, 0xF2, 0xEB, 0xAC, 0x2E, 0x4F, 0x8C, 0x92, 0x31, 0x2E, 0x9A, 0xF8,
+    0xD6, 0xF5, 0x11, 0x8E, 0x3D, 0x3F, 0x8A, 0x96, 0x88, 0x43, 0xC8, 0x5F, 0xD7, 0xFC, 0x68, 0x8C,
+    0x00, 0xF0, 0x20, 0xAF, 0x95, 0x77, 0x77, 0xA0, 0xF9, 0x39, 0x5E, 0xCA, 0x29, 0x3B, 0xB8, 0x7C,
+    0x62, 0x89, 0x75, 0x3B, 0x2D, 0x9E, 0xCC, 0x56, 0x56, 0x0A, 0x21, 0xFF, 0xFA, 0x9A, 0x7D, 0xF9,
+    0xE7, 0x0F, 0x15, 0x80, 0xAA, 0xE3, 0xA1, 0x2D, 0x7F, 0x48, 0xE3, 0xCF, 0x67, 0xFF, 0x7D, 0x64,
+    0xE0, 0x78, 0x5A, 0x67, 0x4B, 0xF2, 0x73, 0xE3, 0xF1, 0x98, 0xFA, 0xFD, 0x7E, 0xEB, 0xD4, 0xF1,
+    0xB0, 0xCA, 0x22, 0x2D, 0x00, 0x87, 0xDC, 0x69, 0xFA, 0xD0, 0xF9, 0xD1, 0xA8, 0x26, 0x60, 0x92,
+    0xF0, 0x79, 0xF9, 0xDB, 0x01, 0xDD, 0x06, 0xF2, 0x7E, 0xA7, 0xA3, 0xEB, 0x83, 0xB5, 0xF4, 0x67,
+    0x65, 0x7F, 0xB9, 0x99, 0xC4, 0x6A, 0xF0, 0x9D, 0x12, 0x55, 0xC6, 0x43, 0x8B, 0x5A, 0x48, 0xD7,
+    0x3F, 0x8E, 0x63, 0xF3, 0x5C, 0x87, 0xAB, 0xAB, 0x2B, 0xD3, 0xEA, 0xCB, 0x12, 0xCA, 0x8A, 0xAF,
+    0xFC, 0x7D, 0x9F, 0x5B, 0x6A, 0x55, 0x1D, 0x8F, 0xBA, 0xC9, 0x0F, 0x14, 0x08, 0xC0, 0xE6, 0x9A,
+    0x0E, 0xE6, 0x40, 0xDF, 0xDE, 0xDE, 0xA8, 0x7A, 0xEC, 0xA6, 0xD4, 0x17, 0xEA, 0x6D, 0xBF, 0x65,
+    0x9A, 0x54, 0xA1, 0xAB, 0x05, 0x2E, 0x75, 0xDF, 0x17, 0x75, 0xC6, 0x43, 0xFE, 0x6D, 0xA1, 0xD9,
+    0x91, 0xC9, 0x2E, 0x49, 0xD0, 0xE9, 0x74, 0x72, 0xA2, 0x20, 0xEB, 0x7E, 0xCE, 0xEC, 0xF2, 0xDF,
+    0xF8, 0x77, 0x49, 0xF8, 0xD0, 0xBD, 0x06, 0x75, 0xC7, 0x43, 0x6E, 0xD0, 0xB1, 0x84, 0xE3, 0x50,
+    0xF2, 0x57, 0x3D, 0x3F, 0x2E, 0xD2, 0x01, 0xB8, 0x06, 0xD9, 0xEA, 0xFA, 0x96, 0x1D, 0xDC, 0xC5,
+    0x62, 0x41, 0x69, 0x9A, 0x92, 0x3E, 0xAF, 0x5C, 0x77, 0xFA, 0x5D, 0x0E, 0xC0, 0xFA, 0xBC, 0xBA,
+    0x07, 0xB7, 0xAE, 0x78, 0xC8, 0xBF, 0xC3, 0x55, 0xFB, 0xBB, 0x2C, 0xBF, 0x74, 0x02, 0xFA, 0xA2,
+    0x19, 0xFA, 0xF5, 0x1C, 0x6B, 0x5E, 0x32, 0xE5, 0xF3, 0xF7, 0xF7, 0xE9, 0x37, 0xD4, 0x1D, 0x0F,
+    0xD9, 0xF5, 0xD7, 0xA2, 0x58, 0x76, 0xC9, 0xF8, 0x58, 0xF3, 0xE3, 0x22, 0x4B, 0x00, 0xD7, 0x20,
+    0x6B, 0x8B, 0x17, 0x45, 0x7D, 0x33, 0xC3, 0x87, 0x0C, 0x8A, 0xB4, 0xFF, 0xBA, 0xB3, 0xED, 0x3A,
+    0x2D, 0xB4, 0xA8, 0x4B, 0x5C, 0x17, 0xEA, 0x8A, 0x47, 0x68, 0x73, 0xD0, 0xB5, 0x6C, 0x77, 0x75,
+    0x75, 0x95, 0xEB, 0x97, 0xE8, 0x38, 0xB2, 0xFD, 0xB7, 0xAE, 0xD8, 0x7B, 0x8E, 0xF1, 0x88, 0xA2,
+    0x88, 0x26, 0x93, 0x89, 0xB9, 0xDD, 0x59, 0x3F, 0x67, 0x09, 0xC2, 0x21, 0xF3, 0xA3, 0xDB, 0x6D,
+    0xAD, 0x5C, 0x7D, 0x80, 0x46, 0xF6, 0x00, 0xFA, 0xFD, 0x98, 0x92, 0x24, 0x75, 0x2A, 0xA6, 0x75,
+    0xC6, 0x55, 0x68, 0x19, 0x60, 0x5D, 0xE1, 0x55, 0x4E, 0xE4, 0x90, 0xCD, 0x21, 0x72, 0x90, 0x8F,
+    0xA1, 0xEE, 0x75, 0xC4, 0xC3, 0x82, 0xDE, 0xC9, 0xA7, 0x6B, 0x7B, 0x79, 0x35, 0x5E, 0xCB, 0x1A,
+    0xF3, 0xEB, 0xF9, 0xDA, 0xF7, 0x55, 0x12, 0xFF, 0x58, 0xF3, 0x43, 0x0A, 0x9E, 0x8C, 0x85, 0xFC,
+    0x3B, 0xF5, 0xCE, 0xC9, 0x7D, 0xE7, 0x47, 0xBF, 0x3F, 0xCA, 0xFE, 0xBF, 0x49, 0x92, 0xAC, 0xFA,
+    0xFD, 0x7E, 0x8B, 0xEF, 0x62, 0xCC, 0x7D, 0xC0, 0xC6, 0x36, 0x01, 0xAB, 0x86, 0x56, 0x66, 0xD7,
+    0x12, 0xDF, 0xB9, 0x91, 0xBF, 0x4E, 0xB0, 0x15, 0x67, 0xE2, 0xFB, 0x96, 0x45, 0x75, 0x43, 0x8F,
+    0xB3, 0xA5, 0x8C, 0xE9, 0xA5, 0xAC, 0x6F, 0x5B, 0x71, 0x90, 0x62, 0xD8, 0xE9, 0x74, 0xB2, 0x7E,
+    0x86, 0x75, 0xFE, 0x01, 0x3B, 0x84, 0xF9, 0x7C, 0x4E, 0xFD, 0x7E, 0x3F, 0xFB, 0x77, 0xE9, 0x92,
+    0xE4, 0x63, 0x71, 0x5C, 0x51, 0x03, 0x50, 0x89, 0x00, 0xAC, 0xEF, 0xC1, 0xDE, 0xCF, 0x05, 0x32,
+    0xC4, 0xE6, 0xF1, 0x85, 0x18, 0x75, 0xFD, 0xAA, 0xC9, 0x5D, 0xB4, 0x6D, 0xD6, 0x22, 0xBF, 0xB5,
+    0x51, 0xE6, 0x58, 0xD6, 0x6E, 0x9F, 0x78, 0x24, 0x49, 0x62, 0xD6, 0xE3, 0x56, 0xFF, 0xC3, 0xB2,
+    0xBD, 0x49, 0x92, 0xE4, 0xB2, 0xAB, 0x8C, 0x47, 0xA7, 0xF3, 0xB0, 0xE2, 0x21, 0xC7, 0xDE, 0xDA,
+    0xC3, 0x20, 0x31, 0x9B, 0xCD, 0x72, 0x6E, 0x88, 0x5D, 0x83, 0x14, 0x05, 0xD9, 0xFF, 0x90, 0xF7,
+    0x07, 0xE4, 0xDE, 0x88, 0xBC, 0xF4, 0x3C, 0x0B, 0x4A, 0xC8, 0x4E, 0x4B, 0x08, 0x40, 0x80, 0x8D,
+    0x0B, 0x11, 0x81, 0xD0, 0x4C, 0xAF, 0xC9, 0xCF, 0xFB, 0xFD, 0x79, 0xB2, 0xCB, 0xB3, 0xC4, 0xCE,
+    0x6D, 0x99, 0x28, 0x24, 0x1E, 0xD6, 0xBD, 0x06, 0x5D, 0xA2, 0xA8, 0x6B, 0x5D, 0x7E, 0x7C, 0x29,
+    0xF1, 0x88, 0xA2, 0x88, 0xC6, 0xE3, 0xB1, 0xF3, 0xE2, 0x30, 0x9A, 0xA0, 0xDA, 0x15, 0xB0, 0x98,
+    0xF2, 0xD5, 0xA1, 0x18, 0x9D, 0x4E, 0x27, 0xB7, 0x04, 0xCA, 0x9F, 0xCD, 0xEF, 0x67, 0x91, 0x90,
+    0xCE, 0xE2, 0x92, 0x85, 0xE0, 0x51, 0x35, 0xCD, 0xA0, 0x98, 0xD2, 0x34, 0xC9, 0x9D, 0xA2, 0xC9,
+    0x83, 0x1C, 0x52, 0x0E, 0xF8, 0x8E, 0xF2, 0x73, 0xCA, 0x90, 0x7F, 0xF7, 0x12, 0x55, 0xC7, 0x6B,
+    0xEC, 0x1C, 0x12, 0x0F, 0xD7, 0xF6, 0x5E, 0xD7, 0x95, 0x7E, 0x2E, 0x3D, 0x1E, 0xE3, 0xF1, 0x98,
+    0x92, 0x24, 0xD9, 0xD9, 0xF7, 0xE0, 0xBB, 0x07, 0x84, 0x6B, 0x5F, 0x89, 0xDC, 0x4E, 0xCE, 0x42,
+    0x20, 0x77, 0x50, 0xF2, 0x8F, 0x14, 0x82, 0x5E, 0xAF, 0x57, 0xFA, 0xE4, 0xA8, 0x46, 0x3B, 0x80,
+    0x34, 0x4D, 0xE9, 0xE6, 0xE6, 0x86, 0xEE, 0xEF, 0xEF, 0xA9, 0xDD, 0x6E, 0x1F, 0xD4, 0x05, 0x77,
+    0x4D, 0x10, 0x1E, 0x34, 0xDF, 0x64, 0x97, 0x44, 0x3A, 0x65, 0x57, 0x77, 0x9F, 0x78, 0xB8, 0xB2,
+    0x75, 0x53, 0xE3, 0xC1, 0x42, 0x20, 0x77, 0x8D, 0x86, 0x9E, 0xEE, 0x2C, 0x85, 0x42, 0xAE, 0xA4,
+    0xF0, 0x3E, 0x0A, 0x7D, 0xE1, 0x12, 0xEB, 0xB9, 0x4B, 0xC6, 0xA3, 0xAA, 0x3E, 0x88, 0x55, 0x9E,
+    0x68, 0x7D, 0x45, 0x58, 0xAD, 0xF4, 0xA1, 0xCB, 0x31, 0xFC, 0x5A, 0x6D, 0x75, 0xF9, 0x67, 0x5D,
+    0xBF, 0x25, 0x94, 0xA6, 0xDB, 0xC9, 0x2E, 0x6B, 0xFE, 0x73, 0x99, 0xEC, 0x88, 0x47, 0xF5, 0xF1,
+    0xE0, 0x13, 0xC0, 0xD8, 0x0D, 0xE8, 0x63, 0xC8, 0xFF, 0x81, 0x1B, 0xAC, 0x96, 0xC8, 0x6A, 0xF2,
+    0x6F, 0x3E, 0xF7, 0xA2, 0x97, 0x04, 0x5F, 0xCA, 0x37, 0x54, 0xAE, 0x0E, 0x5A, 0x2A, 0xE2, 0x41,
+    0x1E, 0x0E, 0x89, 0x46, 0xA3, 0x11, 0x25, 0x49, 0x92, 0x3B, 0x3F, 0xBB, 0xEC, 0x9A, 0xAC, 0xBE,
+    0x84, 0x35, 0x37, 0x94, 0xB4, 0xAA, 0x5B, 0x93, 0xBD, 0x8A, 0x89, 0x8E, 0x78, 0x9C, 0x67, 0x3C,
+    0xA4, 0x1B, 0x90, 0x22, 0x50, 0x26, 0x6B, 0x5B, 0xCE, 0x40, 0x93, 0x9F, 0xEF, 0x19, 0xD1, 0xA8,
+    0x26, 0x60, 0x55, 0x83, 0xDC, 0xEB, 0x2D, 0xA8, 0xDF, 0xEF, 0x53, 0xAF, 0xD7, 0xA3, 0xE9, 0x74,
+    0x4A, 0xF7, 0xF7, 0xF7, 0xDE, 0xF7, 0x59, 0xA7, 0x89, 0xCA, 0x49, 0xEE, 0x1A, 0x38, 0x6B, 0x09,
+    0xA7, 0xCA, 0x2C, 0x87, 0x78, 0x9C, 0x67, 0x3C, 0xB8, 0x41, 0x27, 0x77, 0x93, 0x86, 0xDE, 0x49,
+    0xDA, 0x27, 0x06, 0x65, 0x1C, 0xC5, 0x45, 0x0A, 0x40, 0xA7, 0xB3, 0x0C, 0x1E, 0xE4, 0xD9, 0xEC,
+    0xCA, 0x5C, 0x77, 0x5F, 0x0F, 0xF2, 0x3D, 0x25, 0xC9, 0x76, 0x3D, 0x3A, 0xF4, 0x22, 0x96, 0xD6,
+    0x44, 0x0F, 0xC9, 0x70, 0x75, 0xD9, 0x5B, 0xC4, 0xE3, 0x7C, 0xE3, 0x21, 0xCF, 0x69, 0xD0, 0xDB,
+    0xCA, 0xAD, 0xB3, 0x1D, 0x43, 0xD0, 0x94, 0xCC, 0x5F, 0xE8, 0x00, 0xAA, 0x51, 0xFA, 0xAD, 0xAA,
+    0x87, 0x6E, 0xE1, 0x9E, 0xCF, 0xEF, 0x9D, 0xCA, 0x5C, 0xA7, 0xBD, 0x2D, 0xCA, 0x78, 0x88, 0xC7,
+    0xF9, 0xC5, 0x63, 0x7B, 0x13, 0xF2, 0x3C, 0xB4, 0x18, 0xB8, 0xB2, 0xBA, 0xBE, 0x54, 0xF9, 0xD5,
+    0xD5, 0x55, 0xAB, 0x29, 0xCD, 0x3F, 0x53, 0x00, 0x16, 0x8B, 0x45, 0x2B, 0x8A, 0xA2, 0x95, 0x1C,
+    0x64, 0xA2, 0xF4, 0xA0, 0x41, 0xDE, 0x4E, 0xD6, 0xFB, 0xBD, 0xEC, 0x98, 0x35, 0xC9, 0xF9, 0x58,
+    0x77, 0x43, 0x0B, 0xF1, 0x78, 0x38, 0xF1, 0x48, 0x92, 0x81, 0xB9, 0xDF, 0xC1, 0x12, 0x03, 0xA2,
+    0x75, 0x0F, 0x82, 0x31, 0x1C, 0x0E, 0x5B, 0xD4, 0x50, 0xEC, 0xDC, 0x1C, 0x94, 0xAF, 0xFD, 0xEE,
+    0x52, 0xFA, 0xFC, 0xE0, 0x13, 0xF5, 0x7A, 0x9D, 0xCA, 0x77, 0x4D, 0xF9, 0x26, 0x79, 0x5D, 0x19,
+    0xCE, 0x75, 0x33, 0x4C, 0xC4, 0xE3, 0x61, 0xC7, 0x43, 0xED, 0xE7, 0xCF, 0xA1, 0xCC, 0xB5, 0x0F,
+    0x1A, 0x71, 0x45, 0x20, 0x46, 0x14, 0x45, 0x2B, 0xAB, 0xE6, 0x73, 0x1D, 0x5D, 0x9B, 0x4D, 0x0E,
+    0x1D, 0xCC, 0x63, 0x66, 0x38, 0xD7, 0x84, 0x47, 0x3C, 0x10, 0x8F, 0x4B, 0x16, 0x80, 0x47, 0x2E,
+    0xAB, 0xE7, 0xAA, 0xF9, 0xB4, 0xC2, 0xEB, 0x41, 0x0A, 0x6B, 0x66, 0xA5, 0xC1, 0x83, 0xBB, 0xB6,
+    0x6B, 0xD3, 0xD6, 0x29, 0x37, 0xAF, 0x20, 0x1E, 0x88, 0x47, 0x63, 0x4A, 0x00, 0x09, 0x9F, 0xD2,
+    0xCB, 0xE7, 0xF3, 0x8D, 0x9D, 0xB4, 0xF4, 0xD1, 0x85, 0x63, 0x0E, 0xAA, 0x2F, 0xE3, 0x21, 0x1E,
+    0x88, 0x47, 0xA3, 0x4A, 0x00, 0xDF, 0x40, 0x6B, 0xE8, 0x4E, 0xF0, 0x43, 0x1A, 0xD4, 0xB2, 0x13,
+    0x1E, 0xF1, 0x40, 0x3C, 0x1A, 0x29, 0x00, 0xBE, 0x41, 0xB6, 0x96, 0x82, 0xCA, 0x9E, 0x85, 0x76,
+    0x0E, 0xF6, 0xAD, 0xCC, 0x84, 0x47, 0x3C, 0x10, 0x8F, 0xC6, 0x09, 0x80, 0xCF, 0xFA, 0x95, 0xC5,
+    0x39, 0xD6, 0x6B, 0x65, 0x27, 0x3C, 0xE2, 0xD1, 0xEC, 0x78, 0x34, 0x5A, 0x00, 0x2C, 0xB8, 0x6E,
+    0x1C, 0x79, 0xCE, 0x83, 0x5A, 0xD5, 0x84, 0x47, 0x3C, 0x9A, 0x17, 0x0F, 0x08, 0xC0, 0xA5, 0x05,
+    0xA2, 0xE2, 0x09, 0x8F, 0x78, 0x5C, 0x76, 0x3C, 0x2E, 0x05, 0x8F, 0x08, 0x00, 0x80, 0xC6, 0x02,
+    0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0x15, 0xD8, 0x07, 0xC0, 0x81, 0x50, 0xEB, 0xBC, 0x71, 0xC3, 0x6F, 0x1F,
+    0xAB, 0xB7, 0xE8, 0x22, 0x1E, 0xE9, 0x45, 0xFE, 0x5D, 0x58, 0x05, 0x00, 0x80, 0x06, 0x03, 0x02,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x70, 0xE1, 0x78, 0xE9, 0x94, 0x5F, 0xEE, 0xBB, 0x64, 0xB3, 0x44, 0x99, 0xCB, 0x37,
+    0x03, 0x00, 0x70, 0xA6, 0x02, 0xC0, 0x84, 0x97, 0x77, 0xB0, 0x0D, 0x41, 0x9A, 0xA6, 0xAB, 0xCD,
+    0x11, 0x62, 0x00, 0x00, 0x0F, 0x49, 0x00, 0x24, 0xE9, 0x2D, 0xC2, 0x0F, 0x06, 0xDD, 0xC2, 0xCF,
+    0x18, 0x8D, 0xA6, 0x99, 0x60, 0xA4, 0x69, 0xBA, 0x82, 0x10, 0x00, 0xC0, 0x19, 0x0B, 0x80, 0x8F,
+    0xF4, 0x2E, 0xC2, 0xBB, 0xBC, 0x40, 0x4A, 0xDB, 0x1B, 0x47, 0x4E, 0x36, 0x37, 0x90, 0x93, 0x42,
+    0x20, 0xEF, 0x94, 0x3B, 0x1A, 0x4D, 0x21, 0x0A, 0x00, 0x70, 0x2A, 0x01, 0x48, 0x92, 0x64, 0x15,
+    0x4A, 0x7A, 0x4D, 0xF8, 0xBE, 0x78, 0xDC, 0x99, 0xEC, 0xDE, 0x27, 0x7E, 0x36, 0x9B, 0xED, 0x7E,
+    0x46, 0x1C, 0x13, 0x51, 0x9F, 0x92, 0x64, 0xC0, 0xDF, 0xB3, 0x82, 0x10, 0x00, 0x40, 0x38, 0x2A,
+    0x39, 0x17, 0x80, 0x89, 0x2F, 0x71, 0x7D, 0x7D, 0x9D, 0xBF, 0x29, 0x84, 0x83, 0xF0, 0x9A, 0xEC,
+    0x16, 0xD1, 0x89, 0x88, 0xBA, 0xDD, 0xAD, 0x88, 0x4C, 0xA7, 0x53, 0xAB, 0x4F, 0x90, 0x09, 0x41,
+    0x1C, 0xC7, 0xA5, 0x45, 0x00, 0xE7, 0x02, 0xEC, 0xC6, 0x13, 0xF1, 0x70, 0xC7, 0x03, 0x02, 0xB0,
+    0x07, 0xF1, 0x35, 0xE9, 0x8B, 0xC8, 0xEE, 0xBA, 0x55, 0xB3, 0xBC, 0xD5, 0xB3, 0x16, 0x83, 0x34,
+    0x4D, 0x69, 0x38, 0x1C, 0x66, 0xF7, 0xA4, 0x0B, 0x15, 0x02, 0x08, 0x00, 0x04, 0x00, 0x02, 0x50,
+    0x03, 0xF1, 0x8B, 0x48, 0x2F, 0x33, 0xBB, 0x8F, 0xF4, 0x3E, 0x21, 0x60, 0x11, 0xE0, 0x1B, 0x4D,
+    0xEC, 0x23, 0x02, 0x10, 0x00, 0x08, 0x40, 0x13, 0x05, 0xA0, 0x54, 0x0F, 0xC0, 0xAA, 0xF1, 0x99,
+    0xF8, 0x9D, 0xCE, 0x2E, 0xF1, 0x25, 0xE9, 0x25, 0xF1, 0x25, 0xE9, 0x7D, 0x84, 0xEF, 0x39, 0x6E,
+    0x2A, 0x71, 0x27, 0xCA, 0x06, 0xFD, 0x7E, 0xF9, 0xFF, 0x1B, 0x0E, 0x87, 0x44, 0x94, 0xD2, 0x60,
+    0xD0, 0x5D, 0x3D, 0xC4, 0xBE, 0xC0, 0xF4, 0xDF, 0x7F, 0x96, 0xA9, 0x72, 0xF7, 0xA7, 0x9F, 0x37,
+    0xBE, 0xAF, 0x31, 0x1D, 0xC5, 0xDB, 0x78, 0x0C, 0x52, 0xF4, 0x79, 0x8E, 0x29, 0x00, 0x3A, 0xEB,
+    0x73, 0x67, 0xDE, 0x95, 0xF5, 0x3B, 0x93, 0x85, 0x97, 0xF4, 0xCB, 0xE5, 0x72, 0x87, 0xBC, 0x92,
+    0xF0, 0xAE, 0x1E, 0x41, 0xA8, 0x43, 0xE8, 0xF7, 0xFB, 0x0F, 0x52, 0x04, 0x24, 0xE9, 0xAD, 0xE7,
+    0x9B, 0x26, 0x04, 0x92, 0xF4, 0xD6, 0xF3, 0x10, 0x82, 0x9A, 0x4B, 0x80, 0x24, 0x49, 0x56, 0xBD,
+    0x5E, 0x2F, 0x23, 0x73, 0x08, 0xF1, 0xA5, 0xD5, 0xF7, 0x65, 0x7B, 0x9D, 0xE1, 0xFB, 0x81, 0x84,
+    0x97, 0x3D, 0x00, 0xAB, 0xAC, 0xE8, 0xB0, 0x1D, 0x21, 0xA2, 0xD7, 0x5F, 0x7F, 0x7D, 0xFD, 0x5D,
+    0xBD, 0x8E, 0xB7, 0x14, 0x38, 0x65, 0x09, 0x30, 0x9D, 0x7E, 0xB2, 0x0E, 0xFE, 0xF7, 0x5F, 0xE5,
+    0x9E, 0xFF, 0xFE, 0x4F, 0xCF, 0xE8, 0x95, 0xBF, 0x7A, 0x92, 0x1D, 0x73, 0xA5, 0x53, 0xCD, 0x42,
+    0x70, 0xCA, 0x12, 0x60, 0x3A, 0xED, 0xAF, 0x36, 0xFF, 0x89, 0x9D, 0xFF, 0x93, 0xBC, 0xAF, 0x60,
+    0x2E, 0x1E, 0x35, 0x0B, 0x41, 0x23, 0x7B, 0x00, 0x45, 0xE4, 0x3F, 0x94, 0xF8, 0x21, 0x84, 0xD7,
+    0x64, 0x67, 0x8C, 0xC7, 0xE3, 0xDC, 0xEF, 0x8B, 0xC5, 0xC2, 0x7C, 0x5D, 0x14, 0x45, 0x41, 0xFD,
+    0x80, 0x53, 0x08, 0x80, 0xCC, 0xF6, 0x9A, 0xEC, 0x16, 0xF9, 0x8F, 0x29, 0x04, 0xA7, 0x10, 0x00,
+    0x99, 0xED, 0x8B, 0xEE, 0x20, 0x2C, 0x5F, 0x73, 0x0C, 0x21, 0x68, 0x9C, 0x00, 0x14, 0x59, 0xFE,
+    0x10, 0xBB, 0x2F, 0xC9, 0xAC, 0xED, 0x3D, 0x13, 0xBF, 0x28, 0xC3, 0xF3, 0xE7, 0xF2, 0x00, 0x68,
+    0xA2, 0xCF, 0xE7, 0x73, 0xA7, 0x00, 0xC4, 0x71, 0x4C, 0x51, 0x14, 0x65, 0xA5, 0x40, 0xA7, 0xB3,
+    0x74, 0xDE, 0x83, 0xEE, 0x58, 0x02, 0x50, 0x86, 0xF4, 0x2E, 0x07, 0xA0, 0x7F, 0xAF, 0x43, 0x04,
+    0x8E, 0x25, 0x00, 0x65, 0x48, 0xEF, 0x72, 0x00, 0xFA, 0xF7, 0x3A, 0x44, 0xA0, 0x51, 0x4D, 0x40,
+    0x26, 0x7F, 0xA7, 0xD3, 0xA1, 0xD9, 0x6C, 0x96, 0x23, 0x7F, 0x1C, 0xC7, 0x44, 0x69, 0xEA, 0xCD,
+    0xFA, 0x21, 0xC4, 0x97, 0xAF, 0xB3, 0xB2, 0xFC, 0x6C, 0x36, 0xCB, 0x05, 0x5D, 0x12, 0x9C, 0x49,
+    0xAF, 0x33, 0xBD, 0x35, 0x68, 0x52, 0x04, 0x66, 0xB3, 0xAB, 0x93, 0x05, 0x7A, 0x3A, 0xFD, 0x64,
+    0x25, 0x2D, 0xBE, 0x45, 0x72, 0x7E, 0x5E, 0x1E, 0xAD, 0x92, 0x40, 0xBB, 0x80, 0x87, 0xD8, 0x1F,
+    0x98, 0x4E, 0xFB, 0x2B, 0x69, 0xF1, 0x2D, 0x92, 0x4B, 0xE2, 0x59, 0x04, 0xE4, 0xD7, 0x6A, 0x71,
+    0x42, 0x7F, 0xE0, 0x40, 0x07, 0x90, 0xA6, 0xE9, 0x8A, 0xEB, 0x68, 0x16, 0x00, 0x99, 0xF9, 0x43,
+    0xB2, 0xBE, 0x8F, 0xF8, 0x16, 0xD9, 0x2D, 0xA5, 0xB5, 0xB2, 0x3A, 0x93, 0xBF, 0xDD, 0x6E, 0x7B,
+    0xFF, 0x30, 0xE9, 0x0C, 0x58, 0x04, 0x86, 0xC3, 0x21, 0x2D, 0x16, 0x8B, 0xA3, 0x39, 0x80, 0xAC,
+    0xB6, 0x57, 0xF5, 0x3D, 0x93, 0x5B, 0x12, 0xFF, 0x4F, 0x5F, 0xFD, 0x27, 0xFD, 0xD5, 0xBB, 0x7F,
+    0x9B, 0xBD, 0x46, 0xFF, 0x2E, 0x5F, 0xAF, 0x4B, 0x82, 0x3A, 0x1C, 0x41, 0x1D, 0x0E, 0x20, 0xAB,
+    0xED, 0x55, 0x7D, 0xCF, 0xDF, 0xA5, 0x89, 0xEF, 0xCB, 0xF2, 0xF2, 0xF5, 0xBA, 0x24, 0xA8, 0xC3,
+    0x11, 0x34, 0xA6, 0x04, 0xE0, 0xBA, 0x5F, 0x93, 0x93, 0x77, 0xD9, 0xF1, 0x89, 0x39, 0x1C, 0x10,
+    0x5F, 0xD6, 0x0F, 0x25, 0x7E, 0x11, 0xE9, 0xF7, 0xC5, 0x60, 0x30, 0xA0, 0xE1, 0x70, 0x48, 0xED,
+    0x76, 0xFB, 0xA8, 0x02, 0xE0, 0x6A, 0xEA, 0x69, 0x01, 0xB0, 0x60, 0x11, 0xBF, 0x0C, 0xF9, 0xAB,
+    0x12, 0x81, 0x2A, 0x05, 0xC0, 0xD5, 0xD4, 0x0B, 0x21, 0x97, 0x45, 0xFC, 0x32, 0xE4, 0xAF, 0x4A,
+    0x04, 0x1A, 0x23, 0x00, 0x93, 0xC9, 0x64, 0xA5, 0x89, 0x2D, 0xFF, 0x78, 0xA9, 0xD2, 0xFB, 0x92,
+    0xDF, 0x55, 0xD7, 0x47, 0x51, 0x44, 0x8B, 0xC5, 0x62, 0xE7, 0x58, 0x84, 0xF9, 0x7C, 0x4E, 0xED,
+    0x76, 0x3B, 0x3B, 0xEA, 0xBE, 0xC5, 0x64, 0x32, 0xA1, 0xF9, 0x7C, 0x4E, 0xE3, 0xF1, 0xB8, 0x36,
+    0x01, 0x28, 0x93, 0xED, 0x5D, 0xA4, 0x77, 0x1D, 0x2D, 0xC8, 0xCF, 0xF3, 0xF5, 0x0B, 0xF6, 0x15,
+    0x82, 0x43, 0x05, 0xA0, 0x4C, 0xB6, 0x77, 0x91, 0xBE, 0xA8, 0xF6, 0xB7, 0x04, 0x41, 0x8B, 0x43,
+    0x55, 0x6E, 0xA0, 0x11, 0x97, 0x05, 0xEF, 0xF5, 0x7A, 0xAB, 0xED, 0x00, 0x4E, 0xB3, 0xFA, 0x5C,
+    0x5B, 0x31, 0x49, 0xFE, 0xDC, 0xFB, 0x3B, 0x4B, 0xEA, 0x13, 0xD1, 0x68, 0xBA, 0xA2, 0x78, 0xBA,
+    0xDA, 0x69, 0xF0, 0xF1, 0x86, 0xA0, 0x34, 0x4D, 0x69, 0x32, 0x99, 0xD0, 0x62, 0xB1, 0xD8, 0x9B,
+    0xFC, 0x6C, 0xF1, 0x35, 0xF9, 0xAD, 0xFE, 0x00, 0x0B, 0x41, 0x5D, 0xB5, 0x7D, 0x56, 0xDF, 0xF3,
+    0x8F, 0x87, 0xAC, 0x21, 0xE4, 0xD7, 0xCF, 0xFB, 0x5C, 0x84, 0x6F, 0xC5, 0x80, 0xFB, 0x03, 0xAE,
+    0xBD, 0x05, 0x75, 0xD5, 0xF6, 0x59, 0x7D, 0xCF, 0x3F, 0x1E, 0xB2, 0x86, 0x90, 0x5F, 0x3F, 0xEF,
+    0x23, 0xA8, 0x6F, 0xC5, 0x80, 0xFB, 0x03, 0xAE, 0xBD, 0x05, 0x4D, 0xC4, 0x23, 0x17, 0xB1, 0x58,
+    0x04, 0xE4, 0x36, 0xDB, 0xFC, 0x40, 0x4F, 0x4D, 0xF2, 0xC7, 0xD3, 0x55, 0x26, 0x1C, 0xDC, 0xDC,
+    0x93, 0x3B, 0x01, 0x27, 0x93, 0xC9, 0xCE, 0x20, 0xBA, 0xC8, 0x6F, 0x35, 0xF6, 0x5C, 0xA4, 0x77,
+    0x89, 0x80, 0xDC, 0x13, 0x50, 0x5B, 0x63, 0x4F, 0x65, 0x7C, 0xD9, 0xC8, 0xD3, 0x99, 0x5A, 0x93,
+    0xDF, 0x12, 0x01, 0x22, 0xDA, 0x11, 0x05, 0x29, 0x04, 0xF2, 0x71, 0xE8, 0x77, 0x1D, 0x43, 0x04,
+    0x72, 0xC4, 0x17, 0xC4, 0x74, 0x91, 0x58, 0xCF, 0x29, 0xEB, 0x75, 0xF2, 0xE2, 0x31, 0xF2, 0xF9,
+    0xD4, 0x70, 0x15, 0xAE, 0xCF, 0x30, 0xE7, 0x2F, 0x44, 0xC0, 0x16, 0x00, 0x2D, 0x02, 0x2E, 0xD2,
+    0xB2, 0x08, 0x64, 0x59, 0x3A, 0x8E, 0x33, 0xCB, 0x6F, 0x2D, 0xE3, 0x49, 0x2B, 0x2E, 0x6D, 0xBA,
+    0x8F, 0xFC, 0x2E, 0x11, 0x28, 0x22, 0x3F, 0x7F, 0xBE, 0x24, 0xBF, 0xDE, 0x37, 0x50, 0x27, 0xAC,
+    0xEE, 0xBE, 0x24, 0x2B, 0x13, 0x5A, 0x93, 0x3D, 0x24, 0xF3, 0xEB, 0xB2, 0x80, 0x89, 0xEE, 0x5B,
+    0x51, 0x90, 0x22, 0x70, 0x4C, 0x37, 0x60, 0xD5, 0xEB, 0x2E, 0xB2, 0x5A, 0x64, 0x0F, 0xCD, 0xFC,
+    0x92, 0xDC, 0x2E, 0xC1, 0xB0, 0x6C, 0x3C, 0xDC, 0x80, 0xEA, 0x01, 0xF4, 0x7A, 0xBD, 0xD5, 0xD7,
+    0x5F, 0x7F, 0x4D, 0x44, 0x44, 0x77, 0x77, 0x77, 0x19, 0xD9, 0x74, 0xB6, 0xE6, 0xE5, 0x41, 0x99,
+    0x65, 0xAD, 0x25, 0x3D, 0x99, 0xF5, 0xE7, 0xF3, 0x39, 0xC5, 0x71, 0x9C, 0xB3, 0xF5, 0x21, 0xE4,
+    0x77, 0xAD, 0x04, 0x84, 0x88, 0xC0, 0x7A, 0xF5, 0x22, 0xBF, 0x94, 0x59, 0x55, 0x0F, 0x40, 0x2F,
+    0xEB, 0x59, 0x8D, 0x39, 0x4B, 0x04, 0x34, 0xC1, 0x7D, 0x64, 0x97, 0x08, 0xED, 0x0D, 0x58, 0x0D,
+    0x43, 0x0B, 0x45, 0xBD, 0x81, 0xB2, 0x3D, 0x00, 0xBD, 0xAC, 0x57, 0x54, 0xCB, 0x5B, 0xAF, 0x29,
+    0x2A, 0x0F, 0x7C, 0xA2, 0xE2, 0xFB, 0xFF, 0x85, 0xBC, 0xA6, 0xA8, 0x37, 0xD0, 0x88, 0x1E, 0xC0,
+    0xD7, 0x5F, 0x7F, 0xBD, 0x39, 0xB1, 0x67, 0xB9, 0xD9, 0x43, 0xBF, 0x26, 0x9B, 0x74, 0x04, 0x8B,
+    0xC5, 0x7A, 0xF9, 0xAF, 0xD3, 0xE9, 0x64, 0x6B, 0xB0, 0xB2, 0xD6, 0xE7, 0xC7, 0x4C, 0xFE, 0xBB,
+    0xBB, 0xBB, 0x8C, 0x90, 0xFB, 0x90, 0xFF, 0x10, 0x07, 0x90, 0xA6, 0x29, 0xCD, 0x66, 0x33, 0x4A,
+    0x92, 0xA4, 0xD6, 0x20, 0xBA, 0xEA, 0x71, 0x9D, 0xF5, 0x2D, 0xC2, 0x87, 0x90, 0xDF, 0x55, 0x26,
+    0xC8, 0xF7, 0x5A, 0x1B, 0x85, 0x7C, 0xAB, 0x0D, 0x75, 0x3A, 0x01, 0x57, 0x3D, 0xAE, 0xB3, 0xBE,
+    0x45, 0xF8, 0x50, 0xA2, 0xF9, 0xEA, 0x7C, 0x2D, 0x58, 0x45, 0x2E, 0xA2, 0xC9, 0x25, 0x41, 0x4E,
+    0x00, 0xE4, 0xFE, 0x7E, 0x16, 0x01, 0x4B, 0x08, 0x58, 0x04, 0x2C, 0x2C, 0x97, 0x4B, 0x9A, 0xCD,
+    0x66, 0x34, 0x18, 0x74, 0x29, 0x49, 0x12, 0x8A, 0xA2, 0x28, 0x23, 0x24, 0x93, 0xB9, 0x0C, 0xF9,
+    0xF7, 0x75, 0x00, 0x72, 0x72, 0xB1, 0xFD, 0xEF, 0x38, 0xCE, 0x2E, 0xAC, 0xC2, 0xF2, 0x5B, 0x0E,
+    0x40, 0x67, 0x70, 0x6D, 0xE1, 0x7D, 0x59, 0xBC, 0xC8, 0x01, 0xE8, 0xF7, 0xCB, 0xEF, 0x0C, 0x71,
+    0x00, 0x75, 0x8A, 0x40, 0xC8, 0xD2, 0x9C, 0xB5, 0x9D, 0xB7, 0xCC, 0x4A, 0x83, 0x25, 0x2E, 0xAE,
+    0x7D, 0x03, 0x21, 0x0E, 0xA0, 0xA9, 0x22, 0xE0, 0xBD, 0x2F, 0x80, 0x74, 0x03, 0x52, 0x08, 0x58,
+    0x04, 0xD2, 0x34, 0xCD, 0x2C, 0xFF, 0x72, 0xB9, 0xCC, 0x32, 0xEE, 0x60, 0xD0, 0xA5, 0x38, 0xEE,
+    0x53, 0xBB, 0xDD, 0xCE, 0x91, 0xBF, 0x0C, 0xE9, 0x5D, 0x0E, 0xA0, 0x88, 0xFC, 0x52, 0x70, 0x74,
+    0xB3, 0xA8, 0x4A, 0xDC, 0xBE, 0xF9, 0x98, 0xE8, 0x95, 0x77, 0x0B, 0xED, 0x7F, 0x51, 0xC7, 0x3F,
+    0x54, 0x04, 0x74, 0x8F, 0xC0, 0xE5, 0x44, 0x42, 0x7A, 0x01, 0x75, 0x60, 0xD0, 0x1D, 0x10, 0x39,
+    0xB2, 0xAE, 0x8B, 0x80, 0x65, 0x96, 0xF9, 0x5C, 0x2E, 0xC3, 0xF7, 0x9E, 0xA2, 0xDD, 0x85, 0x40,
+    0xE0, 0x8D, 0x41, 0xB4, 0x10, 0xB0, 0x1B, 0x58, 0x2C, 0x16, 0x34, 0x9D, 0x4E, 0xB3, 0xAC, 0x4F,
+    0x44, 0x39, 0xF2, 0x33, 0xF1, 0x0F, 0x21, 0x3F, 0x1F, 0xA3, 0x28, 0xF2, 0x92, 0x9E, 0x77, 0xFB,
+    0x69, 0xD1, 0xE0, 0xC9, 0x51, 0x75, 0xF6, 0xFF, 0xF0, 0x49, 0x5E, 0x04, 0x7C, 0xCD, 0x38, 0x5F,
+    0x16, 0x97, 0xD9, 0xDC, 0x22, 0xB6, 0x76, 0x0B, 0xF2, 0xBD, 0xF2, 0x3B, 0x7D, 0xDF, 0xED, 0x73,
+    0x02, 0xB9, 0xFD, 0x0B, 0x07, 0xA0, 0x1F, 0xE7, 0x45, 0xC0, 0xD7, 0x8C, 0xF3, 0x65, 0x71, 0x99,
+    0xCD, 0x5D, 0x1B, 0x80, 0xAC, 0xCF, 0xF7, 0xFD, 0x9B, 0xFE, 0x6E, 0x9F, 0xC8, 0xE4, 0xF6, 0x2F,
+    0x34, 0xAD, 0x09, 0xD8, 0xED, 0xB6, 0xB2, 0x3F, 0xFE, 0xE6, 0xE6, 0x96, 0x88, 0x88, 0xEE, 0xEF,
+    0x9F, 0xEE, 0xBC, 0x69, 0x36, 0xBB, 0xDA, 0x69, 0x12, 0x46, 0x51, 0x64, 0x92, 0x5F, 0x62, 0x5F,
+    0xF2, 0xBB, 0xD6, 0xF7, 0x5D, 0xD0, 0xE7, 0x0D, 0x8C, 0xC7, 0xE3, 0x4C, 0x00, 0xAA, 0x3A, 0x19,
+    0xE8, 0x67, 0x3F, 0x48, 0x57, 0x1F, 0x3E, 0x21, 0xFA, 0xF4, 0x19, 0xD1, 0xD3, 0xFF, 0xF8, 0x7D,
+    0xB6, 0x14, 0xB8, 0x4F, 0x23, 0xD0, 0x12, 0x09, 0xAB, 0x5F, 0x10, 0xD2, 0xF8, 0x2B, 0x22, 0xFC,
+    0xEE, 0x1B, 0xDF, 0xA5, 0x6E, 0xF7, 0xE7, 0xAD, 0x43, 0x9B, 0x80, 0x31, 0xA5, 0xAB, 0x7E, 0x4C,
+    0x94, 0xA4, 0x44, 0xA3, 0xE9, 0x28, 0x5B, 0x0A, 0xDC, 0xA7, 0x11, 0x68, 0x89, 0x84, 0xD5, 0x2F,
+    0x08, 0x69, 0xFC, 0x95, 0x2D, 0x2D, 0x28, 0x8E, 0xA9, 0xDB, 0x4D, 0x0A, 0xE3, 0x71, 0xD1, 0x0E,
+    0xE0, 0xE6, 0xE6, 0x96, 0xE6, 0xF3, 0x7B, 0x9A, 0xCF, 0xEF, 0x33, 0x21, 0xD0, 0x8E, 0x40, 0x97,
+    0x04, 0x55, 0x92, 0x5F, 0x36, 0x0A, 0xCB, 0x92, 0x5F, 0xBA, 0x0E, 0x22, 0xAA, 0xAD, 0x01, 0xC8,
+    0xE4, 0xCF, 0x39, 0x81, 0x57, 0xDE, 0x0D, 0x76, 0x02, 0xF2, 0xB1, 0xB5, 0xF6, 0x6F, 0x39, 0x00,
+    0x5F, 0xE6, 0xE7, 0x63, 0x59, 0xF2, 0xFF, 0xD7, 0xED, 0xE3, 0x4A, 0xE2, 0xC1, 0xE4, 0xCF, 0x39,
+    0x01, 0x91, 0xC5, 0x8B, 0x9C, 0x80, 0x7C, 0xEC, 0xAB, 0xDD, 0x43, 0x33, 0xBF, 0xCF, 0x45, 0xF8,
+    0xC8, 0x9F, 0x0C, 0x06, 0x28, 0x01, 0x9E, 0x3E, 0x7D, 0x4A, 0x49, 0x92, 0x52, 0x92, 0xA4, 0x99,
+    0x08, 0x68, 0x21, 0x90, 0x22, 0xF0, 0xF4, 0xE9, 0xDF, 0x51, 0xBB, 0x7D, 0xE3, 0x24, 0x7F, 0xD9,
+    0x06, 0x20, 0x0F, 0x9A, 0xB5, 0xBD, 0xB7, 0x8C, 0x0B, 0x98, 0xCF, 0xE7, 0x74, 0x75, 0x75, 0x55,
+    0x5B, 0xF3, 0x4F, 0x8B, 0xC0, 0xF7, 0xB7, 0xF9, 0xBE, 0x80, 0xD5, 0x0B, 0x90, 0x8F, 0x7D, 0x44,
+    0xB7, 0x9A, 0x7D, 0x7C, 0x3C, 0xA4, 0xB6, 0xFF, 0xFE, 0x4F, 0xCF, 0x32, 0xB1, 0xBA, 0x7D, 0xF3,
+    0x71, 0xA5, 0xF1, 0xD0, 0x22, 0x90, 0x0E, 0xF2, 0x7D, 0x01, 0x1F, 0xA1, 0x5D, 0x8F, 0x7D, 0xCD,
+    0x3E, 0xDD, 0xFD, 0xDF, 0x27, 0x4B, 0xA7, 0x69, 0x9A, 0x89, 0xD5, 0xA0, 0xDB, 0x2C, 0xF2, 0x07,
+    0xF5, 0x00, 0x58, 0x04, 0x2C, 0x21, 0xE8, 0x74, 0x96, 0x34, 0x99, 0x4C, 0xA8, 0xDD, 0xBE, 0xC9,
+    0x11, 0xBC, 0x88, 0x98, 0x21, 0x76, 0xDF, 0xB5, 0xB4, 0x57, 0xC6, 0x05, 0x24, 0x49, 0x52, 0x1B,
+    0xF9, 0x2D, 0x11, 0xF8, 0xF4, 0x19, 0xE5, 0x44, 0xC0, 0x22, 0xBF, 0xAE, 0xCD, 0xE5, 0xBF, 0xBB,
+    0x08, 0xAF, 0x4B, 0x05, 0x2B, 0xE3, 0x5B, 0x1B, 0x8E, 0x72, 0x8F, 0xB9, 0x57, 0xF1, 0x37, 0xFF,
+    0x42, 0xB7, 0x6F, 0x3E, 0xA6, 0xDB, 0x37, 0x1F, 0xD3, 0xBB, 0x4F, 0xAA, 0x8F, 0x87, 0x14, 0x81,
+    0x24, 0xA5, 0x9C, 0x08, 0x58, 0xE4, 0xD7, 0x96, 0xDE, 0xDA, 0x76, 0xEE, 0x22, 0xBC, 0x25, 0x16,
+    0xD6, 0x6B, 0xCC, 0xC7, 0xFC, 0x9E, 0x7E, 0x9F, 0x06, 0xDD, 0x01, 0x0D, 0xBA, 0x03, 0x6A, 0xE2,
+    0x75, 0x4F, 0x83, 0x9A, 0x80, 0xD2, 0x0D, 0x68, 0xCC, 0xE7, 0xF7, 0xB9, 0xCE, 0x7B, 0x08, 0x31,
+    0xF7, 0x21, 0x7F, 0xD9, 0x32, 0xA0, 0x6E, 0x7C, 0xFA, 0xCC, 0x2D, 0x02, 0xB7, 0x6F, 0x3E, 0xA6,
+    0xEF, 0x3F, 0xFD, 0x88, 0x5E, 0xF9, 0x9B, 0x7F, 0x31, 0x6B, 0x75, 0x79, 0x94, 0x22, 0xA1, 0x6B,
+    0x7C, 0x2D, 0x08, 0xD6, 0x72, 0xA3, 0xE5, 0x2C, 0x76, 0x1E, 0x6F, 0xC8, 0x7F, 0x7B, 0xF3, 0x51,
+    0x2E, 0xEB, 0x7F, 0x55, 0xE1, 0xE2, 0x40, 0x92, 0xBA, 0x45, 0x60, 0xD0, 0x1D, 0x50, 0x9A, 0x24,
+    0x14, 0xF7, 0xFB, 0x85, 0x4D, 0x3D, 0xDF, 0xB2, 0xA0, 0x4F, 0x10, 0x7C, 0xFD, 0x81, 0x9D, 0xC7,
+    0x9B, 0xDF, 0x07, 0x83, 0x24, 0x97, 0xF5, 0x9B, 0xB8, 0x38, 0xF0, 0xC8, 0x51, 0x0A, 0x39, 0x85,
+    0x40, 0xA3, 0xDD, 0xBE, 0x29, 0x6D, 0xCD, 0xF7, 0x21, 0xBF, 0x14, 0x18, 0x3E, 0x89, 0x48, 0x9E,
+    0x4C, 0xA4, 0xBF, 0x63, 0x30, 0xA8, 0x57, 0xD1, 0x3F, 0xFF, 0xBF, 0xB8, 0xC5, 0x22, 0xC0, 0xE4,
+    0xD7, 0x82, 0x60, 0x11, 0x5F, 0xDB, 0x71, 0x5D, 0x26, 0xB8, 0x4A, 0x04, 0xAB, 0x97, 0x60, 0x65,
+    0x7F, 0x59, 0xDF, 0xF3, 0x91, 0x33, 0x3E, 0xE3, 0xDD, 0x27, 0xDB, 0x9F, 0xAA, 0x90, 0x52, 0xDC,
+    0xE2, 0xE9, 0xC1, 0xE4, 0xD7, 0x82, 0x50, 0xD4, 0x54, 0x74, 0x9D, 0x03, 0xE0, 0x22, 0xB2, 0xCB,
+    0x09, 0x98, 0xA5, 0x00, 0xBF, 0x77, 0x63, 0xF5, 0x25, 0xF1, 0x59, 0x13, 0xE0, 0x00, 0x02, 0x44,
+    0xC0, 0x5A, 0x15, 0x28, 0x6B, 0xCD, 0x2D, 0xF2, 0x73, 0xCD, 0xAF, 0x6B, 0x7F, 0x3E, 0xA6, 0x69,
+    0x6A, 0x12, 0x9E, 0x3F, 0x87, 0x7F, 0xD2, 0x34, 0xA5, 0xA7, 0x4F, 0x9F, 0x1E, 0x65, 0x30, 0x3F,
+    0xFF, 0xBF, 0xB8, 0xF5, 0xD3, 0xCF, 0xE3, 0x96, 0x74, 0x05, 0x92, 0xFC, 0x59, 0x39, 0x20, 0xFA,
+    0x02, 0x96, 0x18, 0xE8, 0x35, 0x7B, 0x4B, 0x0C, 0xAC, 0x8D, 0x3E, 0x4E, 0x71, 0x51, 0xE4, 0xB7,
+    0xF0, 0x55, 0x0D, 0x5B, 0x03, 0x52, 0x8A, 0x5B, 0x83, 0x74, 0x1B, 0x0F, 0xE9, 0x02, 0x88, 0x44,
+    0x39, 0xE0, 0xD8, 0x14, 0x64, 0x91, 0xDB, 0x25, 0x06, 0xAE, 0x73, 0x07, 0x4C, 0x71, 0x51, 0xE4,
+    0xB7, 0x7B, 0x01, 0xD4, 0x48, 0x3C, 0x2A, 0x68, 0x8A, 0x16, 0x42, 0x97, 0x05, 0x21, 0xE7, 0xEF,
+    0xFB, 0x76, 0xFA, 0x75, 0xBB, 0xDD, 0x6C, 0x8F, 0x01, 0x93, 0xDE, 0x3A, 0x7B, 0x50, 0x7E, 0xCE,
+    0xA9, 0xC1, 0x6E, 0xC0, 0x72, 0x01, 0xDF, 0xDF, 0x3E, 0xCE, 0xED, 0x17, 0x90, 0x67, 0x0B, 0x5A,
+    0xB6, 0xDD, 0xB5, 0x99, 0xC8, 0xE7, 0x14, 0x72, 0xC4, 0x17, 0x19, 0xDF, 0x22, 0x3F, 0x67, 0x7D,
+    0x3E, 0xFE, 0x5C, 0x08, 0x58, 0xD5, 0x6E, 0xC0, 0x72, 0x01, 0xE9, 0x60, 0x90, 0xDB, 0x2F, 0x20,
+    0x37, 0x6B, 0x85, 0x34, 0x01, 0x5D, 0x2B, 0x04, 0x66, 0xB7, 0x5F, 0x34, 0xF7, 0x74, 0xD6, 0x37,
+    0xB4, 0x61, 0x23, 0x5A, 0x71, 0xA3, 0x2E, 0x23, 0xE6, 0xDC, 0x07, 0x20, 0x07, 0x22, 0x49, 0x52,
+    0xA7, 0x18, 0xAC, 0x03, 0x1F, 0x67, 0x03, 0xC2, 0x1B, 0x73, 0xCA, 0x94, 0x01, 0xF2, 0x0A, 0x44,
+    0x8C, 0xD1, 0x68, 0x14, 0xDC, 0x3B, 0x60, 0x11, 0x98, 0xCF, 0xE7, 0xD9, 0xB2, 0x9F, 0xEB, 0xFF,
+    0x5B, 0xE7, 0x45, 0x41, 0x79, 0x6F, 0x80, 0x76, 0x03, 0xD6, 0x7E, 0x01, 0x2B, 0xB3, 0xFB, 0xCA,
+    0x03, 0xEF, 0xD6, 0x5E, 0xAE, 0xF1, 0x3D, 0x5D, 0x7D, 0x6D, 0xF7, 0x8B, 0x88, 0x5F, 0xC5, 0x15,
+    0x81, 0x78, 0x6F, 0x80, 0x76, 0x03, 0xD6, 0x7E, 0x01, 0x2B, 0xB3, 0xFB, 0xCA, 0x03, 0xEF, 0xAE,
+    0x41, 0xAE, 0xF1, 0x3D, 0x5D, 0x7D, 0xFD, 0xD6, 0x22, 0xE2, 0xE3, 0xCE, 0x40, 0x15, 0xA2, 0x88,
+    0xFC, 0x7C, 0xF6, 0x1E, 0x3B, 0x00, 0xE9, 0x2C, 0x42, 0xC8, 0x7F, 0x4A, 0x27, 0xF0, 0x21, 0xA5,
+    0x2B, 0xAB, 0x31, 0x98, 0xED, 0x17, 0xA0, 0x8D, 0x10, 0x10, 0x11, 0x7D, 0xFF, 0x95, 0x93, 0xD4,
+    0xAE, 0xB5, 0xFE, 0x1D, 0x9B, 0x5F, 0x31, 0xF1, 0xAB, 0x76, 0x02, 0xB4, 0x89, 0x87, 0x26, 0x7F,
+    0xB6, 0x5F, 0x80, 0x36, 0x42, 0xB0, 0xF1, 0xE1, 0xBE, 0x2B, 0xFE, 0x58, 0x47, 0x8B, 0xD1, 0x55,
+    0x12, 0xBF, 0xD1, 0x25, 0x40, 0xF0, 0x40, 0xA7, 0x49, 0xA6, 0xC8, 0x6C, 0xDF, 0x43, 0x44, 0x40,
+    0xC2, 0x75, 0xC7, 0x9F, 0xEB, 0xEB, 0xEB, 0xEC, 0xB5, 0xBE, 0x2B, 0xFB, 0xB4, 0xDB, 0x6D, 0xBA,
+    0xBD, 0xBD, 0x0D, 0x2E, 0x5D, 0xEA, 0xC2, 0x4F, 0x3F, 0xDF, 0x36, 0x07, 0x2D, 0x11, 0xD8, 0xD9,
+    0x33, 0xA0, 0xFA, 0x03, 0xD2, 0x01, 0x58, 0x8F, 0x75, 0x63, 0x4F, 0x93, 0x5F, 0x12, 0x5E, 0x3E,
+    0xFE, 0xF9, 0xE7, 0x71, 0xEB, 0x98, 0xE4, 0xCF, 0xC8, 0x98, 0x6E, 0x9B, 0x83, 0x96, 0x08, 0xEC,
+    0xEC, 0x19, 0xF0, 0xEC, 0xEB, 0x77, 0x66, 0x63, 0x8F, 0xCD, 0x97, 0x1F, 0x27, 0x1F, 0x27, 0x69,
+    0xDC, 0x6A, 0x3A, 0xF9, 0x6B, 0x75, 0x00, 0xBE, 0x2B, 0xFA, 0xE8, 0x7E, 0x01, 0x93, 0x5F, 0x5E,
+    0x7F, 0x50, 0x5E, 0xCC, 0x83, 0x6F, 0x4E, 0x92, 0xA6, 0x69, 0x6E, 0xA3, 0x10, 0xD1, 0xFA, 0x5A,
+    0x03, 0xEC, 0x00, 0xFA, 0xFD, 0xFE, 0xC1, 0x4D, 0xCA, 0xAA, 0x9C, 0x00, 0x3D, 0x5B, 0x97, 0x03,
+    0x5C, 0x12, 0xC8, 0xE6, 0x60, 0x26, 0x08, 0xF4, 0x78, 0x5B, 0x1A, 0x6C, 0x1C, 0x81, 0xD3, 0x0D,
+    0xE4, 0x6C, 0xFE, 0x47, 0x19, 0xC1, 0xB9, 0x99, 0xC7, 0x64, 0xFF, 0xEA, 0xD9, 0x2E, 0xF1, 0x4F,
+    0x1D, 0x8F, 0x75, 0x4F, 0x60, 0x5D, 0x0E, 0x70, 0x49, 0x20, 0x9B, 0x83, 0x99, 0x20, 0x0C, 0x06,
+    0xDB, 0xD2, 0xC0, 0xD3, 0x99, 0xCB, 0x2D, 0xE5, 0xA9, 0x6E, 0xBE, 0x5A, 0xE6, 0x27, 0xDE, 0xE7,
+    0x83, 0x8C, 0x5F, 0x6B, 0x0F, 0x80, 0x6B, 0xB4, 0x7E, 0xAE, 0x17, 0x60, 0x65, 0x7A, 0x0D, 0x2E,
+    0x01, 0x58, 0x04, 0xD2, 0x34, 0x35, 0x2F, 0xE3, 0xC5, 0xA7, 0xF4, 0x5A, 0x6B, 0xC3, 0x8B, 0xC5,
+    0x22, 0x73, 0x07, 0x32, 0x3B, 0xF0, 0x95, 0x8C, 0x8F, 0xD5, 0x03, 0x28, 0xEA, 0x0B, 0x30, 0x9C,
+    0xFD, 0x01, 0x4B, 0x04, 0x54, 0x7D, 0xCF, 0xA4, 0xB7, 0x8E, 0x55, 0x5A, 0xFD, 0xBA, 0x6E, 0x0C,
+    0x22, 0xFB, 0x02, 0x5B, 0x52, 0x3A, 0xFA, 0x03, 0x96, 0x08, 0x28, 0xE2, 0x33, 0xE9, 0xAD, 0x63,
+    0x95, 0x56, 0xBF, 0x11, 0x57, 0x05, 0xAE, 0x42, 0x00, 0x88, 0x88, 0x6E, 0x6E, 0x6E, 0xE8, 0xFE,
+    0xFE, 0xBE, 0x50, 0x04, 0x74, 0x1F, 0x80, 0x1D, 0x00, 0x7F, 0xA6, 0x3C, 0xCB, 0x90, 0xAF, 0xEC,
+    0x23, 0xEF, 0x57, 0xC0, 0x83, 0xC2, 0xEF, 0xD7, 0x37, 0x13, 0xF1, 0xD4, 0x91, 0xAD, 0x24, 0x49,
+    0x56, 0xFC, 0x5C, 0x1C, 0xC7, 0xAD, 0x3A, 0xEF, 0x0C, 0xF4, 0xB3, 0x1F, 0x6C, 0xFB, 0x02, 0x3E,
+    0x11, 0xF8, 0xF0, 0x09, 0xD1, 0x2B, 0x4F, 0x7F, 0x9F, 0x7B, 0xEF, 0x7F, 0xDD, 0x3E, 0xCE, 0x11,
+    0xDD, 0x25, 0x02, 0x55, 0x67, 0xFC, 0x3A, 0xEF, 0x0C, 0x14, 0x8B, 0xBE, 0x80, 0x4F, 0x04, 0xFA,
+    0x31, 0x51, 0xAC, 0x9A, 0xC1, 0xC9, 0x60, 0x90, 0x23, 0xBA, 0x4B, 0x04, 0xAA, 0xCE, 0xF8, 0x10,
+    0x80, 0x02, 0x01, 0x90, 0x22, 0x70, 0x77, 0x77, 0x47, 0xE3, 0xF1, 0x38, 0xE7, 0x04, 0x5C, 0x42,
+    0xC0, 0x9B, 0x76, 0x5C, 0x3D, 0x00, 0xE9, 0x08, 0xE4, 0x5D, 0x85, 0x93, 0x24, 0xC9, 0x35, 0x10,
+    0xF9, 0xDF, 0x66, 0xB3, 0x19, 0x75, 0xBB, 0x5D, 0x1A, 0x8D, 0x46, 0xE6, 0xEE, 0x32, 0x7D, 0xBA,
+    0x69, 0x92, 0x24, 0x14, 0xC7, 0x31, 0x75, 0xBB, 0xDD, 0x56, 0x5D, 0x13, 0xBE, 0xC8, 0x11, 0x48,
+    0x51, 0xB0, 0xCA, 0x85, 0x3F, 0x91, 0x4D, 0xFE, 0x3A, 0x9B, 0x7B, 0xC7, 0xBA, 0x35, 0x98, 0xE5,
+    0x08, 0xA4, 0x28, 0x58, 0xE5, 0x42, 0x4A, 0x36, 0xF9, 0xEB, 0x6C, 0xEE, 0x35, 0x42, 0x00, 0xA2,
+    0x28, 0x5A, 0xE9, 0xBD, 0xF3, 0x65, 0x04, 0x40, 0x8A, 0xC0, 0x68, 0x34, 0xA2, 0x24, 0x49, 0xB2,
+    0xC0, 0xB9, 0xB6, 0x0A, 0xB3, 0x28, 0xF4, 0x7A, 0x3D, 0x53, 0x04, 0x5C, 0x17, 0x92, 0x90, 0xD7,
+    0x21, 0xD4, 0x83, 0x64, 0xDD, 0x30, 0xA2, 0xD3, 0xE9, 0xE4, 0xCA, 0x08, 0xFE, 0x9D, 0x5F, 0x77,
+    0x2C, 0x01, 0x90, 0x8E, 0x40, 0xBB, 0x02, 0xED, 0x0E, 0x98, 0xF8, 0xFC, 0xF8, 0x98, 0x35, 0xFE,
+    0x31, 0x6F, 0x0E, 0xCA, 0x8E, 0x40, 0xBB, 0x02, 0xED, 0x0E, 0x98, 0xF8, 0xFC, 0xF8, 0x98, 0x35,
+    0x7E, 0x63, 0x96, 0x01, 0x67, 0xB3, 0xC3, 0xCE, 0x9E, 0x5B, 0xF7, 0x00, 0x12, 0xEA, 0xF5, 0x16,
+    0xD4, 0xEF, 0xF7, 0xA9, 0xD7, 0xEB, 0xD1, 0x74, 0x3A, 0xA5, 0xFB, 0xFB, 0x7B, 0xF3, 0xF5, 0x7C,
+    0xB1, 0xD0, 0x22, 0xDB, 0xAE, 0x21, 0xC9, 0x2F, 0x1B, 0x87, 0xE3, 0xF1, 0x38, 0xD7, 0x34, 0x94,
+    0x99, 0xDE, 0x45, 0xFE, 0x93, 0x34, 0x09, 0x19, 0xCF, 0xF2, 0x8E, 0x40, 0x97, 0x04, 0xEF, 0x6E,
+    0x1E, 0xEB, 0xCC, 0x7F, 0x0E, 0xCD, 0xBD, 0x2A, 0x9B, 0x84, 0x5B, 0x02, 0xE7, 0x1D, 0x81, 0x2E,
+    0x09, 0x68, 0xF3, 0x58, 0x67, 0x7E, 0x34, 0xF7, 0x2A, 0x74, 0x00, 0x52, 0x04, 0x7C, 0x0E, 0x60,
+    0x36, 0xBB, 0xA2, 0x5E, 0xAF, 0xE3, 0x54, 0x4C, 0x79, 0x9E, 0x40, 0xC8, 0xCD, 0x39, 0x74, 0x43,
+    0xB0, 0x8C, 0x3A, 0x4B, 0x47, 0xC0, 0xBB, 0xCB, 0xD8, 0x55, 0xB0, 0xCD, 0xD7, 0x2E, 0x40, 0xF6,
+    0x16, 0x8E, 0xE9, 0x00, 0x8A, 0xCA, 0x02, 0xBD, 0xA5, 0x98, 0xAD, 0xFF, 0x31, 0x89, 0x7F, 0x8A,
+    0xDB, 0x83, 0xBB, 0xCA, 0x02, 0xBD, 0xA5, 0x58, 0xF4, 0x02, 0x8F, 0x46, 0xFC, 0xC6, 0x39, 0x80,
+    0x6A, 0x9C, 0xC0, 0x36, 0xEB, 0x6F, 0x56, 0xEB, 0xBC, 0x98, 0x4C, 0x26, 0x7B, 0x6F, 0xE6, 0xD1,
+    0xAB, 0x08, 0xBE, 0x7B, 0xC8, 0xB3, 0x18, 0xE8, 0xDB, 0x9E, 0x9D, 0x0A, 0xBC, 0x6C, 0xC8, 0x25,
+    0x81, 0x6E, 0x0E, 0x5E, 0x5A, 0xC6, 0x0F, 0x71, 0x04, 0x49, 0xBA, 0x6D, 0x14, 0xEA, 0xE6, 0x20,
+    0x32, 0x7E, 0x4D, 0x0E, 0x60, 0x53, 0x93, 0xAF, 0xD6, 0x99, 0x71, 0x2B, 0x02, 0x56, 0x93, 0xA5,
+    0xC8, 0x01, 0xEC, 0xAB, 0xA0, 0x13, 0xE3, 0xF6, 0xE1, 0x65, 0xC0, 0x17, 0x29, 0x95, 0x2B, 0x0A,
+    0x2C, 0x0A, 0x72, 0x45, 0x41, 0x3A, 0x83, 0xBA, 0x57, 0x01, 0xF6, 0xED, 0x0F, 0xEC, 0x94, 0x0B,
+    0xC7, 0x24, 0xE1, 0x09, 0x1D, 0x80, 0xAB, 0x3F, 0xA0, 0xCB, 0x85, 0x53, 0xC6, 0xE3, 0x62, 0x1D,
+    0x80, 0x26, 0xFF, 0x6C, 0x76, 0x45, 0x71, 0xBC, 0x34, 0x1D, 0x82, 0xAF, 0x51, 0x17, 0x5A, 0xCB,
+    0x6B, 0x0C, 0x87, 0xD7, 0x74, 0x77, 0x37, 0xC9, 0x11, 0x3A, 0x54, 0x08, 0x74, 0x29, 0xC0, 0xAB,
+    0x07, 0xF2, 0x6C, 0x31, 0x4D, 0xFE, 0x3A, 0x6F, 0x1D, 0x76, 0x70, 0x7F, 0x00, 0x38, 0x19, 0xE1,
+    0x9B, 0x82, 0x9D, 0xAD, 0xC0, 0x8B, 0xC5, 0xA2, 0xC5, 0xE4, 0xD6, 0x64, 0xB7, 0xCA, 0x83, 0x90,
+    0x9B, 0x2E, 0x84, 0x28, 0xAB, 0x3C, 0x0E, 0x87, 0xD7, 0xB9, 0x6C, 0x5E, 0xA6, 0xEC, 0x90, 0xA5,
+    0xC0, 0xAE, 0xB0, 0x75, 0x72, 0xCE, 0x60, 0xF3, 0x3B, 0x26, 0x18, 0x00, 0x01, 0xD0, 0x22, 0xE0,
+    0xEA, 0x09, 0xF8, 0x1C, 0x40, 0x91, 0x08, 0x58, 0x64, 0x77, 0x5D, 0x31, 0x76, 0x38, 0xBC, 0xCE,
+    0x9D, 0x11, 0x58, 0x56, 0x0C, 0x74, 0x09, 0x21, 0x9D, 0x81, 0xEC, 0x01, 0x00, 0x00, 0x04, 0x60,
+    0x0F, 0x11, 0xB0, 0xC8, 0xED, 0xBB, 0x05, 0x54, 0xD1, 0xE5, 0xA1, 0xAD, 0xE3, 0xFD, 0xFD, 0x53,
+    0x1A, 0x8D, 0x46, 0xD9, 0x25, 0xC8, 0xCB, 0xBA, 0x81, 0x32, 0x3D, 0x10, 0x00, 0x68, 0x22, 0xBC,
+    0x27, 0x03, 0xB1, 0x08, 0x44, 0x51, 0xB4, 0x92, 0x65, 0x80, 0x2F, 0xC3, 0xBB, 0x48, 0x1E, 0x7A,
+    0x87, 0x16, 0x6B, 0xAF, 0xFE, 0x60, 0xD0, 0x5D, 0x11, 0x0D, 0x4A, 0xF5, 0x03, 0xAC, 0xFF, 0x97,
+    0xEA, 0x2B, 0x80, 0xFC, 0x00, 0x1C, 0x40, 0xC8, 0x8B, 0x5C, 0x77, 0xD4, 0x0D, 0x15, 0x01, 0x2B,
+    0xC3, 0x6B, 0xD2, 0xF3, 0x8F, 0xF5, 0x99, 0xA3, 0xD1, 0xB4, 0xC5, 0xE5, 0xC0, 0x3E, 0xA5, 0x80,
+    0x26, 0x3F, 0x00, 0x00, 0xCA, 0x02, 0xF3, 0x32, 0x60, 0x08, 0x78, 0xA9, 0x70, 0x5D, 0x5B, 0x97,
+    0x27, 0x94, 0x8B, 0xE8, 0x45, 0x48, 0x92, 0x64, 0xA5, 0xF7, 0xFF, 0x97, 0x81, 0x58, 0x22, 0xDC,
+    0xF9, 0xFE, 0x73, 0x59, 0x06, 0x3C, 0x17, 0x9C, 0xCB, 0x32, 0xE0, 0xB9, 0xC6, 0xA3, 0x11, 0x25,
+    0x40, 0x19, 0x47, 0x60, 0x9D, 0x48, 0x54, 0x05, 0xE9, 0x25, 0xFA, 0xFD, 0x7E, 0xEB, 0xEE, 0xEE,
+    0x6E, 0xC5, 0x67, 0x10, 0xEE, 0x53, 0x12, 0xC0, 0xFA, 0x03, 0xC0, 0x81, 0x0E, 0xE0, 0xD4, 0xB8,
+    0xBB, 0xBB, 0x5B, 0xAD, 0x7B, 0x03, 0x83, 0xDC, 0x19, 0x82, 0xFB, 0x66, 0x7F, 0x38, 0x00, 0x38,
+    0x00, 0x38, 0x80, 0x07, 0x84, 0xE1, 0x70, 0xD8, 0x62, 0x21, 0x18, 0x14, 0xDC, 0xCB, 0xAD, 0x88,
+    0xF8, 0x00, 0xD0, 0x64, 0xBC, 0xF4, 0x90, 0xFF, 0xF3, 0xC3, 0xE1, 0xB0, 0xC5, 0x6E, 0x80, 0x2F,
+    0x15, 0x26, 0x77, 0xF6, 0xB1, 0x2B, 0x18, 0x8D, 0x46, 0xD9, 0x7D, 0x0C, 0x01, 0x00, 0xB8, 0x10,
+    0x01, 0x90, 0x6E, 0x40, 0x96, 0x06, 0xBE, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xD3, 0x90, 0x35, 0xC7, 0xB0, 0xCE, 0x8B, 0x75, 0x6F, 0x5F,
+    0x3C, 0x80, 0xCB, 0xC4, 0x23, 0x84, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x99, 0xE3,
+    0xAC, 0xAE, 0x09, 0x38, 0xFD, 0xCD, 0x0F, 0xB3, 0x6B, 0xFA, 0x75, 0xFF, 0xE1, 0x2F, 0x8D, 0xBF,
+    0x8E, 0xDF, 0xF4, 0xD7, 0x7F, 0xDE, 0xC6, 0xE3, 0x1F, 0x7F, 0x8C, 0xEB, 0x1A, 0x02, 0x97, 0x27,
+    0x00, 0x92, 0xF4, 0xD6, 0xF3, 0x4D, 0x13, 0x02, 0x49, 0x7A, 0xEB, 0x79, 0x08, 0x01, 0xF0, 0xE0,
+    0x4B, 0x80, 0xE9, 0xF4, 0xC9, 0x6A, 0x3A, 0x7D, 0xB2, 0xD2, 0xE4, 0x7F, 0xFE, 0xE5, 0x77, 0xB9,
+    0x23, 0x0B, 0x81, 0x4B, 0x24, 0x2E, 0x86, 0xF4, 0xD3, 0xC7, 0xAB, 0xE9, 0xF4, 0xF1, 0x4A, 0x93,
+    0xFF, 0xDB, 0xCF, 0x5E, 0xE4, 0x8E, 0x2C, 0x04, 0x2E, 0x91, 0x00, 0x80, 0xB3, 0x16, 0x80, 0x8C,
+    0xCC, 0xCF, 0xBF, 0xA1, 0xE7, 0xBF, 0xFC, 0x74, 0x87, 0xF4, 0x6F, 0xFC, 0xE4, 0xB5, 0xEC, 0xD8,
+    0x04, 0x21, 0xC8, 0xC8, 0xFC, 0xED, 0x17, 0xF4, 0xED, 0x2F, 0x3E, 0xDB, 0x21, 0xFD, 0x5B, 0xEF,
+    0xBF, 0x9C, 0x1D, 0x21, 0x04, 0xC0, 0x83, 0x14, 0x00, 0x26, 0xEE, 0xF4, 0x37, 0x3F, 0x5C, 0xB9,
+    0xC8, 0x6E, 0x1D, 0x89, 0xC8, 0x29, 0x04, 0x97, 0x40, 0xFA, 0xE9, 0xAF, 0xFF, 0xBC, 0x72, 0x91,
+    0xDD, 0x3A, 0x12, 0x91, 0x53, 0x08, 0x30, 0x8D, 0x81, 0xB3, 0x13, 0x00, 0x6D, 0xF1, 0x5D, 0x24,
+    0xB7, 0x6C, 0xBF, 0x2E, 0x09, 0x58, 0x08, 0x1E, 0xB2, 0x1B, 0xD0, 0x16, 0xDF, 0x45, 0x72, 0xCB,
+    0xF6, 0xEB, 0x92, 0x80, 0x85, 0x00, 0x6E, 0x00, 0x38, 0x2B, 0x01, 0xC8, 0x6A, 0xFB, 0xE9, 0x93,
+    0x15, 0x3D, 0xFF, 0x66, 0x87, 0xC8, 0xF2, 0xF7, 0x2F, 0xBF, 0x99, 0xE7, 0x9E, 0xE3, 0xDF, 0x2D,
+    0x97, 0xE0, 0xEA, 0x11, 0x9C, 0xBB, 0x10, 0x64, 0xB5, 0xFD, 0xF4, 0xF1, 0x8A, 0xBE, 0xFD, 0x62,
+    0x87, 0xC8, 0xF2, 0xF7, 0xCF, 0xBE, 0xC8, 0x3F, 0xC7, 0xBF, 0x5B, 0x2E, 0xC1, 0xD5, 0x23, 0x80,
+    0x10, 0x00, 0x65, 0x51, 0xC9, 0x55, 0x81, 0xA7, 0xD3, 0x27, 0xEB, 0x49, 0x27, 0x48, 0x6F, 0x65,
+    0x72, 0x0B, 0x5F, 0x7E, 0x33, 0xA7, 0x9F, 0xBC, 0xDD, 0xDE, 0x79, 0xDE, 0xEA, 0x07, 0xE8, 0xE7,
+    0x24, 0x0E, 0x5D, 0x2D, 0xA8, 0xF2, 0xAA, 0xC0, 0xD3, 0xE9, 0xE3, 0x75, 0x3C, 0x04, 0xE9, 0xAD,
+    0x4C, 0x6E, 0xE1, 0xB3, 0x2F, 0x5E, 0xD0, 0xFB, 0xEF, 0xBD, 0xBC, 0xF3, 0xBC, 0xD5, 0x0F, 0xD0,
+    0xCF, 0xE5, 0xE2, 0x71, 0xE0, 0x6A, 0x01, 0xAE, 0x0A, 0x0C, 0x07, 0x50, 0x2E, 0xDB, 0x6F, 0xC8,
+    0xFF, 0xFC, 0xCB, 0xEF, 0x72, 0x99, 0xDA, 0x22, 0x3F, 0x67, 0x7B, 0x26, 0xBF, 0xFC, 0xDD, 0xCA,
+    0xF6, 0x0F, 0xC1, 0x0D, 0xEC, 0x64, 0xFB, 0x0D, 0xF9, 0xBF, 0xFD, 0xEC, 0x45, 0x2E, 0x53, 0x5B,
+    0xE4, 0xE7, 0x6C, 0xCF, 0xE4, 0x97, 0xBF, 0x5B, 0xD9, 0x1E, 0x6E, 0x00, 0x38, 0x99, 0x03, 0x08,
+    0xC9, 0xF6, 0x9A, 0xAC, 0x56, 0xC6, 0xD7, 0xE4, 0x27, 0xA2, 0xDC, 0xF3, 0x2E, 0x58, 0x4D, 0x43,
+    0xF9, 0xBD, 0xFB, 0x3A, 0x82, 0x7D, 0x1D, 0x40, 0x48, 0xB6, 0xD7, 0x64, 0xB5, 0x32, 0xBE, 0x26,
+    0x3F, 0x11, 0xE5, 0x9E, 0x77, 0xC1, 0x6A, 0x1A, 0xCA, 0xEF, 0xDD, 0xD7, 0x11, 0xC0, 0x01, 0xC0,
+    0x01, 0xD8, 0xE4, 0x17, 0xD9, 0xDE, 0xCA, 0xF8, 0x56, 0x17, 0xDF, 0x97, 0xF9, 0x99, 0xEC, 0x5A,
+    0x14, 0xA4, 0x30, 0xB8, 0x9C, 0x81, 0xEF, 0xBB, 0x8E, 0xE1, 0x06, 0x74, 0xB6, 0xB7, 0x32, 0xBE,
+    0xD5, 0xC5, 0xF7, 0x65, 0x7E, 0x26, 0xBB, 0x16, 0x05, 0x29, 0x0C, 0x2E, 0x67, 0xE0, 0xFB, 0x2E,
+    0xB8, 0x01, 0xA0, 0xD2, 0x12, 0xC0, 0x97, 0x95, 0x35, 0x59, 0x99, 0xD0, 0x9A, 0xEC, 0x56, 0x19,
+    0x50, 0xD4, 0x23, 0x60, 0xA2, 0xFB, 0x56, 0x14, 0xA4, 0x08, 0x9C, 0xA2, 0x2C, 0xB0, 0xBA, 0xFB,
+    0x92, 0xAC, 0x4C, 0x68, 0x4D, 0x76, 0xAB, 0x0C, 0x28, 0xEA, 0x11, 0x30, 0xD1, 0x7D, 0x2B, 0x0A,
+    0x52, 0x04, 0x20, 0x04, 0xC0, 0x5E, 0x25, 0x80, 0xEE, 0xEC, 0x5B, 0x8D, 0x39, 0x4B, 0x04, 0x34,
+    0xC1, 0x7D, 0x64, 0x97, 0xD0, 0x8E, 0x20, 0xB4, 0x2C, 0x70, 0xA1, 0xA8, 0x24, 0x28, 0x5B, 0x02,
+    0xE8, 0xCE, 0xBE, 0xD5, 0x98, 0xB3, 0x44, 0x40, 0x13, 0xDC, 0x47, 0x76, 0x09, 0xED, 0x08, 0x42,
+    0xCB, 0x02, 0x67, 0x3C, 0x0A, 0x4A, 0x02, 0x94, 0x00, 0x70, 0x00, 0x4E, 0x48, 0xDB, 0xED, 0xCA,
+    0xC2, 0x2E, 0xC2, 0x87, 0x90, 0xDF, 0x55, 0x26, 0xC8, 0xF7, 0x4A, 0xB2, 0x17, 0xF5, 0x1D, 0xEA,
+    0x2E, 0x09, 0xA4, 0xED, 0x76, 0x65, 0x61, 0x17, 0xE1, 0x43, 0xC8, 0xEF, 0x2A, 0x13, 0xE4, 0x7B,
+    0x25, 0xD9, 0x8B, 0xFA, 0x0E, 0x28, 0x09, 0x80, 0x83, 0x04, 0x20, 0x64, 0x69, 0x4E, 0x92, 0x56,
+    0x5A, 0xFF, 0x50, 0x58, 0x8D, 0x42, 0xF9, 0x7E, 0xF9, 0x9D, 0x21, 0x0E, 0xA0, 0x4E, 0x11, 0x08,
+    0x59, 0x9A, 0x93, 0xA4, 0x95, 0xD6, 0x3F, 0x14, 0x56, 0xA3, 0x50, 0xBE, 0x5F, 0x7E, 0x67, 0x88,
+    0x03, 0x80, 0x08, 0x00, 0xA5, 0x04, 0xE0, 0x9D, 0xCE, 0xC7, 0x44, 0x6F, 0xBC, 0x5D, 0x68, 0xFF,
+    0x7D, 0x59, 0xBC, 0xC8, 0xCA, 0xEB, 0xF7, 0x5A, 0x3D, 0x80, 0xA2, 0x12, 0xC4, 0xEA, 0x05, 0xD4,
+    0x81, 0x57, 0x7F, 0xF4, 0x09, 0xD1, 0x5B, 0xEF, 0x15, 0xDA, 0x7F, 0x5F, 0x16, 0x2F, 0xB2, 0xF2,
+    0xFA, 0xBD, 0x56, 0x0F, 0xA0, 0xA8, 0x04, 0xB1, 0x7A, 0x01, 0x00, 0x50, 0x5A, 0x00, 0xFE, 0xF9,
+    0xB5, 0xBC, 0x08, 0xF8, 0x9A, 0x71, 0xBE, 0x2C, 0x2E, 0xB3, 0xB9, 0x45, 0x6C, 0xED, 0x16, 0xE4,
+    0x7B, 0xE5, 0x77, 0xFA, 0xBE, 0xDB, 0xE7, 0x04, 0xB2, 0x65, 0xCC, 0x03, 0xF1, 0x6F, 0x2F, 0xE7,
+    0x45, 0xC0, 0xD7, 0x8C, 0xF3, 0x65, 0x71, 0x99, 0xCD, 0x2D, 0x62, 0x6B, 0xB7, 0x20, 0xDF, 0x2B,
+    0xBF, 0xD3, 0xF7, 0xDD, 0x3E, 0x27, 0x90, 0x2D, 0x63, 0x02, 0x10, 0x00, 0x1F, 0x3E, 0xFA, 0x6E,
+    0x57, 0x04, 0x5C, 0x65, 0x80, 0x24, 0xA0, 0x2B, 0xF3, 0xEB, 0x95, 0x01, 0x4D, 0x76, 0xAB, 0x74,
+    0xF0, 0x6D, 0x13, 0x7E, 0xE3, 0x27, 0xAF, 0x15, 0x96, 0x00, 0x55, 0xE2, 0x83, 0x17, 0xBB, 0x22,
+    0xE0, 0x2A, 0x03, 0x24, 0x01, 0x5D, 0x99, 0x5F, 0xAF, 0x0C, 0x68, 0xB2, 0x5B, 0xA5, 0x83, 0x6F,
+    0x9B, 0xF0, 0x5B, 0xEF, 0xBF, 0x5C, 0x58, 0x02, 0x00, 0x40, 0x29, 0x07, 0xB0, 0x23, 0x02, 0x6F,
+    0xBC, 0x1D, 0xEC, 0x04, 0xE4, 0x63, 0x6B, 0xED, 0xDF, 0x72, 0x00, 0xBE, 0xCC, 0xBF, 0x17, 0xE9,
+    0xDF, 0x78, 0x9B, 0x7E, 0xF9, 0xCE, 0xC7, 0x95, 0x04, 0xEE, 0xDF, 0x5E, 0x36, 0x44, 0xE0, 0xAD,
+    0xF7, 0x82, 0x9D, 0x80, 0x7C, 0x6C, 0xAD, 0xFD, 0x5B, 0x0E, 0xC0, 0x97, 0xF9, 0xF7, 0x22, 0xFD,
+    0x5B, 0xEF, 0xD1, 0x2F, 0x5E, 0xFD, 0x04, 0x2C, 0x68, 0x30, 0x82, 0x97, 0x01, 0x7F, 0xF3, 0xC3,
+    0x74, 0x25, 0x9D, 0x00, 0x1F, 0xDF, 0xF8, 0xED, 0xC7, 0x3B, 0x1B, 0x83, 0xF4, 0x06, 0x9D, 0xA2,
+    0x9A, 0xBC, 0x6C, 0x8F, 0xA0, 0x0C, 0xE9, 0x9F, 0x7F, 0xF9, 0x1D, 0xBD, 0xF1, 0x4F, 0x1F, 0x66,
+    0x7D, 0x8C, 0xB7, 0x5F, 0x23, 0x7A, 0xF6, 0x97, 0x78, 0x67, 0x09, 0xAC, 0xEC, 0x32, 0xE0, 0xAF,
+    0xFF, 0xBC, 0x8E, 0x07, 0x8B, 0x00, 0x1F, 0xDF, 0xFA, 0xE3, 0xCF, 0x77, 0x36, 0x06, 0xE9, 0x0D,
+    0x3A, 0x45, 0x35, 0x79, 0xD9, 0x1E, 0x41, 0x19, 0xD2, 0x7F, 0xFB, 0xD9, 0x0B, 0x7A, 0xEB, 0x5F,
+    0xDF, 0xCF, 0xFA, 0x18, 0xEF, 0xBD, 0x4C, 0xF4, 0xFB, 0x1F, 0x17, 0xC7, 0x03, 0x68, 0xB8, 0x03,
+    0xB0, 0x9C, 0xC0, 0x47, 0xDF, 0x11, 0x3D, 0x7F, 0x67, 0x5B, 0x12, 0xE8, 0x46, 0x60, 0x91, 0x4D,
+    0xD7, 0xDD, 0x7D, 0x6B, 0xB9, 0xCF, 0x95, 0xF1, 0xAD, 0x0D, 0x47, 0xB9, 0xC7, 0xDC, 0xAB, 0xF8,
+    0xA7, 0x0F, 0xE9, 0x9D, 0xCE, 0xC7, 0x19, 0xF9, 0xAB, 0x86, 0x24, 0xFF, 0x07, 0x2F, 0x88, 0xBE,
+    0x7D, 0x75, 0x5B, 0x12, 0xE8, 0x46, 0x60, 0x91, 0x4D, 0xD7, 0xDD, 0x7D, 0x6B, 0xB9, 0xCF, 0x95,
+    0xF1, 0xAD, 0x0D, 0x47, 0xB9, 0xC7, 0xDC, 0xAB, 0xF8, 0xD7, 0xF7, 0xE9, 0xD5, 0x1F, 0x7D, 0x92,
+    0x91, 0x1F, 0x80, 0x00, 0x04, 0xF7, 0x00, 0x5C, 0x22, 0xF0, 0x4E, 0xE7, 0x63, 0x7A, 0xFE, 0xD1,
+    0xEF, 0xB2, 0x4C, 0xEB, 0x22, 0xAF, 0x16, 0x09, 0xAB, 0x2F, 0x20, 0x9F, 0xB7, 0x96, 0x1B, 0x2D,
+    0x17, 0xB0, 0xF3, 0x78, 0x43, 0xFE, 0x77, 0xDE, 0xFF, 0xDD, 0xBA, 0x5C, 0xD9, 0xE0, 0x9B, 0xEF,
+    0xAA, 0xED, 0x01, 0xB8, 0x44, 0xE0, 0xD5, 0x1F, 0x7D, 0x42, 0xDF, 0x7E, 0xF0, 0x3F, 0x59, 0xA6,
+    0x75, 0x91, 0x57, 0x8B, 0x84, 0xD5, 0x17, 0x90, 0xCF, 0x5B, 0xCB, 0x8D, 0x96, 0x0B, 0xD8, 0x79,
+    0xBC, 0x21, 0xFF, 0xAB, 0x7F, 0xFF, 0x3F, 0xEB, 0x72, 0x65, 0x83, 0x2F, 0xB0, 0x38, 0x00, 0x01,
+    0x08, 0x7D, 0xE1, 0x5F, 0xA2, 0xB8, 0xC5, 0x22, 0xC0, 0xE4, 0xD7, 0x82, 0x50, 0x64, 0xD3, 0x43,
+    0x1A, 0x86, 0x2E, 0xF7, 0xA0, 0x05, 0xC1, 0xAA, 0xEF, 0xF9, 0xC8, 0x19, 0x9F, 0xF1, 0xF6, 0x6B,
+    0xDB, 0x9F, 0xAA, 0xF0, 0xE3, 0xBF, 0x8E, 0x5B, 0x2C, 0x02, 0x4C, 0x7E, 0x2D, 0x08, 0x45, 0x36,
+    0x3D, 0xA4, 0x61, 0xE8, 0x72, 0x0F, 0x5A, 0x10, 0xAC, 0xFA, 0x9E, 0x8F, 0x9C, 0xF1, 0x19, 0xEF,
+    0xBD, 0xBC, 0xFD, 0x01, 0x20, 0x00, 0x54, 0x46, 0x04, 0xFE, 0x41, 0xD4, 0xCF, 0xD2, 0x05, 0x10,
+    0x89, 0x72, 0x40, 0xAC, 0x12, 0x58, 0x62, 0xA0, 0xD7, 0xEC, 0x2D, 0x31, 0xB0, 0x36, 0xFA, 0x38,
+    0xC5, 0x45, 0x91, 0xDF, 0x42, 0x95, 0xD9, 0x5F, 0x8A, 0xC0, 0x3F, 0x8A, 0xFA, 0x59, 0xBA, 0x00,
+    0x22, 0x51, 0x0E, 0x88, 0x55, 0x02, 0x4B, 0x0C, 0xF4, 0x9A, 0xBD, 0x25, 0x06, 0xD6, 0x46, 0x1F,
+    0xA7, 0xB8, 0x28, 0xF2, 0x5B, 0x40, 0xF6, 0x07, 0x4A, 0x35, 0x01, 0x35, 0x7E, 0xB8, 0x48, 0x57,
+    0xEC, 0x02, 0x74, 0x63, 0xF0, 0xA3, 0xEF, 0x88, 0x7E, 0x3B, 0xFB, 0x98, 0xE8, 0xF9, 0x37, 0xCE,
+    0xB3, 0xF5, 0x2C, 0x47, 0x10, 0xB2, 0xB9, 0xC8, 0x22, 0xBE, 0x8B, 0xF4, 0x9C, 0xFD, 0x25, 0xAC,
+    0x06, 0xE0, 0x3E, 0x4D, 0x40, 0x8D, 0x3F, 0xFF, 0x77, 0xBA, 0x62, 0x17, 0xA0, 0x1B, 0x83, 0x1F,
+    0xBC, 0x20, 0xFA, 0xE3, 0xFF, 0xAE, 0x9B, 0x83, 0xAE, 0xB3, 0xF5, 0x2C, 0x47, 0x10, 0xB2, 0xB9,
+    0xC8, 0x22, 0xBE, 0x8B, 0xF4, 0x9C, 0xFD, 0x25, 0xAC, 0x06, 0x20, 0x9A, 0x80, 0x10, 0x80, 0x4A,
+    0x45, 0xC0, 0x22, 0x7D, 0xA8, 0x18, 0xD4, 0x4D, 0xFC, 0xAA, 0x04, 0xA0, 0x8C, 0x08, 0x58, 0xA4,
+    0x0F, 0x15, 0x83, 0xBA, 0x89, 0x0F, 0x01, 0x80, 0x00, 0x94, 0x02, 0x2F, 0x0F, 0xBA, 0x44, 0x80,
+    0x68, 0x23, 0x04, 0x44, 0xCE, 0x8B, 0x88, 0x04, 0x41, 0x94, 0x15, 0x55, 0x12, 0xBF, 0x4A, 0x01,
+    0x20, 0xDA, 0x2E, 0x0F, 0xBA, 0x44, 0x80, 0x68, 0x23, 0x04, 0x44, 0xCE, 0x8B, 0x88, 0x04, 0x41,
+    0x94, 0x15, 0x55, 0x12, 0x1F, 0x02, 0x00, 0x01, 0xA8, 0xD4, 0x09, 0xC8, 0xE7, 0xDE, 0xF8, 0xAD,
+    0x5B, 0x08, 0x7C, 0x57, 0xF7, 0xF1, 0xD5, 0xF6, 0x6F, 0xBF, 0xB6, 0xAD, 0xEF, 0x25, 0xF9, 0x43,
+    0x89, 0x5F, 0xB5, 0x00, 0x14, 0x39, 0x01, 0xF9, 0xDC, 0x5B, 0x7F, 0x74, 0x0B, 0x81, 0xEF, 0xEA,
+    0x3E, 0xBE, 0xDA, 0xFE, 0xBD, 0x97, 0xB7, 0xF5, 0xBD, 0x24, 0x7F, 0x28, 0xF1, 0x21, 0x00, 0x10,
+    0x80, 0x83, 0x45, 0x40, 0x3A, 0x02, 0x22, 0x47, 0x69, 0xA0, 0x84, 0xC0, 0x22, 0xBD, 0xCE, 0xF6,
+    0x16, 0xD9, 0xBF, 0xF9, 0xEE, 0x30, 0xE2, 0xD7, 0x21, 0x00, 0x5A, 0x04, 0xA4, 0x23, 0x20, 0x72,
+    0x94, 0x06, 0x4A, 0x08, 0x2C, 0xD2, 0xEB, 0x6C, 0x6F, 0x91, 0xFD, 0x8B, 0x17, 0x87, 0x11, 0x1F,
+    0x02, 0x00, 0x01, 0xA8, 0x45, 0x08, 0x42, 0x44, 0xC0, 0x22, 0x3E, 0x93, 0xDE, 0x3A, 0xEE, 0x63,
+    0xF5, 0x8F, 0x25, 0x00, 0x45, 0x42, 0x10, 0x22, 0x02, 0x16, 0xF1, 0x99, 0xF4, 0xD6, 0x71, 0x1F,
+    0xAB, 0x0F, 0x01, 0x80, 0x00, 0x54, 0x3A, 0xE1, 0x59, 0x04, 0x38, 0xF3, 0xFB, 0x44, 0x20, 0x57,
+    0x16, 0x6C, 0xF0, 0xCB, 0x77, 0x3E, 0xCE, 0x11, 0xDD, 0x25, 0x02, 0x55, 0x11, 0xBF, 0x6E, 0x01,
+    0x60, 0x11, 0xE0, 0xCC, 0xEF, 0x13, 0x81, 0x5C, 0x59, 0xB0, 0xC1, 0x2F, 0x5E, 0xFD, 0x24, 0x47,
+    0x74, 0x97, 0x08, 0x54, 0x45, 0x7C, 0x08, 0x00, 0x04, 0xA0, 0x52, 0x58, 0x8E, 0xC0, 0x55, 0x22,
+    0xF0, 0xE3, 0x2F, 0xC9, 0x26, 0x7F, 0x95, 0x19, 0xFF, 0x98, 0x02, 0x50, 0xE4, 0x08, 0x5C, 0x25,
+    0x02, 0x3F, 0xFE, 0x8C, 0x6C, 0xF2, 0x57, 0x99, 0xF1, 0x21, 0x00, 0xCD, 0x44, 0xED, 0xB7, 0x07,
+    0x5F, 0xEF, 0x20, 0xDC, 0x76, 0xC6, 0xF5, 0x0E, 0x42, 0xE9, 0x0E, 0xBE, 0x14, 0x8F, 0xA9, 0xE2,
+    0x1A, 0xFF, 0x5C, 0xF0, 0xE3, 0xBF, 0x8E, 0x5B, 0x1F, 0xFC, 0xF7, 0x36, 0x1E, 0x7A, 0x07, 0xA1,
+    0x74, 0x07, 0x9F, 0x89, 0xC7, 0x54, 0x71, 0x8D, 0x0F, 0x00, 0x47, 0x11, 0x00, 0x16, 0x81, 0x6D,
+    0xD6, 0xCF, 0x3B, 0x82, 0x9D, 0x55, 0x83, 0xCD, 0x63, 0x9D, 0xF9, 0x1F, 0x3A, 0xF1, 0xB5, 0x08,
+    0x64, 0x59, 0x5F, 0x39, 0x82, 0x9D, 0x55, 0x83, 0xCD, 0x63, 0x9D, 0xF9, 0x41, 0x7C, 0xE0, 0x41,
+    0x94, 0x00, 0x21, 0x65, 0x81, 0xDE, 0x37, 0xC0, 0xD6, 0xFF, 0x98, 0xC4, 0x3F, 0x56, 0x09, 0x10,
+    0x52, 0x16, 0xE8, 0x7D, 0x03, 0x6C, 0xFD, 0x8F, 0x49, 0x7C, 0x94, 0x00, 0xCD, 0xC0, 0xA3, 0x53,
+    0x7C, 0x29, 0x9F, 0x58, 0x64, 0x2D, 0x13, 0x4A, 0xAB, 0x7F, 0x49, 0x59, 0xBF, 0xB0, 0x2C, 0x78,
+    0x61, 0x2F, 0x13, 0x4A, 0xAB, 0x8F, 0xAC, 0x0F, 0x5C, 0x84, 0x03, 0xD0, 0x6E, 0xC0, 0x55, 0x2E,
+    0x1C, 0x13, 0xA7, 0x74, 0x00, 0xDA, 0x0D, 0xB8, 0xCA, 0x85, 0x53, 0xC6, 0x03, 0x40, 0x0F, 0xA0,
+    0xF6, 0xFE, 0x00, 0x70, 0x3A, 0xC2, 0x03, 0x28, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xD2, 0xF8, 0x7F, 0x64, 0xAC, 0x75, 0x25, 0xD5, 0xC8, 0xD9,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82 
+};
+static const unsigned int toaster_atlas_len = sizeof(toaster_atlas);
+
+#endif
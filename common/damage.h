@@ -0,0 +1,120 @@
+/**
+ * Frame Damage Tracking
+ * Lets mostly static BeforeLight screensavers skip frames that changed nothing
+ *
+ * Savers report the rectangles they changed during a frame. If nothing was
+ * reported the main loop skips drawing and SDL_RenderPresent entirely, which
+ * saves the compositor and the GPU a wake-up. Savers that keep their scene in
+ * a persistent target texture only redraw the damaged parts into it and then
+ * copy the whole texture to the screen on frames that do present (the back
+ * buffer's contents are undefined after a present, so the copy is required).
+ *
+ * When more than DAMAGE_MAX_RECTS rectangles are reported in one frame the
+ * list collapses into its bounding box.
+ *
+ * Usage:
+ *   DamageTracker damage;
+ *   damage_init(&damage, W, H);              // First frame is fully damaged
+ *   while (running) {
+ *       ... on SDL_WINDOWEVENT_EXPOSED: damage_add_full(&damage) ...
+ *       ... update, damage_add(&damage, x, y, w, h) for each change ...
+ *       if (damage_pending(&damage)) {
+ *           ... redraw ...
+ *           SDL_RenderPresent(renderer);
+ *       }
+ *       damage_end_frame(&damage);
+ *   }
+ */
+
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include <SDL.h>
+
+#define DAMAGE_MAX_RECTS 64
+
+typedef struct {
+    SDL_Rect rects[DAMAGE_MAX_RECTS];
+    int count;
+    int full;                   // Whole surface needs redrawing
+    int width, height;          // Surface bounds rectangles are clipped to
+
+    // Statistics for the exit summary
+    Uint32 frames;
+    Uint32 presents;
+    Uint32 start_ticks;
+} DamageTracker;
+
+static inline void damage_init(DamageTracker *d, int width, int height) {
+    SDL_memset(d, 0, sizeof(*d));
+    d->width = width;
+    d->height = height;
+    d->full = 1;
+    d->start_ticks = SDL_GetTicks();
+}
+
+static inline void damage_add_full(DamageTracker *d) {
+    d->full = 1;
+    d->count = 0;
+}
+
+static inline void damage_bounds(const DamageTracker *d, SDL_Rect *out) {
+    if (d->full || d->count == 0) {
+        out->x = 0;
+        out->y = 0;
+        out->w = d->full ? d->width : 0;
+        out->h = d->full ? d->height : 0;
+        return;
+    }
+    *out = d->rects[0];
+    for (int i = 1; i < d->count; i++) {
+        SDL_UnionRect(out, &d->rects[i], out);
+    }
+}
+
+/**
+ * Report a changed rectangle. Rectangles are clipped to the surface, empty
+ * ones are ignored.
+ */
+static inline void damage_add(DamageTracker *d, int x, int y, int w, int h) {
+    if (d->full) return;
+
+    SDL_Rect bounds = {0, 0, d->width, d->height};
+    SDL_Rect r = {x, y, w, h};
+    if (!SDL_IntersectRect(&r, &bounds, &r)) return;
+
+    if (d->count == DAMAGE_MAX_RECTS) {
+        // Too many small changes: track their bounding box instead
+        SDL_Rect box;
+        damage_bounds(d, &box);
+        d->rects[0] = box;
+        d->count = 1;
+    }
+    d->rects[d->count++] = r;
+}
+
+static inline int damage_pending(const DamageTracker *d) {
+    return d->full || d->count > 0;
+}
+
+/**
+ * Call once per loop iteration, after presenting (or skipping the present).
+ */
+static inline void damage_end_frame(DamageTracker *d) {
+    d->frames++;
+    if (damage_pending(d)) d->presents++;
+    d->count = 0;
+    d->full = 0;
+}
+
+static inline void damage_log_summary(const DamageTracker *d, const char *saver) {
+    Uint32 runtime = SDL_GetTicks() - d->start_ticks;
+    if (runtime == 0 || d->frames == 0) return;
+    float minutes = runtime / 60000.0f;
+    SDL_Log("%s: %u of %u frames presented (%.0f presents/min, %.0f%% skipped)",
+            saver, (unsigned)d->presents, (unsigned)d->frames,
+            d->presents / minutes,
+            100.0f * (d->frames - d->presents) / d->frames);
+}
+
+#endif
@@ -0,0 +1,293 @@
+/**
+ * Mipmapped Textures
+ * Box-filtered mip chains for BeforeLight sprites that are drawn minified
+ *
+ * SDL_RenderCopy samples a single texture level, so drawing a large image at
+ * a fraction of its size both aliases (sparkling stars, crawling edges) and
+ * reads far more texels than it needs. A MipTexture keeps the image plus a
+ * chain of half-size copies, each a 2x2 box filter of the previous one, and
+ * mip_pick returns the smallest level that is still at least as large as the
+ * destination, so nothing is ever magnified from a lower level.
+ *
+ * Atlases work too: every level covers the same texture coordinates, so a
+ * SpriteBatch set up with the full atlas size can draw from any level (see
+ * sprite_batch_set_texture) and mip_pick_scale picks one from the ratio of
+ * drawn to atlas pixels. Keep the chain short enough that the gutters
+ * between frames survive the halving, or neighbours bleed into each other.
+ *
+ * mip_create_luma stores each level as one 8-bit intensity channel (alpha
+ * times luminance) instead of RGBA, for white-on-transparent art such as
+ * star fields. Levels are NV12 textures with neutral chroma, 1.5 bytes per
+ * pixel against 4, falling back to opaque grey ARGB when the renderer has no
+ * YUV support. Either way they use additive blending: tint them with
+ * SDL_SetTextureColorMod and fade them with SDL_SetTextureAlphaMod.
+ *
+ * Usage:
+ *   MipTexture mip;
+ *   mip_create(&mip, renderer, surface, 64);     // Stop below 64 px
+ *   int level = mip_pick(&mip, dst.w, dst.h);
+ *   SDL_RenderCopy(renderer, mip.levels[level], NULL, &dst);
+ *   mip_destroy(&mip);
+ */
+
+#ifndef MIPMAP_H
+#define MIPMAP_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define MIP_MAX_LEVELS 10
+
+typedef struct {
+    SDL_Texture *levels[MIP_MAX_LEVELS];
+    int widths[MIP_MAX_LEVELS];
+    int heights[MIP_MAX_LEVELS];
+    int count;
+    int luma;                           // Levels hold intensity only, blended additively
+    size_t bytes;                       // Texture memory used by all levels
+} MipTexture;
+
+/**
+ * Half-size copy of an ARGB8888 surface. Colors are averaged weighted by
+ * alpha so transparent texels do not darken the edges of what they surround.
+ */
+static inline SDL_Surface *mip_downsample(SDL_Surface *src) {
+    int w = src->w / 2;
+    int h = src->h / 2;
+    if (w < 1) w = 1;
+    if (h < 1) h = 1;
+
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!dst) return NULL;
+
+    SDL_LockSurface(src);
+    SDL_LockSurface(dst);
+    for (int y = 0; y < h; y++) {
+        const Uint32 *row0 = (const Uint32 *)((const Uint8 *)src->pixels + (y * 2) * src->pitch);
+        const Uint32 *row1 = (const Uint32 *)((const Uint8 *)src->pixels + SDL_min(y * 2 + 1, src->h - 1) * src->pitch);
+        Uint32 *out = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+
+        for (int x = 0; x < w; x++) {
+            int x0 = x * 2;
+            int x1 = SDL_min(x0 + 1, src->w - 1);
+            Uint32 texels[4] = {row0[x0], row0[x1], row1[x0], row1[x1]};
+
+            Uint32 a = 0, r = 0, g = 0, b = 0;
+            for (int i = 0; i < 4; i++) {
+                Uint32 ta = texels[i] >> 24;
+                a += ta;
+                r += ((texels[i] >> 16) & 0xFF) * ta;
+                g += ((texels[i] >> 8) & 0xFF) * ta;
+                b += (texels[i] & 0xFF) * ta;
+            }
+            if (a > 0) {
+                r /= a;
+                g /= a;
+                b /= a;
+            }
+            out[x] = ((a / 4) << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+    SDL_UnlockSurface(dst);
+    SDL_UnlockSurface(src);
+    return dst;
+}
+
+/**
+ * Copy of an ARGB8888 surface resized to w x h: halved with mip_downsample
+ * while that stays at or above the target, then bilinearly resampled (again
+ * weighted by alpha) the rest of the way.
+ */
+static inline SDL_Surface *mip_resize(SDL_Surface *src, int w, int h) {
+    SDL_Surface *cur = SDL_ConvertSurfaceFormat(src, SDL_PIXELFORMAT_ARGB8888, 0);
+    while (cur && cur->w / 2 >= w && cur->h / 2 >= h) {
+        SDL_Surface *next = mip_downsample(cur);
+        SDL_FreeSurface(cur);
+        cur = next;
+    }
+    if (!cur || (cur->w == w && cur->h == h)) return cur;
+
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!dst) {
+        SDL_FreeSurface(cur);
+        return NULL;
+    }
+
+    float sx = (float)cur->w / w;
+    float sy = (float)cur->h / h;
+    SDL_LockSurface(cur);
+    SDL_LockSurface(dst);
+    for (int y = 0; y < h; y++) {
+        float fy = (y + 0.5f) * sy - 0.5f;
+        if (fy < 0.0f) fy = 0.0f;
+        int y0 = (int)fy;
+        int y1 = SDL_min(y0 + 1, cur->h - 1);
+        float wy = fy - y0;
+        const Uint32 *row0 = (const Uint32 *)((const Uint8 *)cur->pixels + y0 * cur->pitch);
+        const Uint32 *row1 = (const Uint32 *)((const Uint8 *)cur->pixels + y1 * cur->pitch);
+        Uint32 *out = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+
+        for (int x = 0; x < w; x++) {
+            float fx = (x + 0.5f) * sx - 0.5f;
+            if (fx < 0.0f) fx = 0.0f;
+            int x0 = (int)fx;
+            int x1 = SDL_min(x0 + 1, cur->w - 1);
+            float wx = fx - x0;
+
+            Uint32 texels[4] = {row0[x0], row0[x1], row1[x0], row1[x1]};
+            float weights[4] = {(1 - wx) * (1 - wy), wx * (1 - wy), (1 - wx) * wy, wx * wy};
+            float a = 0, r = 0, g = 0, b = 0;
+            for (int i = 0; i < 4; i++) {
+                float ta = (texels[i] >> 24) * weights[i];
+                a += ta;
+                r += ((texels[i] >> 16) & 0xFF) * ta;
+                g += ((texels[i] >> 8) & 0xFF) * ta;
+                b += (texels[i] & 0xFF) * ta;
+            }
+            if (a > 0.0f) {
+                r /= a;
+                g /= a;
+                b /= a;
+            }
+            out[x] = ((Uint32)(a + 0.5f) << 24) | ((Uint32)(r + 0.5f) << 16) |
+                     ((Uint32)(g + 0.5f) << 8) | (Uint32)(b + 0.5f);
+        }
+    }
+    SDL_UnlockSurface(dst);
+    SDL_UnlockSurface(cur);
+    SDL_FreeSurface(cur);
+    return dst;
+}
+
+static inline SDL_Texture *mip_upload_rgba(SDL_Renderer *renderer, SDL_Surface *level, size_t *bytes) {
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, level);
+    if (!tex) return NULL;
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    *bytes += (size_t)level->w * level->h * 4;
+    return tex;
+}
+
+/**
+ * Upload an ARGB8888 level as intensity = alpha * luminance
+ */
+static inline SDL_Texture *mip_upload_luma(SDL_Renderer *renderer, SDL_Surface *level, size_t *bytes) {
+    int w = level->w;
+    int h = level->h;
+    size_t luma_size = (size_t)w * h;
+    size_t chroma_size = (size_t)((w + 1) / 2) * ((h + 1) / 2) * 2;
+    Uint8 *planes = malloc(luma_size + chroma_size);
+    if (!planes) return NULL;
+
+    SDL_LockSurface(level);
+    for (int y = 0; y < h; y++) {
+        const Uint32 *row = (const Uint32 *)((const Uint8 *)level->pixels + y * level->pitch);
+        Uint8 *out = planes + (size_t)y * w;
+        for (int x = 0; x < w; x++) {
+            Uint32 p = row[x];
+            Uint32 lum = (((p >> 16) & 0xFF) * 77 + ((p >> 8) & 0xFF) * 150 + (p & 0xFF) * 29) >> 8;
+            out[x] = (Uint8)(((p >> 24) * lum + 127) / 255);
+        }
+    }
+    SDL_UnlockSurface(level);
+    SDL_memset(planes + luma_size, 128, chroma_size); // Neutral chroma: pure grey
+
+    SDL_Texture *tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_NV12, SDL_TEXTUREACCESS_STATIC, w, h);
+    if (tex && SDL_UpdateTexture(tex, NULL, planes, w) == 0) {
+        *bytes += luma_size + chroma_size;
+    } else {
+        // No YUV support: the same intensities as opaque grey
+        if (tex) SDL_DestroyTexture(tex);
+        tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, w, h);
+        Uint32 *grey = tex ? malloc(luma_size * sizeof(Uint32)) : NULL;
+        if (grey) {
+            for (size_t i = 0; i < luma_size; i++) {
+                grey[i] = 0xFF000000u | planes[i] * 0x010101u;
+            }
+            SDL_UpdateTexture(tex, NULL, grey, w * (int)sizeof(Uint32));
+            free(grey);
+            *bytes += luma_size * 4;
+        } else if (tex) {
+            SDL_DestroyTexture(tex);
+            tex = NULL;
+        }
+    }
+    free(planes);
+
+    if (tex) SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_ADD);
+    return tex;
+}
+
+static inline void mip_destroy(MipTexture *mip) {
+    for (int i = 0; i < mip->count; i++) {
+        if (mip->levels[i]) SDL_DestroyTexture(mip->levels[i]);
+    }
+    SDL_memset(mip, 0, sizeof(*mip));
+}
+
+static inline int mip_build(MipTexture *mip, SDL_Renderer *renderer, SDL_Surface *surface,
+                            int min_size, int luma) {
+    SDL_memset(mip, 0, sizeof(*mip));
+    mip->luma = luma;
+
+    SDL_Surface *level = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!level) return -1;
+
+    while (level && mip->count < MIP_MAX_LEVELS) {
+        SDL_Texture *tex = luma ? mip_upload_luma(renderer, level, &mip->bytes)
+                                : mip_upload_rgba(renderer, level, &mip->bytes);
+        if (!tex) break;
+        mip->levels[mip->count] = tex;
+        mip->widths[mip->count] = level->w;
+        mip->heights[mip->count] = level->h;
+        mip->count++;
+
+        if (level->w / 2 < min_size || level->h / 2 < min_size) break;
+        SDL_Surface *next = mip_downsample(level);
+        SDL_FreeSurface(level);
+        level = next;
+    }
+    if (level) SDL_FreeSurface(level);
+
+    return mip->count > 0 ? 0 : -1;
+}
+
+/**
+ * Upload `surface` and its mip chain, halving until either side would drop
+ * below min_size. The surface is not freed. Returns 0 on success, -1 if the
+ * base level could not be created; a failed lower level just ends the chain.
+ */
+static inline int mip_create(MipTexture *mip, SDL_Renderer *renderer, SDL_Surface *surface, int min_size) {
+    return mip_build(mip, renderer, surface, min_size, 0);
+}
+
+/**
+ * As mip_create, but every level is a single intensity channel
+ */
+static inline int mip_create_luma(MipTexture *mip, SDL_Renderer *renderer, SDL_Surface *surface, int min_size) {
+    SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_JPEG); // Full range, so 255 stays white
+    return mip_build(mip, renderer, surface, min_size, 1);
+}
+
+/**
+ * Smallest level that still covers a dst_w x dst_h destination
+ */
+static inline int mip_pick(const MipTexture *mip, int dst_w, int dst_h) {
+    int level = 0;
+    while (level + 1 < mip->count &&
+           mip->widths[level + 1] >= dst_w && mip->heights[level + 1] >= dst_h) {
+        level++;
+    }
+    return level;
+}
+
+/**
+ * Smallest level that still covers the base image drawn at `scale` (drawn
+ * pixels per base pixel), for atlases whose sprites share one scale
+ */
+static inline int mip_pick_scale(const MipTexture *mip, float scale) {
+    if (mip->count == 0) return 0;
+    return mip_pick(mip, (int)ceilf(mip->widths[0] * scale), (int)ceilf(mip->heights[0] * scale));
+}
+
+#endif
@@ -0,0 +1,317 @@
+/**
+ * Particle Pools
+ * Structure-of-arrays particles shared by the BeforeLight savers
+ *
+ * A pool holds up to `capacity` particles in parallel arrays. Slots are
+ * handed out and returned through a free list, so spawning and killing cost
+ * the same at any pool size and live particles never move. One SIMD pass
+ * per update applies acceleration (gravity, buoyancy, wind), integrates
+ * position, ages life by the per-particle decay rate and kills particles
+ * that run out of life or leave the pool bounds. The pass covers slots up
+ * to the highest one ever used, so its cost follows the peak particle count.
+ *
+ * Pools created with a trail length also keep that many past positions per
+ * particle. Trails live in a ring of whole planes (one x/y/life array per
+ * step back), so recording a step is one contiguous store per plane rather
+ * than shifting every particle's history.
+ *
+ * particle_pool_render draws every live particle as a textured quad with its
+ * own colour in one SDL_RenderGeometry call. Alpha fades with life; size
+ * also shrinks with life if `shrink` is set. Savers with their own renderer
+ * (OpenGL) or sprite batch read the arrays directly instead.
+ *
+ * Usage:
+ *   ParticlePool pool;
+ *   particle_pool_init(&pool, 100000, 0);
+ *   SDL_Texture *dot = particle_dot_texture(renderer, 16);
+ *   while (running) {
+ *       int p = particle_spawn(&pool, x, y, vx, vy);
+ *       if (p >= 0) { pool.ay[p] = 98.0f; pool.decay[p] = 0.5f; }
+ *       particle_pool_update(&pool, dt);
+ *       particle_pool_render(&pool, renderer, dot);
+ *   }
+ *   particle_pool_destroy(&pool);
+ */
+
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <SDL.h>
+#include <float.h>
+#include <stdlib.h>
+#include "simd.h"
+
+typedef struct {
+    int capacity;                       // Slots, a multiple of SIMD_WIDTH
+    int high;                           // Slots at and above this have never been used
+    int live;
+
+    float *x, *y;                       // Centre, px
+    float *vx, *vy;                     // px/s
+    float *ax, *ay;                     // px/s^2
+    float *life;                        // 1 at spawn, dead at 0
+    float *decay;                       // Life lost per second
+    float *size;                        // Quad size at full life, px
+    SDL_Color *color;
+
+    int *free_slots;                    // Stack of unused slots, lowest on top at start
+    int free_count;
+
+    // Particles leaving this box die (default: unbounded)
+    float min_x, min_y, max_x, max_y;
+    int shrink;                         // Rendered size scales with life
+
+    // Trail ring: plane k holds each particle's position k updates ago
+    int trail_len;
+    int trail_head;
+    float *trail_x, *trail_y, *trail_life;
+
+    SDL_Vertex *vertices;
+    int *indices;
+    void *arena;
+} ParticlePool;
+
+static inline void particle_pool_destroy(ParticlePool *pool) {
+    free(pool->arena);
+    free(pool->vertices);
+    free(pool->indices);
+    SDL_memset(pool, 0, sizeof(*pool));
+}
+
+/**
+ * Allocate a pool; trail_len 0 keeps no trails. Returns 0 on success.
+ */
+static inline int particle_pool_init(ParticlePool *pool, int capacity, int trail_len) {
+    SDL_memset(pool, 0, sizeof(*pool));
+    if (capacity < 1) capacity = 1;
+    if (trail_len < 0) trail_len = 0;
+    pool->capacity = simd_round_up(capacity);
+    pool->trail_len = trail_len;
+    pool->min_x = pool->min_y = -FLT_MAX;
+    pool->max_x = pool->max_y = FLT_MAX;
+
+    size_t n = (size_t)pool->capacity;
+    size_t floats = n * (9 + 3 * (size_t)trail_len);
+    char *p = calloc(1, sizeof(float) * floats + sizeof(SDL_Color) * n + sizeof(int) * n);
+    pool->arena = p;
+    pool->vertices = malloc(sizeof(SDL_Vertex) * 4 * n);
+    pool->indices = malloc(sizeof(int) * 6 * n);
+    if (!p || !pool->vertices || !pool->indices) {
+        particle_pool_destroy(pool);
+        return -1;
+    }
+
+    float **planes[] = {&pool->x, &pool->y, &pool->vx, &pool->vy, &pool->ax, &pool->ay,
+                        &pool->life, &pool->decay, &pool->size};
+    for (size_t k = 0; k < sizeof(planes) / sizeof(planes[0]); k++) {
+        *planes[k] = (float *)p + n * k;
+    }
+    pool->trail_x = (float *)p + n * 9;
+    pool->trail_y = pool->trail_x + n * trail_len;
+    pool->trail_life = pool->trail_y + n * trail_len;
+    pool->color = (SDL_Color *)((float *)p + floats);
+    pool->free_slots = (int *)(pool->color + n);
+
+    // Hand out low slots first so the update pass stays short while few are alive
+    for (int i = 0; i < pool->capacity; i++) {
+        pool->free_slots[i] = pool->capacity - 1 - i;
+    }
+    pool->free_count = pool->capacity;
+
+    for (int q = 0; q < pool->capacity; q++) {
+        int *idx = &pool->indices[q * 6];
+        idx[0] = q * 4;
+        idx[1] = q * 4 + 1;
+        idx[2] = q * 4 + 2;
+        idx[3] = q * 4;
+        idx[4] = q * 4 + 2;
+        idx[5] = q * 4 + 3;
+    }
+    return 0;
+}
+
+static inline void particle_pool_set_bounds(ParticlePool *pool, float min_x, float min_y, float max_x, float max_y) {
+    pool->min_x = min_x;
+    pool->min_y = min_y;
+    pool->max_x = max_x;
+    pool->max_y = max_y;
+}
+
+/**
+ * Take a free slot and start a particle there with full life, no
+ * acceleration or decay, size 1 and opaque white. Returns the slot for the
+ * caller to fill in the rest, or -1 if the pool is full.
+ */
+static inline int particle_spawn(ParticlePool *pool, float x, float y, float vx, float vy) {
+    if (pool->free_count == 0) return -1;
+    int i = pool->free_slots[--pool->free_count];
+    pool->x[i] = x;
+    pool->y[i] = y;
+    pool->vx[i] = vx;
+    pool->vy[i] = vy;
+    pool->ax[i] = 0;
+    pool->ay[i] = 0;
+    pool->life[i] = 1.0f;
+    pool->decay[i] = 0;
+    pool->size[i] = 1.0f;
+    pool->color[i] = (SDL_Color){255, 255, 255, 255};
+    for (int k = 0; k < pool->trail_len; k++) {
+        pool->trail_x[k * pool->capacity + i] = x;
+        pool->trail_y[k * pool->capacity + i] = y;
+        pool->trail_life[k * pool->capacity + i] = 0;
+    }
+    if (i >= pool->high) pool->high = simd_round_up(i + 1);
+    pool->live++;
+    return i;
+}
+
+static inline void particle_kill(ParticlePool *pool, int i) {
+    if (pool->life[i] <= 0) return;
+    pool->life[i] = 0;
+    pool->free_slots[pool->free_count++] = i;
+    pool->live--;
+}
+
+/**
+ * Kill every particle and forget the high-water mark
+ */
+static inline void particle_pool_clear(ParticlePool *pool) {
+    SDL_memset(pool->life, 0, sizeof(float) * (size_t)pool->capacity);
+    for (int i = 0; i < pool->capacity; i++) {
+        pool->free_slots[i] = pool->capacity - 1 - i;
+    }
+    pool->free_count = pool->capacity;
+    pool->high = 0;
+    pool->live = 0;
+}
+
+/**
+ * Advance every live particle by dt seconds and record a trail step
+ */
+static inline void particle_pool_update(ParticlePool *pool, float dt) {
+    const f32x4 t = simd_splat(dt);
+    const f32x4 zero = simd_splat(0.0f);
+    const f32x4 min_x = simd_splat(pool->min_x), max_x = simd_splat(pool->max_x);
+    const f32x4 min_y = simd_splat(pool->min_y), max_y = simd_splat(pool->max_y);
+
+    float *trail_x = NULL, *trail_y = NULL, *trail_life = NULL;
+    if (pool->trail_len > 0) {
+        pool->trail_head = (pool->trail_head + 1) % pool->trail_len;
+        size_t plane = (size_t)pool->trail_head * pool->capacity;
+        trail_x = pool->trail_x + plane;
+        trail_y = pool->trail_y + plane;
+        trail_life = pool->trail_life + plane;
+    }
+
+    for (int i = 0; i < pool->high; i += SIMD_WIDTH) {
+        f32x4 life = simd_load(pool->life + i);
+        i32x4 alive = life > zero;
+        if (!simd_any(alive)) {
+            if (trail_life) simd_store(trail_life + i, zero);
+            continue;
+        }
+
+        f32x4 vx = simd_load(pool->vx + i) + simd_load(pool->ax + i) * t;
+        f32x4 vy = simd_load(pool->vy + i) + simd_load(pool->ay + i) * t;
+        f32x4 x = simd_load(pool->x + i) + vx * t;
+        f32x4 y = simd_load(pool->y + i) + vy * t;
+        f32x4 next = life - simd_load(pool->decay + i) * t;
+
+        i32x4 out = (next <= zero) | (x < min_x) | (x > max_x) | (y < min_y) | (y > max_y);
+        i32x4 dying = alive & out;
+        next = simd_select(alive & ~out, next, zero);
+
+        // Dead lanes keep their stale values; only life marks them
+        simd_store(pool->vx + i, vx);
+        simd_store(pool->vy + i, vy);
+        simd_store(pool->x + i, x);
+        simd_store(pool->y + i, y);
+        simd_store(pool->life + i, next);
+        if (trail_life) {
+            simd_store(trail_x + i, x);
+            simd_store(trail_y + i, y);
+            simd_store(trail_life + i, next);
+        }
+
+        if (simd_any(dying)) {
+            for (int k = 0; k < SIMD_WIDTH; k++) {
+                if (dying[k]) {
+                    pool->free_slots[pool->free_count++] = i + k;
+                    pool->live--;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Position and life of particle i as it was `age` updates ago (0 = now)
+ */
+static inline void particle_trail(const ParticlePool *pool, int i, int age, float *x, float *y, float *life) {
+    int k = pool->trail_head - age;
+    if (k < 0) k += pool->trail_len;
+    size_t at = (size_t)k * pool->capacity + i;
+    *x = pool->trail_x[at];
+    *y = pool->trail_y[at];
+    *life = pool->trail_life[at];
+}
+
+/**
+ * Draw every live particle as a `texture` quad (NULL = flat squares) in one call
+ */
+static inline void particle_pool_render(const ParticlePool *pool, SDL_Renderer *renderer, SDL_Texture *texture) {
+    int quads = 0;
+    for (int i = 0; i < pool->high; i++) {
+        float life = pool->life[i];
+        if (life <= 0) continue;
+
+        float half = pool->size[i] * (pool->shrink ? life : 1.0f) * 0.5f;
+        if (half < 0.5f) half = 0.5f;
+        SDL_Color c = pool->color[i];
+        c.a = (Uint8)(c.a * (life < 1.0f ? life : 1.0f));
+
+        SDL_Vertex *v = &pool->vertices[quads * 4];
+        float x = pool->x[i], y = pool->y[i];
+        v[0].position = (SDL_FPoint){x - half, y - half};
+        v[0].tex_coord = (SDL_FPoint){0, 0};
+        v[1].position = (SDL_FPoint){x + half, y - half};
+        v[1].tex_coord = (SDL_FPoint){1, 0};
+        v[2].position = (SDL_FPoint){x + half, y + half};
+        v[2].tex_coord = (SDL_FPoint){1, 1};
+        v[3].position = (SDL_FPoint){x - half, y + half};
+        v[3].tex_coord = (SDL_FPoint){0, 1};
+        v[0].color = v[1].color = v[2].color = v[3].color = c;
+        quads++;
+    }
+    if (quads > 0) {
+        SDL_RenderGeometry(renderer, texture, pool->vertices, quads * 4, pool->indices, quads * 6);
+    }
+}
+
+/**
+ * A white dot with a soft round falloff for particle_pool_render, additive
+ * blending by default
+ */
+static inline SDL_Texture *particle_dot_texture(SDL_Renderer *renderer, int size) {
+    SDL_Surface *surf = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surf) return NULL;
+
+    float c = (size - 1) / 2.0f;
+    for (int y = 0; y < size; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surf->pixels + y * surf->pitch);
+        for (int x = 0; x < size; x++) {
+            float d2 = ((x - c) * (x - c) + (y - c) * (y - c)) / (c * c);
+            float a = d2 < 1.0f ? (1.0f - d2) * (1.0f - d2) : 0.0f;
+            row[x] = ((Uint32)(a * 255.0f) << 24) | 0x00FFFFFF;
+        }
+    }
+
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    if (!tex) return NULL;
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_ADD);
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeLinear);
+    return tex;
+}
+
+#endif
@@ -0,0 +1,215 @@
+/**
+ * Power-Aware Frame Rate Policy
+ * Shared frame pacing for the slowly changing BeforeLight screensavers
+ *
+ * Scenes like fadeout, globe, cityscape and lifeforms change very little per
+ * frame, so rendering them at 60 fps all night mostly burns battery. Each
+ * saver declares the lowest frame rate at which it still looks right and the
+ * policy walks down a fixed ladder from there:
+ *
+ *   60 fps -> 30 fps -> 15 fps -> 5 fps [-> blank]
+ *
+ * Rates below the saver's minimum useful rate are skipped. Blanking is the
+ * last rung only when the saver passes allow_blank (opt-in via -b 1); by
+ * default the policy just holds the slowest useful rate. On AC power the
+ * ladder advances one rung every idle_minutes; on battery (every online file
+ * under /sys/class/power_supply reads 0) it starts at 30 fps and advances
+ * twice as fast. The supply is re-read every POWER_RECHECK_MS so plugging in
+ * restores the full rate.
+ *
+ * Waiting uses SDL_WaitEventTimeout, so the process sleeps in the kernel
+ * until the next frame is due and still wakes immediately on input. The
+ * event is left in the queue for the saver's own SDL_PollEvent loop.
+ *
+ * Usage:
+ *   PowerPolicy power;
+ *   power_policy_init(&power, 15, enabled, idle_minutes, allow_blank);
+ *   while (running) {
+ *       float dt = power_policy_begin_frame(&power);
+ *       ... handle events ...
+ *       if (power_policy_is_blank(&power)) { ... present black once ...; power_policy_wait(&power); continue; }
+ *       ... update with dt, render, present ...
+ *       power_policy_wait(&power); // replaces SDL_Delay(16)
+ *   }
+ */
+
+#ifndef POWER_POLICY_H
+#define POWER_POLICY_H
+
+#include <SDL.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+
+#define POWER_SUPPLY_DIR "/sys/class/power_supply"
+#define POWER_RECHECK_MS 30000        // Re-read the supply state every 30 s
+#define POWER_BLANK_WAIT_MS 1000      // Wake-up interval while blanked
+#define POWER_MAX_DT 0.25f            // Clamp simulation steps after long waits
+#define POWER_LADDER_STEPS 4
+
+static const int power_ladder[POWER_LADDER_STEPS] = {60, 30, 15, 5};
+
+typedef struct {
+    int enabled;
+    int min_fps;                      // Lowest rate the saver still looks right at
+    int allow_blank;                  // Blank after the slowest useful rate
+    Uint32 step_ms;                   // Time per ladder rung on AC power
+
+    int on_battery;
+    Uint32 run_start;
+    Uint32 start_ticks;               // Start of the current ladder walk
+    Uint32 last_check;
+    Uint32 frame_start;
+    Uint32 last_frame;
+
+    int fps;                          // Current target rate, 0 while blanked
+    int blank;
+    int blank_presented;              // Black frame already shown
+
+    Uint32 frames;                    // Rendered frames, for the exit summary
+} PowerPolicy;
+
+/**
+ * Returns 1 when every online file under /sys/class/power_supply reads 0.
+ * Machines without such files (desktops, non-Linux) count as mains powered.
+ */
+static inline int power_policy_read_battery(void) {
+    DIR *dir = opendir(POWER_SUPPLY_DIR);
+    if (!dir) return 0;
+
+    int found = 0;
+    int online = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s/online", POWER_SUPPLY_DIR, entry->d_name);
+        FILE *f = fopen(path, "r");
+        if (!f) continue; // Batteries have no online file
+
+        int value = 0;
+        if (fscanf(f, "%d", &value) == 1) {
+            found = 1;
+            if (value) online = 1;
+        }
+        fclose(f);
+    }
+    closedir(dir);
+
+    return found && !online;
+}
+
+static inline void power_policy_init(PowerPolicy *p, int min_fps, int enabled, int idle_minutes, int allow_blank) {
+    SDL_memset(p, 0, sizeof(*p));
+    if (idle_minutes < 1) idle_minutes = 1;
+    if (min_fps < power_ladder[POWER_LADDER_STEPS - 1]) min_fps = power_ladder[POWER_LADDER_STEPS - 1];
+    if (min_fps > power_ladder[0]) min_fps = power_ladder[0];
+
+    p->enabled = enabled;
+    p->min_fps = min_fps;
+    p->allow_blank = allow_blank;
+    p->step_ms = (Uint32)idle_minutes * 60000;
+    p->fps = power_ladder[0];
+    p->run_start = SDL_GetTicks();
+    p->start_ticks = p->run_start;
+    p->last_frame = p->start_ticks;
+
+    if (enabled) {
+        p->on_battery = power_policy_read_battery();
+        p->last_check = p->start_ticks;
+        SDL_Log("Power policy: %s, minimum useful rate %d fps, stepping down every %d min",
+                p->on_battery ? "on battery" : "on AC power", min_fps, idle_minutes);
+    }
+}
+
+static inline void power_policy_update_rate(PowerPolicy *p, Uint32 now) {
+    Uint32 elapsed = now - p->start_ticks;
+    int rung;
+    if (p->on_battery) {
+        rung = 1 + (int)(elapsed / (p->step_ms / 2));
+    } else {
+        rung = (int)(elapsed / p->step_ms);
+    }
+
+    // Walk down the ladder, skipping rates below the saver's useful minimum
+    int fps = 0;
+    int last_useful = power_ladder[0];
+    for (int i = 0; i < POWER_LADDER_STEPS; i++) {
+        if (power_ladder[i] < p->min_fps) break;
+        last_useful = power_ladder[i];
+        if (i == rung) { fps = power_ladder[i]; break; }
+    }
+    if (fps == 0 && !p->allow_blank) fps = last_useful;
+
+    int blank = (fps == 0);
+    if (fps != p->fps || blank != p->blank) {
+        if (blank) {
+            SDL_Log("Power policy: blanking after %u s", (unsigned)(elapsed / 1000));
+        } else {
+            SDL_Log("Power policy: %d fps -> %d fps", p->fps, fps);
+        }
+        if (!blank) p->blank_presented = 0;
+        p->fps = fps;
+        p->blank = blank;
+    }
+}
+
+/**
+ * Call at the top of the main loop. Re-evaluates the frame rate and returns
+ * the seconds elapsed since the previous frame, so savers animate by time
+ * rather than by frame count.
+ */
+static inline float power_policy_begin_frame(PowerPolicy *p) {
+    Uint32 now = SDL_GetTicks();
+    float dt = (now - p->last_frame) / 1000.0f;
+    if (dt > POWER_MAX_DT) dt = POWER_MAX_DT;
+    p->last_frame = now;
+    p->frame_start = now;
+
+    if (p->enabled) {
+        if (now - p->last_check >= POWER_RECHECK_MS) {
+            int on_battery = power_policy_read_battery();
+            if (on_battery != p->on_battery) {
+                SDL_Log("Power policy: switched to %s", on_battery ? "battery" : "AC power");
+                p->on_battery = on_battery;
+                if (!on_battery) p->start_ticks = now; // Plugged in: start the ladder over
+            }
+            p->last_check = now;
+        }
+        power_policy_update_rate(p, now);
+    }
+    if (!p->blank) p->frames++;
+    return dt;
+}
+
+static inline int power_policy_is_blank(const PowerPolicy *p) {
+    return p->blank;
+}
+
+/**
+ * Call after SDL_RenderPresent. Sleeps until the next frame is due or an
+ * event arrives, whichever comes first.
+ */
+static inline void power_policy_wait(PowerPolicy *p) {
+    Uint32 period = p->blank ? POWER_BLANK_WAIT_MS : 1000 / (Uint32)p->fps;
+    Uint32 elapsed = SDL_GetTicks() - p->frame_start;
+    if (elapsed < period) {
+        SDL_WaitEventTimeout(NULL, (int)(period - elapsed));
+    }
+}
+
+static inline void power_policy_log_summary(const PowerPolicy *p, const char *saver) {
+    Uint32 runtime = SDL_GetTicks() - p->run_start;
+    if (p->blank) {
+        SDL_Log("%s: %u frames in %u s (avg %.1f fps), ended blanked",
+                saver, (unsigned)p->frames, (unsigned)(runtime / 1000),
+                runtime ? p->frames * 1000.0f / runtime : 0.0f);
+    } else {
+        SDL_Log("%s: %u frames in %u s (avg %.1f fps), ended at %d fps",
+                saver, (unsigned)p->frames, (unsigned)(runtime / 1000),
+                runtime ? p->frames * 1000.0f / runtime : 0.0f, p->fps);
+    }
+}
+
+#endif
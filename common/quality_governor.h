@@ -0,0 +1,253 @@
+/**
+ * Adaptive Quality Governor
+ * Shared frame pacing and density scaling for the BeforeLight screensavers
+ *
+ * Each saver registers its density knobs (star count, active streams, drops,
+ * particles, ...) together with the bounds they may move in. The governor
+ * paces the main loop, keeps a 1 ms histogram of frame intervals and derives
+ * one quality scale from it. The scale is applied to every knob relative to
+ * the value the knob had when it was registered, so scale 1.0 is exactly the
+ * saver's normal look.
+ *
+ * Hysteresis keeps the scene from pulsing:
+ * - Down: a window with more than GOVERNOR_MISS_RATIO late frames cuts the
+ *   scale by GOVERNOR_STEP_DOWN. If the overload follows an upward probe the
+ *   probe is simply undone instead, and the failing level becomes a ceiling
+ * - Up: only after GOVERNOR_CALM_WINDOWS clean windows in a row, in small
+ *   GOVERNOR_STEP_UP probes, and never past a ceiling that is still held.
+ *   Each failure at the same ceiling doubles how long it is held.
+ *
+ * Usage:
+ *   QualityGovernor gov;
+ *   governor_init(&gov, 60, enabled);
+ *   governor_register_knob(&gov, "streams", &stream_target, 40, MAX_STREAMS);
+ *   while (running) {
+ *       governor_begin_frame(&gov);
+ *       ... update and render using stream_target ...
+ *       SDL_RenderPresent(renderer);
+ *       governor_end_frame(&gov); // replaces SDL_Delay(16)
+ *   }
+ */
+
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#include <SDL.h>
+
+#define GOVERNOR_MAX_KNOBS 8
+#define GOVERNOR_HIST_BUCKETS 64          // 1 ms buckets, last one collects anything slower
+#define GOVERNOR_WINDOW_FRAMES 60         // Frames per evaluation window (~1 s at 60 fps)
+#define GOVERNOR_LATE_FACTOR 1.15f        // Interval above 1.15x the target period counts as late
+#define GOVERNOR_MISS_RATIO 0.10f         // More than 10% late frames -> overloaded window
+#define GOVERNOR_CLEAN_RATIO 0.02f        // At most 2% late frames -> clean window
+#define GOVERNOR_STEP_DOWN 0.20f          // Fraction of the scale dropped per overloaded window
+#define GOVERNOR_STEP_UP 0.05f            // Scale gained per upward probe
+#define GOVERNOR_CALM_WINDOWS 5           // Clean windows required before each upward probe
+#define GOVERNOR_CEILING_HOLD_WINDOWS 30  // Windows a failed level stays off limits (first failure)
+#define GOVERNOR_CEILING_HOLD_MAX 960     // Backoff cap (~16 min)
+#define GOVERNOR_MIN_SCALE 0.05f
+
+typedef struct {
+    const char *name;
+    int *value;         // Saver-owned knob, written by the governor
+    int base;           // Value at registration (scale 1.0)
+    int min, max;       // Bounds the knob may move in
+} GovernorKnob;
+
+typedef struct {
+    int enabled;
+    float target_ms;                      // Target frame period
+    Uint64 freq;
+    Uint64 frame_start;
+    Uint64 last_frame_start;
+
+    // Sliding window histogram of frame intervals
+    int window_hist[GOVERNOR_HIST_BUCKETS];
+    int window_frames;
+    int window_late;
+
+    // Whole-run histogram for the exit summary
+    int total_hist[GOVERNOR_HIST_BUCKETS];
+    int total_frames;
+
+    float scale;
+    float max_scale;
+    float ceiling;                        // Scale that last overloaded us
+    int ceiling_hold;                     // Windows left before the ceiling is lifted
+    int ceiling_backoff;                  // Hold length used for the next failure
+    int calm_windows;
+    int last_step_up;                     // Previous window was an upward probe
+    float probe_from;                     // Scale the last upward probe started from
+
+    GovernorKnob knobs[GOVERNOR_MAX_KNOBS];
+    int knob_count;
+} QualityGovernor;
+
+static inline void governor_init(QualityGovernor *g, int target_fps, int enabled) {
+    SDL_memset(g, 0, sizeof(*g));
+    if (target_fps < 1) target_fps = 60;
+    g->enabled = enabled;
+    g->target_ms = 1000.0f / target_fps;
+    g->freq = SDL_GetPerformanceFrequency();
+    g->scale = 1.0f;
+    g->max_scale = 1.0f;
+    g->ceiling = 0.0f;
+    g->ceiling_backoff = GOVERNOR_CEILING_HOLD_WINDOWS;
+}
+
+/**
+ * Register a density knob. The knob's current value is its scale 1.0 value;
+ * the governor keeps it within [min, max] from then on.
+ */
+static inline int governor_register_knob(QualityGovernor *g, const char *name, int *value, int min, int max) {
+    if (g->knob_count >= GOVERNOR_MAX_KNOBS || !value) return -1;
+    if (min > max) { int t = min; min = max; max = t; }
+
+    GovernorKnob *k = &g->knobs[g->knob_count];
+    k->name = name;
+    k->value = value;
+    k->base = *value < min ? min : (*value > max ? max : *value);
+    k->min = min;
+    k->max = max;
+    *value = k->base;
+
+    // Headroom above the default look is only available up to the loosest knob
+    if (k->base > 0) {
+        float knob_max_scale = (float)max / (float)k->base;
+        if (knob_max_scale > g->max_scale) g->max_scale = knob_max_scale;
+    }
+    return g->knob_count++;
+}
+
+static inline void governor_apply(QualityGovernor *g) {
+    for (int i = 0; i < g->knob_count; i++) {
+        GovernorKnob *k = &g->knobs[i];
+        int v = (int)(k->base * g->scale + 0.5f);
+        if (v < k->min) v = k->min;
+        if (v > k->max) v = k->max;
+        *k->value = v;
+    }
+}
+
+static inline float governor_percentile(const int *hist, int frames, float pct) {
+    int wanted = (int)(frames * pct);
+    int seen = 0;
+    for (int b = 0; b < GOVERNOR_HIST_BUCKETS; b++) {
+        seen += hist[b];
+        if (seen > wanted) return (float)b + 1.0f;
+    }
+    return (float)GOVERNOR_HIST_BUCKETS;
+}
+
+static inline void governor_evaluate_window(QualityGovernor *g) {
+    float late_ratio = (float)g->window_late / (float)g->window_frames;
+    float old_scale = g->scale;
+
+    if (g->ceiling_hold > 0 && --g->ceiling_hold == 0) {
+        g->ceiling = 0.0f; // Allow probing past the old failure point again
+    }
+
+    if (late_ratio > GOVERNOR_MISS_RATIO) {
+        g->ceiling = g->scale;
+        g->ceiling_hold = g->ceiling_backoff;
+        if (g->last_step_up) {
+            // Failed probe: undo it and wait longer before trying this level again
+            g->scale = g->probe_from;
+            g->ceiling_backoff *= 2;
+            if (g->ceiling_backoff > GOVERNOR_CEILING_HOLD_MAX) g->ceiling_backoff = GOVERNOR_CEILING_HOLD_MAX;
+        } else {
+            g->scale *= 1.0f - GOVERNOR_STEP_DOWN;
+            g->ceiling_backoff = GOVERNOR_CEILING_HOLD_WINDOWS;
+        }
+        if (g->scale < GOVERNOR_MIN_SCALE) g->scale = GOVERNOR_MIN_SCALE;
+        g->calm_windows = 0;
+        g->last_step_up = 0;
+    } else if (late_ratio <= GOVERNOR_CLEAN_RATIO) {
+        g->last_step_up = 0;
+        if (++g->calm_windows >= GOVERNOR_CALM_WINDOWS) {
+            float next = g->scale + GOVERNOR_STEP_UP;
+            if (g->ceiling > 0.0f && next >= g->ceiling) next = g->scale; // Stay under the failed level
+            if (next > g->max_scale) next = g->max_scale;
+            g->last_step_up = next > g->scale;
+            g->probe_from = g->scale;
+            g->scale = next;
+            g->calm_windows = 0;
+        }
+    } else {
+        g->calm_windows = 0; // Borderline window: hold steady
+        g->last_step_up = 0;
+    }
+
+    if (g->scale != old_scale) {
+        governor_apply(g);
+        SDL_Log("Quality governor: scale %.2f -> %.2f (p95 %.0f ms, %d%% late)",
+                old_scale, g->scale,
+                governor_percentile(g->window_hist, g->window_frames, 0.95f),
+                (int)(late_ratio * 100.0f));
+    }
+
+    SDL_memset(g->window_hist, 0, sizeof(g->window_hist));
+    g->window_frames = 0;
+    g->window_late = 0;
+}
+
+/**
+ * Call at the top of the main loop. Records the interval since the previous
+ * frame and re-evaluates the quality scale once per window.
+ */
+static inline void governor_begin_frame(QualityGovernor *g) {
+    g->frame_start = SDL_GetPerformanceCounter();
+    if (g->last_frame_start == 0) {
+        g->last_frame_start = g->frame_start;
+        return;
+    }
+
+    float interval_ms = (float)(g->frame_start - g->last_frame_start) * 1000.0f / (float)g->freq;
+    g->last_frame_start = g->frame_start;
+
+    int bucket = (int)interval_ms;
+    if (bucket < 0) bucket = 0;
+    if (bucket >= GOVERNOR_HIST_BUCKETS) bucket = GOVERNOR_HIST_BUCKETS - 1;
+    g->window_hist[bucket]++;
+    g->total_hist[bucket]++;
+    g->window_frames++;
+    g->total_frames++;
+    if (interval_ms > g->target_ms * GOVERNOR_LATE_FACTOR) g->window_late++;
+
+    if (g->window_frames >= GOVERNOR_WINDOW_FRAMES) {
+        if (g->enabled && g->knob_count > 0) {
+            governor_evaluate_window(g);
+        } else {
+            SDL_memset(g->window_hist, 0, sizeof(g->window_hist));
+            g->window_frames = 0;
+            g->window_late = 0;
+        }
+    }
+}
+
+/**
+ * Call after SDL_RenderPresent. Sleeps for whatever is left of the target
+ * period, so a vsync'd present that already waited costs no extra delay.
+ */
+static inline void governor_end_frame(QualityGovernor *g) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    float elapsed_ms = (float)(now - g->frame_start) * 1000.0f / (float)g->freq;
+    if (elapsed_ms < g->target_ms) {
+        SDL_Delay((Uint32)(g->target_ms - elapsed_ms));
+    }
+}
+
+static inline void governor_log_summary(const QualityGovernor *g, const char *saver) {
+    if (g->total_frames == 0) return;
+    SDL_Log("%s: %d frames, p50 %.0f ms, p95 %.0f ms, p99 %.0f ms, final quality scale %.2f",
+            saver, g->total_frames,
+            governor_percentile(g->total_hist, g->total_frames, 0.50f),
+            governor_percentile(g->total_hist, g->total_frames, 0.95f),
+            governor_percentile(g->total_hist, g->total_frames, 0.99f),
+            g->scale);
+    for (int i = 0; i < g->knob_count; i++) {
+        SDL_Log("  %s = %d (range %d-%d)", g->knobs[i].name, *g->knobs[i].value, g->knobs[i].min, g->knobs[i].max);
+    }
+}
+
+#endif
@@ -0,0 +1,473 @@
+/**
+ * Quote Fetcher
+ * Background quote source for the BeforeLight message savers
+ *
+ * Fetching a quote can take a whole HTTP round trip, or a timeout when the
+ * machine is offline, so it never happens on the render thread. A fetcher
+ * thread keeps up to `depth` quotes ready in a single-producer,
+ * single-consumer ring; the render loop takes one with quote_fetcher_poll,
+ * which only touches two atomics and never waits.
+ *
+ * Sources are pluggable:
+ *   QUOTE_SOURCE_URL      fetched with curl; quotable.io style JSON
+ *                         ("content":"...") or plain text
+ *   QUOTE_SOURCE_FILE     a random non-empty line of a local file
+ *   QUOTE_SOURCE_COMMAND  the first line printed by a shell command
+ *                         (JSON handled as for URLs)
+ *
+ * Every quote fetched from a URL or command is appended to a disk cache
+ * ($XDG_CACHE_HOME or ~/.cache, beforelight-quotes.txt). When the source
+ * fails, random cached quotes keep the queue filled, so the savers still
+ * rotate quotes offline. A cached (or built-in) quote is queued before the
+ * thread starts, so the first poll already has text while the first fetch
+ * is still in flight.
+ * utils/quote_stub.py serves quotes locally for testing:
+ *   python3 utils/quote_stub.py 8000 &
+ *   ./build/messages -u http://127.0.0.1:8000/random
+ *
+ * Stopping never waits on a fetch in flight: the thread is detached and
+ * frees the shared state itself when its fetch returns.
+ *
+ * Usage:
+ *   QuoteFetcher *quotes = quote_fetcher_start(QUOTE_SOURCE_URL, QUOTE_DEFAULT_URL, 4);
+ *   while (running) {
+ *       if (quote_fetcher_poll(quotes, text, sizeof(text))) ... show text ...
+ *   }
+ *   quote_fetcher_stop(quotes, "messages");
+ */
+
+#ifndef QUOTE_FETCHER_H
+#define QUOTE_FETCHER_H
+
+#include <SDL.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define QUOTE_DEFAULT_URL "http://api.quotable.io/random"
+#define QUOTE_MAX_LEN 1024
+#define QUOTE_QUEUE_MAX 16              // Ring slots; one always stays empty
+#define QUOTE_CACHE_MAX 500             // Quotes kept on disk
+#define QUOTE_TIMEOUT_S 10              // curl --max-time
+#define QUOTE_RETRY_MS 30000            // Wait after a failed fetch
+#define QUOTE_IDLE_MS 1000              // Recheck while the queue is full
+
+// Shown at startup when nothing is cached yet
+static const char *const quote_builtin[] = {
+    "The best way out is always through.",
+    "Simplicity is prerequisite for reliability.",
+    "Well done is better than well said.",
+    "Nothing will work unless you do.",
+};
+
+typedef enum {
+    QUOTE_SOURCE_URL,
+    QUOTE_SOURCE_FILE,
+    QUOTE_SOURCE_COMMAND
+} QuoteSourceKind;
+
+typedef struct {
+    QuoteSourceKind kind;
+    char location[QUOTE_MAX_LEN];       // URL, file path or shell command
+    int depth;                          // Quotes to keep ready
+
+    // Ring written only by the fetcher (head) and read only by the saver (tail)
+    char queue[QUOTE_QUEUE_MAX][QUOTE_MAX_LEN];
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+
+    SDL_Thread *thread;
+    SDL_mutex *lock;                    // Only for sleeping on `wake`
+    SDL_cond *wake;
+    SDL_atomic_t quit;
+    SDL_atomic_t refs;                  // Saver and thread; the last one out frees
+
+    // Fetcher thread only (and quote_fetcher_start before the thread runs)
+    char cache_path[512];
+    char **cache;
+    int cache_count;
+    Uint32 retry_at;                    // SDL_GetTicks time to try the source again
+
+    // Written by the thread, read for the exit summary
+    SDL_atomic_t fetched;
+    SDL_atomic_t cached_served;
+    SDL_atomic_t failures;
+} QuoteFetcher;
+
+/**
+ * Four hex digits of a \u escape, or -1
+ */
+static inline int quote_hex4(const char *p) {
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        int digit = c >= '0' && c <= '9' ? c - '0'
+                  : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                  : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+        if (digit < 0) return -1;
+        value = value * 16 + digit;
+    }
+    return value;
+}
+
+/**
+ * Append `code` as UTF-8 if it fits in out[n..size-1). Returns the new length.
+ */
+static inline size_t quote_put_utf8(char *out, size_t n, size_t size, Uint32 code) {
+    char buf[4];
+    size_t len;
+    if (code < 0x80) {
+        buf[0] = (char)code;
+        len = 1;
+    } else if (code < 0x800) {
+        buf[0] = (char)(0xC0 | (code >> 6));
+        buf[1] = (char)(0x80 | (code & 0x3F));
+        len = 2;
+    } else if (code < 0x10000) {
+        buf[0] = (char)(0xE0 | (code >> 12));
+        buf[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+        buf[2] = (char)(0x80 | (code & 0x3F));
+        len = 3;
+    } else {
+        buf[0] = (char)(0xF0 | (code >> 18));
+        buf[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+        buf[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+        buf[3] = (char)(0x80 | (code & 0x3F));
+        len = 4;
+    }
+    if (n + len >= size) return n;
+    memcpy(out + n, buf, len);
+    return n + len;
+}
+
+/**
+ * Pull the text out of a quotable.io style reply ("content":"..."),
+ * decoding JSON escapes (\uXXXX and surrogate pairs to UTF-8, line
+ * breaks and tabs to spaces); anything else is taken as plain text.
+ * Trailing whitespace is trimmed. Returns the length.
+ */
+static inline int quote_parse(const char *reply, char *out, size_t size) {
+    const char *p = strstr(reply, "\"content\"");
+    size_t n = 0;
+    if (p && (p = strchr(p + 9, ':')) && (p = strchr(p, '"'))) {
+        for (p++; *p && *p != '"' && n + 1 < size; p++) {
+            if (*p != '\\' || !p[1]) {
+                out[n++] = *p;
+                continue;
+            }
+            p++;
+            switch (*p) {
+                case 'n': case 'r': case 't':
+                    out[n++] = ' ';
+                    break;
+                case 'b': case 'f':
+                    break;
+                case 'u': {
+                    int code = quote_hex4(p + 1);
+                    if (code < 0) {
+                        out[n++] = *p; // Malformed: keep the text as is
+                        break;
+                    }
+                    p += 4;
+                    if (code >= 0xD800 && code <= 0xDBFF && p[1] == '\\' && p[2] == 'u') {
+                        int low = quote_hex4(p + 3);
+                        if (low >= 0xDC00 && low <= 0xDFFF) {
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                            p += 6;
+                        }
+                    }
+                    if (code >= 0xD800 && code <= 0xDFFF) code = 0xFFFD; // Lone surrogate
+                    n = quote_put_utf8(out, n, size, (Uint32)code);
+                    break;
+                }
+                default:
+                    out[n++] = *p; // \" \\ \/
+                    break;
+            }
+        }
+    } else {
+        for (p = reply; *p && *p != '\n' && n + 1 < size; p++) {
+            out[n++] = *p;
+        }
+    }
+    while (n > 0 && (out[n - 1] == ' ' || out[n - 1] == '\r' || out[n - 1] == '\t')) n--;
+    out[n] = '\0';
+    return (int)n;
+}
+
+static inline int quote_run(const char *command, char *out, size_t size) {
+    FILE *fp = popen(command, "r");
+    if (!fp) return 0;
+    char reply[QUOTE_MAX_LEN * 2];
+    size_t got = fread(reply, 1, sizeof(reply) - 1, fp);
+    reply[got] = '\0';
+    int status = pclose(fp);
+    if (status != 0) return 0;
+    return quote_parse(reply, out, size);
+}
+
+/**
+ * A random non-empty line of `path`, by reservoir sampling in one pass
+ */
+static inline int quote_from_file(const char *path, char *out, size_t size) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return 0;
+    char line[QUOTE_MAX_LEN];
+    int seen = 0;
+    out[0] = '\0';
+    while (fgets(line, sizeof(line), fp)) {
+        char text[QUOTE_MAX_LEN];
+        if (quote_parse(line, text, sizeof(text)) == 0) continue;
+        if (rand() % ++seen == 0) {
+            SDL_strlcpy(out, text, size);
+        }
+    }
+    fclose(fp);
+    return (int)strlen(out);
+}
+
+/**
+ * Append `arg` to `out` in single quotes, a quote inside it as '\''.
+ * Returns 0 if it does not fit.
+ */
+static inline int quote_shell_arg(char *out, size_t size, const char *arg) {
+    size_t n = strlen(out);
+    if (n + 3 > size) return 0;
+    out[n++] = '\'';
+    for (; *arg; arg++) {
+        const char *piece = *arg == '\'' ? "'\\''" : NULL;
+        size_t len = piece ? 4 : 1;
+        if (n + len + 2 > size) return 0; // Room for the closing quote too
+        if (piece) {
+            memcpy(out + n, piece, len);
+        } else {
+            out[n] = *arg;
+        }
+        n += len;
+    }
+    out[n++] = '\'';
+    out[n] = '\0';
+    return 1;
+}
+
+static inline int quote_fetch(QuoteFetcher *f, char *out, size_t size) {
+    char command[QUOTE_MAX_LEN * 4 + 64];
+    switch (f->kind) {
+        case QUOTE_SOURCE_URL:
+            snprintf(command, sizeof(command), "curl -sf --max-time %d ", QUOTE_TIMEOUT_S);
+            if (!quote_shell_arg(command, sizeof(command), f->location)) return 0;
+            return quote_run(command, out, size);
+        case QUOTE_SOURCE_COMMAND:
+            return quote_run(f->location, out, size);
+        case QUOTE_SOURCE_FILE:
+            return quote_from_file(f->location, out, size);
+    }
+    return 0;
+}
+
+/**
+ * Create `dir` and any missing parents. Returns 0 once it exists.
+ */
+static inline int quote_make_dirs(const char *dir) {
+    char path[512];
+    SDL_strlcpy(path, dir, sizeof(path));
+    for (char *p = path + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        if (mkdir(path, 0755) != 0 && errno != EEXIST) return -1;
+        *p = '/';
+    }
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) return -1;
+    return 0;
+}
+
+static inline void quote_cache_load(QuoteFetcher *f) {
+    // $XDG_CACHE_HOME, else ~/.cache; /tmp when neither can be used
+    char dir[512] = "";
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    if (xdg && xdg[0] == '/') {
+        SDL_strlcpy(dir, xdg, sizeof(dir));
+    } else if (home && home[0]) {
+        snprintf(dir, sizeof(dir), "%s/.cache", home);
+    }
+    if (dir[0] && quote_make_dirs(dir) == 0) {
+        snprintf(f->cache_path, sizeof(f->cache_path), "%s/beforelight-quotes.txt", dir);
+    } else {
+        SDL_strlcpy(f->cache_path, "/tmp/beforelight-quotes.txt", sizeof(f->cache_path)); // fallback
+    }
+
+    f->cache = calloc(QUOTE_CACHE_MAX, sizeof(char *));
+    if (!f->cache) return;
+    FILE *fp = fopen(f->cache_path, "r");
+    if (!fp) return;
+    char line[QUOTE_MAX_LEN];
+    while (f->cache_count < QUOTE_CACHE_MAX && fgets(line, sizeof(line), fp)) {
+        char text[QUOTE_MAX_LEN];
+        if (quote_parse(line, text, sizeof(text)) == 0) continue;
+        f->cache[f->cache_count] = SDL_strdup(text);
+        if (f->cache[f->cache_count]) f->cache_count++;
+    }
+    fclose(fp);
+}
+
+/**
+ * Remember a fetched quote; once the cache is full the oldest half is
+ * dropped and the file rewritten
+ */
+static inline void quote_cache_add(QuoteFetcher *f, const char *text) {
+    if (!f->cache) return;
+    for (int i = 0; i < f->cache_count; i++) {
+        if (strcmp(f->cache[i], text) == 0) return;
+    }
+
+    int rewrite = 0;
+    if (f->cache_count == QUOTE_CACHE_MAX) {
+        int drop = QUOTE_CACHE_MAX / 2;
+        for (int i = 0; i < drop; i++) SDL_free(f->cache[i]);
+        memmove(f->cache, f->cache + drop, sizeof(char *) * (QUOTE_CACHE_MAX - drop));
+        f->cache_count -= drop;
+        rewrite = 1;
+    }
+    char *copy = SDL_strdup(text);
+    if (!copy) return;
+    f->cache[f->cache_count++] = copy;
+
+    FILE *fp = fopen(f->cache_path, rewrite ? "w" : "a");
+    if (!fp) return;
+    for (int i = rewrite ? 0 : f->cache_count - 1; i < f->cache_count; i++) {
+        fprintf(fp, "%s\n", f->cache[i]);
+    }
+    fclose(fp);
+}
+
+static inline int quote_queue_count(QuoteFetcher *f) {
+    return (SDL_AtomicGet(&f->head) - SDL_AtomicGet(&f->tail) + QUOTE_QUEUE_MAX) % QUOTE_QUEUE_MAX;
+}
+
+static inline void quote_fetcher_release(QuoteFetcher *f) {
+    if (!SDL_AtomicDecRef(&f->refs)) return;
+    if (f->cache) {
+        for (int i = 0; i < f->cache_count; i++) SDL_free(f->cache[i]);
+        free(f->cache);
+    }
+    if (f->wake) SDL_DestroyCond(f->wake);
+    if (f->lock) SDL_DestroyMutex(f->lock);
+    free(f);
+}
+
+static inline void quote_fetcher_sleep(QuoteFetcher *f, Uint32 ms) {
+    SDL_LockMutex(f->lock);
+    if (!SDL_AtomicGet(&f->quit)) SDL_CondWaitTimeout(f->wake, f->lock, ms);
+    SDL_UnlockMutex(f->lock);
+}
+
+/**
+ * Fill the slot at head, then publish it by moving head past it
+ */
+static inline void quote_fetcher_push(QuoteFetcher *f, const char *text) {
+    int head = SDL_AtomicGet(&f->head);
+    SDL_strlcpy(f->queue[head], text, QUOTE_MAX_LEN);
+    SDL_AtomicSet(&f->head, (head + 1) % QUOTE_QUEUE_MAX);
+}
+
+static inline int quote_fetcher_thread(void *data) {
+    QuoteFetcher *f = data;
+    char text[QUOTE_MAX_LEN];
+    while (!SDL_AtomicGet(&f->quit)) {
+        if (quote_queue_count(f) >= f->depth) {
+            quote_fetcher_sleep(f, QUOTE_IDLE_MS);
+            continue;
+        }
+
+        if (SDL_AtomicGet(&f->failures) == 0 || SDL_TICKS_PASSED(SDL_GetTicks(), f->retry_at)) {
+            if (quote_fetch(f, text, sizeof(text)) > 0) {
+                SDL_AtomicAdd(&f->fetched, 1);
+                if (f->kind != QUOTE_SOURCE_FILE) quote_cache_add(f, text);
+                quote_fetcher_push(f, text);
+                continue;
+            }
+            // Offline (or the source is broken): leave it alone for a while
+            SDL_AtomicAdd(&f->failures, 1);
+            f->retry_at = SDL_GetTicks() + QUOTE_RETRY_MS;
+        }
+
+        // Meanwhile keep the queue topped up from the cache
+        while (f->cache_count > 0 && quote_queue_count(f) < f->depth) {
+            quote_fetcher_push(f, f->cache[rand() % f->cache_count]);
+            SDL_AtomicAdd(&f->cached_served, 1);
+        }
+        quote_fetcher_sleep(f, QUOTE_IDLE_MS);
+    }
+
+    quote_fetcher_release(f);
+    return 0;
+}
+
+/**
+ * Start fetching from `location` with `depth` quotes kept ready. Returns
+ * NULL if the thread cannot be started.
+ */
+static inline QuoteFetcher *quote_fetcher_start(QuoteSourceKind kind, const char *location, int depth) {
+    QuoteFetcher *f = calloc(1, sizeof(QuoteFetcher));
+    if (!f) return NULL;
+    f->kind = kind;
+    SDL_strlcpy(f->location, location, sizeof(f->location));
+    if (depth < 1) depth = 1;
+    if (depth > QUOTE_QUEUE_MAX - 1) depth = QUOTE_QUEUE_MAX - 1;
+    f->depth = depth;
+    SDL_AtomicSet(&f->refs, 2);
+
+    // Something to show right away: a cached quote, or a built-in one. The
+    // thread fetches a fresh quote straight after.
+    if (kind != QUOTE_SOURCE_FILE) quote_cache_load(f);
+    if (f->cache_count > 0) {
+        quote_fetcher_push(f, f->cache[rand() % f->cache_count]);
+        SDL_AtomicAdd(&f->cached_served, 1);
+    } else {
+        quote_fetcher_push(f, quote_builtin[rand() % (sizeof(quote_builtin) / sizeof(quote_builtin[0]))]);
+    }
+
+    f->lock = SDL_CreateMutex();
+    f->wake = SDL_CreateCond();
+    if (f->lock && f->wake) {
+        f->thread = SDL_CreateThread(quote_fetcher_thread, "quotes", f);
+    }
+    if (!f->thread) {
+        SDL_AtomicSet(&f->refs, 1);
+        quote_fetcher_release(f);
+        return NULL;
+    }
+    return f;
+}
+
+/**
+ * Take the next ready quote, if there is one. Never blocks.
+ */
+static inline int quote_fetcher_poll(QuoteFetcher *f, char *out, size_t size) {
+    int tail = SDL_AtomicGet(&f->tail);
+    if (tail == SDL_AtomicGet(&f->head)) return 0;
+    SDL_strlcpy(out, f->queue[tail], size);
+    SDL_AtomicSet(&f->tail, (tail + 1) % QUOTE_QUEUE_MAX);
+
+    // A free slot: nudge the fetcher. Signalling without the lock can miss
+    // a fetcher that is about to sleep; it rechecks every QUOTE_IDLE_MS.
+    SDL_CondSignal(f->wake);
+    return 1;
+}
+
+static inline void quote_fetcher_stop(QuoteFetcher *f, const char *saver) {
+    if (!f) return;
+    SDL_Log("%s: %d quotes fetched, %d served from cache, %d failed fetches",
+            saver, SDL_AtomicGet(&f->fetched), SDL_AtomicGet(&f->cached_served), SDL_AtomicGet(&f->failures));
+    SDL_AtomicSet(&f->quit, 1);
+    SDL_LockMutex(f->lock);
+    SDL_CondSignal(f->wake);
+    SDL_UnlockMutex(f->lock);
+    SDL_DetachThread(f->thread);
+    quote_fetcher_release(f);
+}
+
+#endif
@@ -0,0 +1,518 @@
+/**
+ * Software Rasterizer
+ * Tiled, multithreaded CPU drawing for BeforeLight savers without a GPU
+ *
+ * SDL's software renderer draws every point, line and rect as a separate
+ * single-threaded call, which falls over once a saver has thousands of
+ * small primitives. A SoftRaster records the frame's primitives instead,
+ * bins them into SOFT_RASTER_TILE pixel squares, and rasterizes the tiles in
+ * parallel on a thread pool, four pixels per SIMD step: opaque spans are
+ * plain stores, translucent spans and anti-aliased edges share one vector
+ * blend. Every tile draws its primitives in the order they were queued, so
+ * overlaps look the same as on the GPU path. The finished ARGB8888 frame is
+ * uploaded to one streaming texture and copied to the screen.
+ *
+ * Savers offer it as `-R cpu`. Coordinates are in framebuffer pixels and
+ * colors use straight alpha, blended as SDL_BLENDMODE_BLEND.
+ *
+ * Usage:
+ *   SoftRaster raster;
+ *   soft_raster_init(&raster, renderer, W, H, 0);   // 0 = one thread per core
+ *   while (running) {
+ *       soft_raster_clear(&raster, 0xFF000000);
+ *       soft_raster_disc(&raster, x, y, radius, color);
+ *       soft_raster_flush(&raster, renderer);        // Rasterize, upload, copy
+ *       SDL_RenderPresent(renderer);
+ *   }
+ *   soft_raster_log_summary(&raster, "saver");
+ *   soft_raster_destroy(&raster);
+ */
+
+#ifndef SOFT_RASTER_H
+#define SOFT_RASTER_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <math.h>
+#include "simd.h"
+#include "thread_pool.h"
+
+#define SOFT_RASTER_TILE 64
+
+enum {
+    SOFT_RASTER_RECT,
+    SOFT_RASTER_DISC,
+    SOFT_RASTER_LINE,
+};
+
+typedef struct {
+    int kind;
+    Uint32 color;                       // ARGB with straight alpha
+    int x0, y0, x1, y1;                 // Covered pixels, clipped, end exclusive
+    float ax, ay, bx, by;               // Disc centre in ax, ay; line end points
+    float size;                         // Disc radius or line half width
+} SoftRasterCmd;
+
+typedef struct {
+    int w, h;
+    Uint32 *pixels;                     // w * h opaque ARGB8888
+    SDL_Texture *texture;
+
+    // Background for the frame being recorded
+    Uint32 clear_color;
+    const Uint32 *clear_image;          // w * h pixels, or NULL for clear_color
+    int clear_pitch;                    // In pixels
+
+    SoftRasterCmd *cmds;
+    int count;
+    int capacity;
+
+    int tiles_x, tiles_y;
+    int *bin_start;                     // tiles + 1 offsets into bin_cmd
+    int *bin_fill;
+    int *bin_cmd;                       // Command indices per tile, in queue order
+    size_t bin_capacity;
+
+    ThreadPool pool;
+
+    // Statistics for the exit summary
+    Uint32 frames;
+    Uint64 primitives;
+    Uint64 raster_ticks;
+    Uint64 upload_ticks;
+} SoftRaster;
+
+static inline void soft_raster_destroy(SoftRaster *r) {
+    thread_pool_destroy(&r->pool);
+    if (r->texture) SDL_DestroyTexture(r->texture);
+    free(r->pixels);
+    free(r->cmds);
+    free(r->bin_start);
+    free(r->bin_fill);
+    free(r->bin_cmd);
+    SDL_memset(r, 0, sizeof(*r));
+}
+
+/**
+ * Allocate a w x h framebuffer and its streaming texture and start
+ * `threads` raster threads (0 = one per core). Returns 0 on success.
+ */
+static inline int soft_raster_init(SoftRaster *r, SDL_Renderer *renderer, int w, int h, int threads) {
+    SDL_memset(r, 0, sizeof(*r));
+    r->w = w;
+    r->h = h;
+    r->clear_color = 0xFF000000;
+    r->tiles_x = (w + SOFT_RASTER_TILE - 1) / SOFT_RASTER_TILE;
+    r->tiles_y = (h + SOFT_RASTER_TILE - 1) / SOFT_RASTER_TILE;
+    int tiles = r->tiles_x * r->tiles_y;
+
+    r->pixels = malloc(sizeof(Uint32) * (size_t)w * h);
+    r->bin_start = malloc(sizeof(int) * (tiles + 1));
+    r->bin_fill = malloc(sizeof(int) * tiles);
+    r->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, w, h);
+    if (!r->pixels || !r->bin_start || !r->bin_fill || !r->texture) {
+        soft_raster_destroy(r);
+        return -1;
+    }
+    SDL_SetTextureBlendMode(r->texture, SDL_BLENDMODE_NONE);
+    thread_pool_init(&r->pool, threads);
+    return 0;
+}
+
+/**
+ * Start the frame from a solid color
+ */
+static inline void soft_raster_clear(SoftRaster *r, Uint32 argb) {
+    r->clear_color = argb | 0xFF000000;
+    r->clear_image = NULL;
+}
+
+/**
+ * Start the frame from a w x h ARGB8888 image, which must stay valid until
+ * soft_raster_flush. Cheaper than drawing it as primitives every frame.
+ */
+static inline void soft_raster_clear_image(SoftRaster *r, const Uint32 *pixels, int pitch) {
+    r->clear_image = pixels;
+    r->clear_pitch = pitch / (int)sizeof(Uint32);
+}
+
+// Float to int rounding without libm calls; pixel coordinates only
+static inline int soft_raster_floor(float v) {
+    int i = (int)v;
+    return i - (i > v);
+}
+
+static inline int soft_raster_ceil(float v) {
+    int i = (int)v;
+    return i + (i < v);
+}
+
+static inline Uint32 soft_raster_color(SDL_Color c) {
+    return ((Uint32)c.a << 24) | ((Uint32)c.r << 16) | ((Uint32)c.g << 8) | c.b;
+}
+
+/**
+ * Queue a command covering [x0, x1) x [y0, y1); fully clipped or
+ * transparent ones are dropped, as are any that do not fit in memory.
+ */
+static inline SoftRasterCmd *soft_raster_push(SoftRaster *r, int kind, SDL_Color c,
+                                              int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > r->w) x1 = r->w;
+    if (y1 > r->h) y1 = r->h;
+    if (x0 >= x1 || y0 >= y1 || c.a == 0) return NULL;
+
+    if (r->count == r->capacity) {
+        int capacity = r->capacity ? r->capacity * 2 : 1024;
+        SoftRasterCmd *cmds = realloc(r->cmds, sizeof(SoftRasterCmd) * capacity);
+        if (!cmds) return NULL;
+        r->cmds = cmds;
+        r->capacity = capacity;
+    }
+    SoftRasterCmd *cmd = &r->cmds[r->count++];
+    cmd->kind = kind;
+    cmd->color = soft_raster_color(c);
+    cmd->x0 = x0;
+    cmd->y0 = y0;
+    cmd->x1 = x1;
+    cmd->y1 = y1;
+    return cmd;
+}
+
+static inline void soft_raster_rect(SoftRaster *r, int x, int y, int w, int h, SDL_Color c) {
+    soft_raster_push(r, SOFT_RASTER_RECT, c, x, y, x + w, y + h);
+}
+
+static inline void soft_raster_point(SoftRaster *r, int x, int y, SDL_Color c) {
+    soft_raster_push(r, SOFT_RASTER_RECT, c, x, y, x + 1, y + 1);
+}
+
+/**
+ * Filled circle with a one-pixel anti-aliased rim
+ */
+static inline void soft_raster_disc(SoftRaster *r, float cx, float cy, float radius, SDL_Color c) {
+    float reach = radius + 0.5f;
+    SoftRasterCmd *cmd = soft_raster_push(r, SOFT_RASTER_DISC, c,
+                                          soft_raster_floor(cx - reach), soft_raster_floor(cy - reach),
+                                          soft_raster_ceil(cx + reach), soft_raster_ceil(cy + reach));
+    if (!cmd) return;
+    cmd->ax = cx;
+    cmd->ay = cy;
+    cmd->size = radius;
+}
+
+/**
+ * Anti-aliased line `width` pixels wide with round caps
+ */
+static inline void soft_raster_line(SoftRaster *r, float x1, float y1, float x2, float y2, float width, SDL_Color c) {
+    float reach = width * 0.5f + 0.5f;
+    SoftRasterCmd *cmd = soft_raster_push(r, SOFT_RASTER_LINE, c,
+                                          soft_raster_floor(fminf(x1, x2) - reach), soft_raster_floor(fminf(y1, y2) - reach),
+                                          soft_raster_ceil(fmaxf(x1, x2) + reach), soft_raster_ceil(fmaxf(y1, y2) + reach));
+    if (!cmd) return;
+    cmd->ax = x1;
+    cmd->ay = y1;
+    cmd->bx = x2;
+    cmd->by = y2;
+    cmd->size = width * 0.5f;
+}
+
+/**
+ * Blend `color` over four opaque pixels, per-lane opacity 0..256
+ */
+static inline u32x4 soft_raster_blend4(u32x4 dst, Uint32 color, i32x4 alpha) {
+    const i32x4 mask8 = {0xFF, 0xFF, 0xFF, 0xFF};
+    i32x4 d = (i32x4)dst;
+    i32x4 dr = (d >> 16) & mask8;
+    i32x4 dg = (d >> 8) & mask8;
+    i32x4 db = d & mask8;
+    i32x4 sr = {0, 0, 0, 0}, sg = sr, sb = sr;
+    sr += (int)((color >> 16) & 0xFF);
+    sg += (int)((color >> 8) & 0xFF);
+    sb += (int)(color & 0xFF);
+    dr += ((sr - dr) * alpha) >> 8;
+    dg += ((sg - dg) * alpha) >> 8;
+    db += ((sb - db) * alpha) >> 8;
+    return (u32x4)((dr << 16) | (dg << 8) | db) | 0xFF000000u;
+}
+
+static inline Uint32 soft_raster_blend1(Uint32 dst, Uint32 color, int alpha) {
+    int dr = (dst >> 16) & 0xFF, dg = (dst >> 8) & 0xFF, db = dst & 0xFF;
+    dr += (((int)((color >> 16) & 0xFF) - dr) * alpha) >> 8;
+    dg += (((int)((color >> 8) & 0xFF) - dg) * alpha) >> 8;
+    db += (((int)(color & 0xFF) - db) * alpha) >> 8;
+    return 0xFF000000u | ((Uint32)dr << 16) | ((Uint32)dg << 8) | (Uint32)db;
+}
+
+/**
+ * Blend into n <= SIMD_WIDTH pixels. Short runs at the ends of spans and
+ * tiles go a pixel at a time, so nothing outside the tile is touched.
+ */
+static inline void soft_raster_blend_run(Uint32 *p, int n, Uint32 color, i32x4 alpha) {
+    if (n == SIMD_WIDTH) {
+        u32x4 d;
+        memcpy(&d, p, sizeof(d));
+        d = soft_raster_blend4(d, color, alpha);
+        memcpy(p, &d, sizeof(d));
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        if (alpha[i] > 0) p[i] = soft_raster_blend1(p[i], color, alpha[i]);
+    }
+}
+
+/**
+ * Pixels [x0, x1) of a row at one opacity
+ */
+static inline void soft_raster_span(Uint32 *row, int x0, int x1, Uint32 color) {
+    Uint32 a = color >> 24;
+    if (a == 255) {
+        Uint32 opaque = color | 0xFF000000;
+        for (int x = x0; x < x1; x++) row[x] = opaque;
+        return;
+    }
+    i32x4 alpha = {0, 0, 0, 0};
+    alpha += (int)(a + (a >> 7));
+    for (int x = x0; x < x1; x += SIMD_WIDTH) {
+        soft_raster_blend_run(row + x, SDL_min(SIMD_WIDTH, x1 - x), color, alpha);
+    }
+}
+
+/**
+ * n <= SIMD_WIDTH pixels from x with per-pixel coverage, clamped to 0..1
+ * here so callers can pass distances to the shape's edge as they are
+ */
+static inline void soft_raster_edge(Uint32 *row, int x, f32x4 coverage, int n, Uint32 color) {
+    f32x4 opacity = simd_clamp(coverage, 0.0f, 1.0f) * simd_splat((float)((color >> 24) + ((color >> 24) >> 7)));
+    soft_raster_blend_run(row + x, n, color, __builtin_convertvector(opacity, i32x4));
+}
+
+static inline void soft_raster_draw_disc(SoftRaster *r, const SoftRasterCmd *cmd,
+                                         int x0, int y0, int x1, int y1) {
+    const f32x4 lane = {0.5f, 1.5f, 2.5f, 3.5f};
+    float radius = cmd->size;
+    float reach = radius + 0.5f;
+    float inner = radius - 0.5f;        // Pixel centres this close are fully covered
+
+    for (int y = y0; y < y1; y++) {
+        Uint32 *row = r->pixels + (size_t)y * r->w;
+        float dy = y + 0.5f - cmd->ay;
+        float dy2 = dy * dy;
+        if (dy2 >= reach * reach) continue;
+        float half = sqrtf(reach * reach - dy2);
+        int xa = SDL_max(x0, soft_raster_floor(cmd->ax - half));
+        int xb = SDL_min(x1, soft_raster_ceil(cmd->ax + half));
+
+        // Solid middle, anti-aliased ends
+        int xi0 = xb, xi1 = xb;
+        if (inner > 0.0f && dy2 < inner * inner) {
+            float core = sqrtf(inner * inner - dy2);
+            xi0 = SDL_min(SDL_max(xa, soft_raster_ceil(cmd->ax - core - 0.5f)), xb);
+            xi1 = SDL_max(SDL_min(xb, soft_raster_floor(cmd->ax + core - 0.5f) + 1), xi0);
+        }
+        f32x4 vdy2 = simd_splat(dy2);
+        for (int x = xa; x < xb;) {
+            if (x == xi0 && xi1 > xi0) {
+                soft_raster_span(row, xi0, xi1, cmd->color);
+                x = xi1;
+                continue;
+            }
+            int end = x < xi0 ? xi0 : xb;
+            int n = SDL_min(SIMD_WIDTH, end - x);
+            f32x4 dx = simd_splat(x - cmd->ax) + lane;
+            f32x4 d = simd_sqrt(dx * dx + vdy2);
+            soft_raster_edge(row, x, simd_splat(reach) - d, n, cmd->color);
+            x += n;
+        }
+    }
+}
+
+/**
+ * Columns [*xa, *xb) a line can cover between heights y0 and y1: the part
+ * of the segment within reach of that band, widened by the reach
+ */
+static inline void soft_raster_line_extent(const SoftRasterCmd *cmd, float y0, float y1, int *xa, int *xb) {
+    float dx = cmd->bx - cmd->ax;
+    float dy = cmd->by - cmd->ay;
+    float reach = cmd->size + 0.5f;
+    float t0 = 0.0f, t1 = 1.0f;
+    if (fabsf(dy) > 1e-6f) {
+        t0 = (y0 - reach - cmd->ay) / dy;
+        t1 = (y1 + reach - cmd->ay) / dy;
+        if (t0 > t1) { float t = t0; t0 = t1; t1 = t; }
+        t0 = t0 < 0.0f ? 0.0f : t0 > 1.0f ? 1.0f : t0;
+        t1 = t1 < 0.0f ? 0.0f : t1 > 1.0f ? 1.0f : t1;
+    }
+    float xs0 = cmd->ax + dx * t0;
+    float xs1 = cmd->ax + dx * t1;
+    if (xs0 > xs1) { float x = xs0; xs0 = xs1; xs1 = x; }
+    *xa = soft_raster_floor(xs0 - reach);
+    *xb = soft_raster_ceil(xs1 + reach);
+}
+
+static inline void soft_raster_draw_line(SoftRaster *r, const SoftRasterCmd *cmd,
+                                         int x0, int y0, int x1, int y1) {
+    const f32x4 lane = {0.5f, 1.5f, 2.5f, 3.5f};
+    float dx = cmd->bx - cmd->ax;
+    float dy = cmd->by - cmd->ay;
+    float len2 = dx * dx + dy * dy;
+    float inv_len2 = len2 > 0.0f ? 1.0f / len2 : 0.0f;
+    float reach = cmd->size + 0.5f;
+
+    for (int y = y0; y < y1; y++) {
+        Uint32 *row = r->pixels + (size_t)y * r->w;
+        float py = y + 0.5f;
+        int xa, xb;
+        soft_raster_line_extent(cmd, py, py, &xa, &xb);
+        xa = SDL_max(x0, xa);
+        xb = SDL_min(x1, xb);
+
+        f32x4 vy = simd_splat(py - cmd->ay);
+        for (int x = xa; x < xb; x += SIMD_WIDTH) {
+            f32x4 vx = simd_splat(x - cmd->ax) + lane;
+            f32x4 t = simd_clamp((vx * simd_splat(dx) + vy * simd_splat(dy)) * simd_splat(inv_len2), 0.0f, 1.0f);
+            f32x4 ex = vx - t * simd_splat(dx);
+            f32x4 ey = vy - t * simd_splat(dy);
+            f32x4 d = simd_sqrt(ex * ex + ey * ey);
+            soft_raster_edge(row, x, simd_splat(reach) - d, SDL_min(SIMD_WIDTH, xb - x), cmd->color);
+        }
+    }
+}
+
+/**
+ * Background plus every command binned to tile t
+ */
+static inline void soft_raster_draw_tile(SoftRaster *r, int t) {
+    int tx0 = (t % r->tiles_x) * SOFT_RASTER_TILE;
+    int ty0 = (t / r->tiles_x) * SOFT_RASTER_TILE;
+    int tx1 = SDL_min(tx0 + SOFT_RASTER_TILE, r->w);
+    int ty1 = SDL_min(ty0 + SOFT_RASTER_TILE, r->h);
+
+    for (int y = ty0; y < ty1; y++) {
+        Uint32 *row = r->pixels + (size_t)y * r->w;
+        if (r->clear_image) {
+            memcpy(row + tx0, r->clear_image + (size_t)y * r->clear_pitch + tx0, sizeof(Uint32) * (tx1 - tx0));
+        } else {
+            for (int x = tx0; x < tx1; x++) row[x] = r->clear_color;
+        }
+    }
+
+    for (int k = r->bin_start[t]; k < r->bin_start[t + 1]; k++) {
+        const SoftRasterCmd *cmd = &r->cmds[r->bin_cmd[k]];
+        int x0 = SDL_max(cmd->x0, tx0);
+        int y0 = SDL_max(cmd->y0, ty0);
+        int x1 = SDL_min(cmd->x1, tx1);
+        int y1 = SDL_min(cmd->y1, ty1);
+        switch (cmd->kind) {
+            case SOFT_RASTER_RECT:
+                for (int y = y0; y < y1; y++) {
+                    soft_raster_span(r->pixels + (size_t)y * r->w, x0, x1, cmd->color);
+                }
+                break;
+            case SOFT_RASTER_DISC:
+                soft_raster_draw_disc(r, cmd, x0, y0, x1, y1);
+                break;
+            case SOFT_RASTER_LINE:
+                soft_raster_draw_line(r, cmd, x0, y0, x1, y1);
+                break;
+        }
+    }
+}
+
+static inline void soft_raster_draw_tiles(void *user, int begin, int end) {
+    for (int t = begin; t < end; t++) soft_raster_draw_tile(user, t);
+}
+
+/**
+ * Tile columns [*tx0, *tx1] command `cmd` touches in tile row ty. Lines
+ * are narrowed to the columns they cross, so a long diagonal does not
+ * visit every tile of its bounding box.
+ */
+static inline void soft_raster_tile_cols(const SoftRasterCmd *cmd, int ty, int *tx0, int *tx1) {
+    int xa = cmd->x0, xb = cmd->x1;
+    if (cmd->kind == SOFT_RASTER_LINE) {
+        int la, lb;
+        soft_raster_line_extent(cmd, (float)(ty * SOFT_RASTER_TILE), (float)((ty + 1) * SOFT_RASTER_TILE), &la, &lb);
+        xa = SDL_max(xa, la);
+        xb = SDL_min(xb, lb);
+    }
+    *tx0 = xa / SOFT_RASTER_TILE;
+    *tx1 = xb > xa ? (xb - 1) / SOFT_RASTER_TILE : *tx0 - 1;
+}
+
+/**
+ * Sort command indices into per-tile lists by counting, keeping queue
+ * order within each tile. Returns -1 if the lists do not fit in memory.
+ */
+static inline int soft_raster_bin(SoftRaster *r) {
+    int tiles = r->tiles_x * r->tiles_y;
+    SDL_memset(r->bin_start, 0, sizeof(int) * (tiles + 1));
+
+    size_t refs = 0;
+    for (int i = 0; i < r->count; i++) {
+        const SoftRasterCmd *cmd = &r->cmds[i];
+        int ty0 = cmd->y0 / SOFT_RASTER_TILE, ty1 = (cmd->y1 - 1) / SOFT_RASTER_TILE;
+        for (int ty = ty0; ty <= ty1; ty++) {
+            int tx0, tx1;
+            soft_raster_tile_cols(cmd, ty, &tx0, &tx1);
+            for (int tx = tx0; tx <= tx1; tx++) r->bin_start[ty * r->tiles_x + tx + 1]++;
+            refs += tx1 - tx0 + 1;
+        }
+    }
+    if (refs > r->bin_capacity) {
+        int *bin_cmd = realloc(r->bin_cmd, sizeof(int) * refs);
+        if (!bin_cmd) return -1;
+        r->bin_cmd = bin_cmd;
+        r->bin_capacity = refs;
+    }
+
+    for (int t = 0; t < tiles; t++) {
+        r->bin_start[t + 1] += r->bin_start[t];
+        r->bin_fill[t] = r->bin_start[t];
+    }
+    for (int i = 0; i < r->count; i++) {
+        const SoftRasterCmd *cmd = &r->cmds[i];
+        int ty0 = cmd->y0 / SOFT_RASTER_TILE, ty1 = (cmd->y1 - 1) / SOFT_RASTER_TILE;
+        for (int ty = ty0; ty <= ty1; ty++) {
+            int tx0, tx1;
+            soft_raster_tile_cols(cmd, ty, &tx0, &tx1);
+            for (int tx = tx0; tx <= tx1; tx++) r->bin_cmd[r->bin_fill[ty * r->tiles_x + tx]++] = i;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Rasterize everything queued since the last flush over the background,
+ * upload the frame and copy it to the whole render target
+ */
+static inline void soft_raster_flush(SoftRaster *r, SDL_Renderer *renderer) {
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    if (soft_raster_bin(r) != 0) {
+        r->count = 0;                   // Out of memory: background only
+        soft_raster_bin(r);
+    }
+    thread_pool_run(&r->pool, soft_raster_draw_tiles, r, r->tiles_x * r->tiles_y, 1);
+    Uint64 t1 = SDL_GetPerformanceCounter();
+
+    SDL_UpdateTexture(r->texture, NULL, r->pixels, r->w * (int)sizeof(Uint32));
+    SDL_RenderCopy(renderer, r->texture, NULL, NULL);
+    Uint64 t2 = SDL_GetPerformanceCounter();
+
+    r->raster_ticks += t1 - t0;
+    r->upload_ticks += t2 - t1;
+    r->primitives += r->count;
+    r->frames++;
+    r->count = 0;
+}
+
+static inline void soft_raster_log_summary(const SoftRaster *r, const char *saver) {
+    if (r->frames == 0) return;
+    double ms = 1000.0 / SDL_GetPerformanceFrequency() / r->frames;
+    SDL_Log("%s: cpu raster, %.1f primitives in %.2f ms + %.2f ms upload per frame on %d threads",
+            saver, (double)r->primitives / r->frames, r->raster_ticks * ms, r->upload_ticks * ms,
+            thread_pool_threads(&r->pool));
+}
+
+#endif
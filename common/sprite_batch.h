@@ -0,0 +1,179 @@
+/**
+ * Sprite Batcher
+ * Draws any number of atlas sprites with one SDL_RenderGeometry call
+ *
+ * Savers whose sprites all live in one texture atlas (see utils/png_to_c.py
+ * --atlas) queue each sprite as a quad with sprite_batch_add and submit the
+ * whole frame with sprite_batch_flush, so the driver sees one draw and no
+ * texture switches however many sprites there are. Horizontal flips swap
+ * the quad's texture coordinates instead of needing a separate copy. The
+ * buffers grow on demand and keep their size between frames.
+ *
+ * Usage:
+ *   SpriteBatch batch;
+ *   sprite_batch_init(&batch, atlas_tex, ATLAS_WIDTH, ATLAS_HEIGHT, 64);
+ *   while (running) {
+ *       sprite_batch_add(&batch, &atlas_frames[f], &dst, flip, white);
+ *       sprite_batch_flush(&batch, renderer);
+ *   }
+ *   sprite_batch_destroy(&batch);
+ */
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifndef ATLAS_TYPES_DEFINED
+#define ATLAS_TYPES_DEFINED
+typedef struct { int x, y, w, h; } AtlasFrame;      // Atlas pixels
+typedef struct { int first, count; } AtlasSprite;   // Range in the frame table
+#endif
+
+typedef struct {
+    SDL_Texture *texture;
+    float inv_w, inv_h;                 // Atlas pixels to texture coordinates
+    SDL_Vertex *vertices;
+    int *indices;
+    int count;                          // Quads queued this frame
+    int capacity;                       // Quads the buffers hold
+
+    // Statistics for the exit summary
+    Uint32 frames;
+    Uint32 draw_calls;
+    Uint32 quads;
+} SpriteBatch;
+
+/**
+ * Make room for at least `capacity` quads. Returns 0 on success.
+ */
+static inline int sprite_batch_reserve(SpriteBatch *b, int capacity) {
+    if (capacity <= b->capacity) return 0;
+
+    SDL_Vertex *vertices = realloc(b->vertices, sizeof(SDL_Vertex) * 4 * (size_t)capacity);
+    if (!vertices) return -1;
+    b->vertices = vertices;
+    int *indices = realloc(b->indices, sizeof(int) * 6 * (size_t)capacity);
+    if (!indices) return -1;
+    b->indices = indices;
+
+    // Two triangles per quad; the pattern never changes, so fill it once
+    for (int q = b->capacity; q < capacity; q++) {
+        int *idx = &b->indices[q * 6];
+        int v = q * 4;
+        idx[0] = v;
+        idx[1] = v + 1;
+        idx[2] = v + 2;
+        idx[3] = v;
+        idx[4] = v + 2;
+        idx[5] = v + 3;
+    }
+    b->capacity = capacity;
+    return 0;
+}
+
+static inline int sprite_batch_init(SpriteBatch *b, SDL_Texture *texture, int atlas_w, int atlas_h, int capacity) {
+    SDL_memset(b, 0, sizeof(*b));
+    b->texture = texture;
+    b->inv_w = 1.0f / atlas_w;
+    b->inv_h = 1.0f / atlas_h;
+    return sprite_batch_reserve(b, capacity > 0 ? capacity : 64);
+}
+
+static inline void sprite_batch_destroy(SpriteBatch *b) {
+    free(b->vertices);
+    free(b->indices);
+    SDL_memset(b, 0, sizeof(*b));
+}
+
+/**
+ * Queue `frame` stretched over `dst`, mirrored left to right if flip_h.
+ * A sprite that cannot be queued (out of memory) is dropped.
+ */
+static inline void sprite_batch_add(SpriteBatch *b, const AtlasFrame *frame, const SDL_FRect *dst,
+                                    int flip_h, SDL_Color color) {
+    if (b->count == b->capacity && sprite_batch_reserve(b, b->capacity * 2) != 0) return;
+
+    float u0 = frame->x * b->inv_w;
+    float u1 = (frame->x + frame->w) * b->inv_w;
+    float v0 = frame->y * b->inv_h;
+    float v1 = (frame->y + frame->h) * b->inv_h;
+    if (flip_h) {
+        float t = u0;
+        u0 = u1;
+        u1 = t;
+    }
+
+    SDL_Vertex *v = &b->vertices[b->count * 4];
+    v[0].position = (SDL_FPoint){dst->x, dst->y};
+    v[0].tex_coord = (SDL_FPoint){u0, v0};
+    v[1].position = (SDL_FPoint){dst->x + dst->w, dst->y};
+    v[1].tex_coord = (SDL_FPoint){u1, v0};
+    v[2].position = (SDL_FPoint){dst->x + dst->w, dst->y + dst->h};
+    v[2].tex_coord = (SDL_FPoint){u1, v1};
+    v[3].position = (SDL_FPoint){dst->x, dst->y + dst->h};
+    v[3].tex_coord = (SDL_FPoint){u0, v1};
+    v[0].color = v[1].color = v[2].color = v[3].color = color;
+    b->count++;
+}
+
+/**
+ * As sprite_batch_add, but turned by `angle` radians (clockwise on screen)
+ * around the centre of `dst`
+ */
+static inline void sprite_batch_add_rotated(SpriteBatch *b, const AtlasFrame *frame, const SDL_FRect *dst,
+                                            float angle, int flip_h, SDL_Color color) {
+    int slot = b->count;
+    sprite_batch_add(b, frame, dst, flip_h, color);
+    if (b->count == slot) return;
+
+    float c = cosf(angle);
+    float s = sinf(angle);
+    float cx = dst->x + dst->w * 0.5f;
+    float cy = dst->y + dst->h * 0.5f;
+    SDL_Vertex *v = &b->vertices[slot * 4];
+    for (int k = 0; k < 4; k++) {
+        float dx = v[k].position.x - cx;
+        float dy = v[k].position.y - cy;
+        v[k].position.x = cx + dx * c - dy * s;
+        v[k].position.y = cy + dx * s + dy * c;
+    }
+}
+
+static inline void sprite_batch_submit(SpriteBatch *b, SDL_Renderer *renderer) {
+    if (b->count > 0) {
+        SDL_RenderGeometry(renderer, b->texture, b->vertices, b->count * 4, b->indices, b->count * 6);
+        b->draw_calls++;
+        b->quads += b->count;
+    }
+    b->count = 0;
+}
+
+/**
+ * Draw what follows from `texture`, a same-layout copy of the atlas such as
+ * one of its mip levels. Sprites already queued are drawn first so the order
+ * is kept; switching to the current texture costs nothing.
+ */
+static inline void sprite_batch_set_texture(SpriteBatch *b, SDL_Renderer *renderer, SDL_Texture *texture) {
+    if (texture == b->texture) return;
+    sprite_batch_submit(b, renderer);
+    b->texture = texture;
+}
+
+/**
+ * Draw everything queued since the last flush in one call and reset
+ */
+static inline void sprite_batch_flush(SpriteBatch *b, SDL_Renderer *renderer) {
+    sprite_batch_submit(b, renderer);
+    b->frames++;
+}
+
+static inline void sprite_batch_log_summary(const SpriteBatch *b, const char *saver) {
+    if (b->frames == 0) return;
+    SDL_Log("%s: %.1f sprites in %.2f draw calls per frame",
+            saver, (float)b->quads / b->frames, (float)b->draw_calls / b->frames);
+}
+
+#endif
@@ -0,0 +1,162 @@
+/**
+ * Thread Pool
+ * Fork-join parallel loops for the BeforeLight simulations
+ *
+ * thread_pool_run splits [0, count) into chunks and runs them on the worker
+ * threads and the calling thread, returning once every chunk is finished.
+ * Chunks are handed out dynamically, so which thread runs a chunk varies
+ * from call to call; jobs stay deterministic by reading shared state that
+ * does not change during the call and writing only their own range.
+ *
+ * Every worker checks in once per call before the next call can start, so
+ * a slow worker can never pick up a chunk of the following job.
+ *
+ * Usage:
+ *   ThreadPool pool;
+ *   thread_pool_init(&pool, 0);                  // 0 = one thread per core
+ *   thread_pool_run(&pool, update_range, &sim, count, 256);
+ *   thread_pool_destroy(&pool);
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <SDL.h>
+
+#define THREAD_POOL_MAX 32
+
+typedef void (*ThreadPoolFn)(void *user, int begin, int end);
+
+typedef struct {
+    SDL_Thread *threads[THREAD_POOL_MAX];
+    int worker_count;                   // Threads besides the caller
+    SDL_mutex *lock;
+    SDL_cond *work_ready;
+    SDL_cond *work_done;
+
+    // Current job, written under lock before work_ready is broadcast
+    ThreadPoolFn fn;
+    void *user;
+    int count;
+    int chunk_size;
+    int chunks;
+    SDL_atomic_t next_chunk;
+    int pending;                        // Threads still inside the current job
+    Uint32 generation;
+    int quit;
+} ThreadPool;
+
+static inline void thread_pool_work(ThreadPool *pool) {
+    for (;;) {
+        int c = SDL_AtomicAdd(&pool->next_chunk, 1);
+        if (c >= pool->chunks) break;
+        int begin = c * pool->chunk_size;
+        int end = begin + pool->chunk_size;
+        if (end > pool->count) end = pool->count;
+        pool->fn(pool->user, begin, end);
+    }
+
+    SDL_LockMutex(pool->lock);
+    if (--pool->pending == 0) SDL_CondSignal(pool->work_done);
+    SDL_UnlockMutex(pool->lock);
+}
+
+static inline int thread_pool_worker(void *data) {
+    ThreadPool *pool = data;
+    Uint32 seen = 0;
+    for (;;) {
+        SDL_LockMutex(pool->lock);
+        while (!pool->quit && pool->generation == seen) {
+            SDL_CondWait(pool->work_ready, pool->lock);
+        }
+        seen = pool->generation;
+        int quit = pool->quit;
+        SDL_UnlockMutex(pool->lock);
+        if (quit) break;
+
+        thread_pool_work(pool);
+    }
+    return 0;
+}
+
+/**
+ * Start `threads` workers in total, counting the caller; 0 picks one per
+ * CPU core. If threads cannot be created the pool still works, just on
+ * fewer cores (down to running everything on the caller).
+ */
+static inline void thread_pool_init(ThreadPool *pool, int threads) {
+    SDL_memset(pool, 0, sizeof(*pool));
+    if (threads <= 0) threads = SDL_GetCPUCount();
+    if (threads > THREAD_POOL_MAX) threads = THREAD_POOL_MAX;
+
+    pool->lock = SDL_CreateMutex();
+    pool->work_ready = SDL_CreateCond();
+    pool->work_done = SDL_CreateCond();
+    if (!pool->lock || !pool->work_ready || !pool->work_done) return;
+
+    for (int i = 0; i < threads - 1; i++) {
+        SDL_Thread *t = SDL_CreateThread(thread_pool_worker, "pool", pool);
+        if (!t) break;
+        pool->threads[pool->worker_count++] = t;
+    }
+}
+
+static inline int thread_pool_threads(const ThreadPool *pool) {
+    return pool->worker_count + 1;
+}
+
+/**
+ * Run fn over [0, count) in chunks of at least min_chunk and wait for all
+ */
+static inline void thread_pool_run(ThreadPool *pool, ThreadPoolFn fn, void *user, int count, int min_chunk) {
+    if (count <= 0) return;
+    if (min_chunk < 1) min_chunk = 1;
+
+    // About four chunks per thread evens out uneven work
+    int chunk_size = count / (thread_pool_threads(pool) * 4);
+    if (chunk_size < min_chunk) chunk_size = min_chunk;
+    int chunks = (count + chunk_size - 1) / chunk_size;
+
+    if (pool->worker_count == 0 || chunks == 1) {
+        fn(user, 0, count);
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    pool->fn = fn;
+    pool->user = user;
+    pool->count = count;
+    pool->chunk_size = chunk_size;
+    pool->chunks = chunks;
+    SDL_AtomicSet(&pool->next_chunk, 0);
+    pool->pending = pool->worker_count + 1;
+    pool->generation++;
+    SDL_CondBroadcast(pool->work_ready);
+    SDL_UnlockMutex(pool->lock);
+
+    thread_pool_work(pool);
+
+    SDL_LockMutex(pool->lock);
+    while (pool->pending > 0) {
+        SDL_CondWait(pool->work_done, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+}
+
+static inline void thread_pool_destroy(ThreadPool *pool) {
+    if (pool->lock) {
+        SDL_LockMutex(pool->lock);
+        pool->quit = 1;
+        SDL_CondBroadcast(pool->work_ready);
+        SDL_UnlockMutex(pool->lock);
+    }
+    for (int i = 0; i < pool->worker_count; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    if (pool->work_done) SDL_DestroyCond(pool->work_done);
+    if (pool->work_ready) SDL_DestroyCond(pool->work_ready);
+    if (pool->lock) SDL_DestroyMutex(pool->lock);
+    SDL_memset(pool, 0, sizeof(*pool));
+}
+
+#endif
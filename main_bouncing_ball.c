@@ -3,8 +3,11 @@
 #include <stdint.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/soft_raster.h"
+#include "common/sprite_batch.h"
 
 #define PI 3.14159f
 
@@ -13,43 +16,237 @@
 #define SPRITE_SIZE 145
 #define FISH_FRAME_COUNT 4  // not used
 
-extern char *optarg;
+#define DEFAULT_BALLS 10
+#define MAX_BALLS 100000
+#define BALL_RADIUS 20.0f               // Largest radius; crowded screens get smaller balls
+#define BALL_MIN_RADIUS 2.0f
+#define BALL_COVERAGE 0.3f              // Share of the screen the balls may cover
+#define BALL_TEXTURE_SIZE 64
+#define BALL_STEP (1.0f / 120.0f)       // Fixed physics step
+#define BALL_MAX_STEPS 8                // Catch-up limit after a stall
 
-void drawFilledCircle(SDL_Renderer *renderer, int centerX, int centerY, int radius, SDL_Color color) {
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-    int r_squared = radius * radius;
-    for (int y = centerY - radius; y <= centerY + radius; y++) {
-        int dy = y - centerY;
-        int dx_squared = r_squared - dy * dy;
-        if (dx_squared > 0) {
-            int dx = (int)sqrtf(dx_squared);
-            SDL_RenderDrawLine(renderer, centerX - dx, y, centerX + dx, y);
-        }
-    }
-}
+extern char *optarg;
 
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -n N    Number of balls (default: %d, max %d)\n", DEFAULT_BALLS, MAX_BALLS);
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -R sdl|cpu  Draw with SDL or the tiled CPU rasterizer (default: sdl)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
 typedef struct Ball {
-    float x, y, vx, vy;
+    float x, y, vx, vy;                 // Centre and velocity in pixels
     SDL_Color color;
 } Ball;
 
-Ball balls[10];
+/**
+ * All balls plus a uniform grid of ball-diameter cells for the broadphase:
+ * touching balls are always in the same or neighbouring cells, so each ball
+ * only tests the nine cells around its own instead of every other ball.
+ */
+typedef struct {
+    Ball *balls;
+    int count;
+    float radius;
+    int W, H;
+
+    float cell;
+    int cols, rows;
+    int *cell_start;                    // cols * rows + 1 offsets into cell_ball
+    int *cell_ball;                     // Ball indices sorted by cell
+    int *ball_cell;
+
+    Uint32 steps;
+    Uint64 pair_tests;
+} World;
+
+static void world_destroy(World *w) {
+    free(w->balls);
+    free(w->cell_start);
+    free(w->cell_ball);
+    free(w->ball_cell);
+    SDL_memset(w, 0, sizeof(*w));
+}
+
+static int world_init(World *w, int count, int W, int H) {
+    SDL_memset(w, 0, sizeof(*w));
+    w->count = count;
+    w->W = W;
+    w->H = H;
+
+    // Keep the balls to a fixed share of the screen so thousands still fit
+    float fit = sqrtf(BALL_COVERAGE * W * H / (count * PI));
+    w->radius = fminf(BALL_RADIUS, fmaxf(BALL_MIN_RADIUS, fit));
+
+    w->cell = 2.0f * w->radius;
+    w->cols = (int)(W / w->cell) + 1;
+    w->rows = (int)(H / w->cell) + 1;
+    w->balls = malloc(sizeof(Ball) * count);
+    w->cell_start = malloc(sizeof(int) * ((size_t)w->cols * w->rows + 1));
+    w->cell_ball = malloc(sizeof(int) * count);
+    w->ball_cell = malloc(sizeof(int) * count);
+    if (!w->balls || !w->cell_start || !w->cell_ball || !w->ball_cell) {
+        world_destroy(w);
+        return -1;
+    }
+
+    float d = 2.0f * w->radius;
+    for (int i = 0; i < count; i++) {
+        Ball *b = &w->balls[i];
+        b->x = w->radius + (float)rand() / RAND_MAX * fmaxf(W - d, 0.0f);
+        b->y = w->radius + (float)rand() / RAND_MAX * fmaxf(H - d, 0.0f);
+        b->vx = (float)(rand() % 400 - 200);
+        b->vy = (float)(rand() % 400 - 200);
+        b->color = (SDL_Color){(uint8_t)(rand() % 256), (uint8_t)(rand() % 256), (uint8_t)(rand() % 256), 255};
+    }
+    return 0;
+}
+
+static void world_build_grid(World *w) {
+    int cells = w->cols * w->rows;
+    float inv_cell = 1.0f / w->cell;
+    SDL_memset(w->cell_start, 0, sizeof(int) * (size_t)(cells + 1));
+
+    for (int i = 0; i < w->count; i++) {
+        int cx = (int)(w->balls[i].x * inv_cell);
+        int cy = (int)(w->balls[i].y * inv_cell);
+        if (cx < 0) cx = 0;
+        if (cx >= w->cols) cx = w->cols - 1;
+        if (cy < 0) cy = 0;
+        if (cy >= w->rows) cy = w->rows - 1;
+        w->ball_cell[i] = cy * w->cols + cx;
+        w->cell_start[w->ball_cell[i] + 1]++;
+    }
+    for (int c = 0; c < cells; c++) {
+        w->cell_start[c + 1] += w->cell_start[c];
+    }
+    // Counting sort, using cell_start as the write cursor and shifting it back
+    for (int i = 0; i < w->count; i++) {
+        w->cell_ball[w->cell_start[w->ball_cell[i]]++] = i;
+    }
+    for (int c = cells; c > 0; c--) {
+        w->cell_start[c] = w->cell_start[c - 1];
+    }
+    w->cell_start[0] = 0;
+}
+
+/**
+ * Push two overlapping balls apart and swap their normal velocities
+ * (equal-mass elastic collision)
+ */
+static void collide(Ball *b1, Ball *b2, float min_dist) {
+    float dx = b2->x - b1->x;
+    float dy = b2->y - b1->y;
+    float d2 = dx * dx + dy * dy;
+    if (d2 >= min_dist * min_dist || d2 <= 0.0f) return;
+
+    float dist = sqrtf(d2);
+    float overlap = min_dist - dist;
+    float nx = dx / dist;
+    float ny = dy / dist;
+    b1->x -= nx * overlap / 2;
+    b1->y -= ny * overlap / 2;
+    b2->x += nx * overlap / 2;
+    b2->y += ny * overlap / 2;
+
+    // Only the normal components change; tangential ones are kept
+    float v1n = b1->vx * nx + b1->vy * ny;
+    float v2n = b2->vx * nx + b2->vy * ny;
+    if (v1n - v2n <= 0.0f) return;      // Already separating
+    float dv = v2n - v1n;
+    b1->vx += dv * nx;
+    b1->vy += dv * ny;
+    b2->vx -= dv * nx;
+    b2->vy -= dv * ny;
+}
+
+static void world_step(World *w, float dt) {
+    float r = w->radius;
+    for (int i = 0; i < w->count; i++) {
+        Ball *b = &w->balls[i];
+        b->x += b->vx * dt;
+        b->y += b->vy * dt;
+    }
+
+    // Ball-ball collisions: each pair once, from the lower index
+    world_build_grid(w);
+    float min_dist = 2.0f * r;
+    for (int i = 0; i < w->count; i++) {
+        int cell = w->ball_cell[i];
+        int cx = cell % w->cols;
+        int cy = cell / w->cols;
+        for (int y = SDL_max(cy - 1, 0); y <= SDL_min(cy + 1, w->rows - 1); y++) {
+            for (int x = SDL_max(cx - 1, 0); x <= SDL_min(cx + 1, w->cols - 1); x++) {
+                int c = y * w->cols + x;
+                for (int k = w->cell_start[c]; k < w->cell_start[c + 1]; k++) {
+                    int j = w->cell_ball[k];
+                    if (j <= i) continue;
+                    collide(&w->balls[i], &w->balls[j], min_dist);
+                    w->pair_tests++;
+                }
+            }
+        }
+    }
+
+    // Wall collisions last, so separation pushes never leave a ball off screen
+    for (int i = 0; i < w->count; i++) {
+        Ball *b = &w->balls[i];
+        if (b->x < r || b->x > w->W - r) {
+            b->vx = b->x < r ? fabsf(b->vx) : -fabsf(b->vx);
+            b->x = fmaxf(r, fminf(w->W - r, b->x));
+        }
+        if (b->y < r || b->y > w->H - r) {
+            b->vy = b->y < r ? fabsf(b->vy) : -fabsf(b->vy);
+            b->y = fmaxf(r, fminf(w->H - r, b->y));
+        }
+    }
+    w->steps++;
+}
+
+/**
+ * A white disc with a one-pixel anti-aliased edge, tinted per ball by the
+ * vertex colour
+ */
+static SDL_Texture *ball_texture(SDL_Renderer *renderer, int size) {
+    SDL_Surface *surf = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surf) return NULL;
+
+    float c = size / 2.0f;
+    for (int y = 0; y < size; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surf->pixels + y * surf->pitch);
+        for (int x = 0; x < size; x++) {
+            float dx = x + 0.5f - c;
+            float dy = y + 0.5f - c;
+            float a = fminf(fmaxf(c - sqrtf(dx * dx + dy * dy), 0.0f), 1.0f);
+            row[x] = ((Uint32)(a * 255.0f) << 24) | 0x00FFFFFF;
+        }
+    }
+
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    if (!tex) return NULL;
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeLinear);
+    return tex;
+}
 
 int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int ball_count = DEFAULT_BALLS;
+    int cpu_raster = 0;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "n:s:f:R:h")) != -1) {
         switch (opt) {
+            case 'n':
+                ball_count = atoi(optarg);
+                if (ball_count < 1) ball_count = 1;
+                if (ball_count > MAX_BALLS) ball_count = MAX_BALLS;
+                break;
             case 's':
                 speed_mult = atof(optarg);
                 if (speed_mult <= 0.1f) speed_mult = 0.1f;
@@ -58,6 +255,16 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'R':
+                if (strcmp(optarg, "sdl") == 0) {
+                    cpu_raster = 0;
+                } else if (strcmp(optarg, "cpu") == 0) {
+                    cpu_raster = 1;
+                } else {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -105,18 +312,37 @@ int main(int argc, char *argv[]) {
     int W, H;
     SDL_GetRendererOutputSize(renderer, &W, &H);
 
-    for(int i=0; i<10; i++) {
-        balls[i].x = (float)(rand() % (W - 40));
-        balls[i].y = (float)(rand() % (H - 40));
-        balls[i].vx = (float)(rand() % 400 - 200);
-        balls[i].vy = (float)(rand() % 400 - 200);
-        balls[i].color = (SDL_Color){(uint8_t)(rand() % 256), (uint8_t)(rand() % 256), (uint8_t)(rand() % 256), 255};
+    // Balls are either sprites of one texture or, with -R cpu, discs drawn
+    // straight into a CPU framebuffer
+    World world;
+    SDL_Texture *ball_tex = NULL;
+    SpriteBatch batch = {0};
+    SoftRaster raster = {0};
+    int draw_ok = cpu_raster ? soft_raster_init(&raster, renderer, W, H, 0) == 0
+                             : (ball_tex = ball_texture(renderer, BALL_TEXTURE_SIZE)) != NULL &&
+                               sprite_batch_init(&batch, ball_tex, BALL_TEXTURE_SIZE, BALL_TEXTURE_SIZE, ball_count) == 0;
+    if (world_init(&world, ball_count, W, H) != 0 || !draw_ok) {
+        SDL_Log("Error creating %d balls: %s", ball_count, SDL_GetError());
+        sprite_batch_destroy(&batch);
+        soft_raster_destroy(&raster);
+        if (ball_tex) SDL_DestroyTexture(ball_tex);
+        world_destroy(&world);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
+    const AtlasFrame ball_frame = {0, 0, BALL_TEXTURE_SIZE, BALL_TEXTURE_SIZE};
+    float step_credit = 0.0f;
+    Uint64 physics_ticks = 0;
 
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    Uint32 last_ticks = start_time;
+    Uint32 frames = 0;
 
     while (!quit) {
         while (SDL_PollEvent(&e)) {
@@ -133,78 +359,59 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
-        SDL_RenderClear(renderer);
-
-        // Update physics
-        const float dt = 0.016f; // ~60fps
-        int ball_size = 40;
-
-        for(int i=0; i<10; i++) {
-            balls[i].x += balls[i].vx * dt * speed_mult;
-            balls[i].y += balls[i].vy * dt * speed_mult;
-
-            // Wall collisions
-            if (balls[i].x < 0 || balls[i].x > W - ball_size) {
-                balls[i].vx = -balls[i].vx;
-                balls[i].x = fmax(0, fmin(W - ball_size, balls[i].x));
-            }
-            if (balls[i].y < 0 || balls[i].y > H - ball_size) {
-                balls[i].vy = -balls[i].vy;
-                balls[i].y = fmax(0, fmin(H - ball_size, balls[i].y));
-            }
-        }
-
-        // Ball-ball collisions
-        for(int i=0; i<10; i++) {
-            for(int j=i+1; j<10; j++) {
-                Ball *b1 = &balls[i];
-                Ball *b2 = &balls[j];
-                float dx = b2->x - b1->x;
-                float dy = b2->y - b1->y;
-                float dist = sqrtf(dx*dx + dy*dy);
-                if (dist < ball_size && dist > 0) {
-                    // Separate
-                    float overlap = ball_size - dist;
-                    float nx = dx / dist;
-                    float ny = dy / dist;
-                    b1->x -= nx * overlap / 2;
-                    b1->y -= ny * overlap / 2;
-                    b2->x += nx * overlap / 2;
-                    b2->y += ny * overlap / 2;
-
-                    // Elastic collision (conservation of momentum/KE)
-                    float tx = -ny;
-                    float ty = nx;
-                    float v1n = b1->vx * nx + b1->vy * ny;
-                    float v1t = b1->vx * tx + b1->vy * ty;
-                    float v2n = b2->vx * nx + b2->vy * ny;
-                    float v2t = b2->vx * tx + b2->vy * ty;
-
-                    // Swap normal velocities for elastic collision
-                    b1->vx = v2n * nx + v1t * tx;
-                    b1->vy = v2n * ny + v1t * ty;
-                    b2->vx = v1n * nx + v2t * tx;
-                    b2->vy = v1n * ny + v2t * ty;
-                }
-            }
+        // Update physics in fixed steps, whatever the frame rate
+        Uint32 now = SDL_GetTicks();
+        step_credit += (now - last_ticks) / 1000.0f * speed_mult;
+        last_ticks = now;
+        if (step_credit > BALL_STEP * BALL_MAX_STEPS) step_credit = BALL_STEP * BALL_MAX_STEPS;
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        while (step_credit >= BALL_STEP) {
+            world_step(&world, BALL_STEP);
+            step_credit -= BALL_STEP;
         }
+        physics_ticks += SDL_GetPerformanceCounter() - t0;
 
         // Render balls
-        for(int i=0; i<10; i++) {
-            int ix = (int)balls[i].x;
-            int iy = (int)balls[i].y;
-            int center_x = ix + 20;
-            int center_y = iy + 20;
-            drawFilledCircle(renderer, center_x, center_y, 20, balls[i].color);
+        if (cpu_raster) {
+            soft_raster_clear(&raster, 0xFF000000);
+            for (int i = 0; i < world.count; i++) {
+                const Ball *b = &world.balls[i];
+                soft_raster_disc(&raster, b->x, b->y, world.radius, b->color);
+            }
+            soft_raster_flush(&raster, renderer);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
+            SDL_RenderClear(renderer);
+            float d = 2.0f * world.radius;
+            for (int i = 0; i < world.count; i++) {
+                const Ball *b = &world.balls[i];
+                SDL_FRect dst = {b->x - world.radius, b->y - world.radius, d, d};
+                sprite_batch_add(&batch, &ball_frame, &dst, 0, b->color);
+            }
+            sprite_batch_flush(&batch, renderer);
         }
 
-
-
         SDL_RenderPresent(renderer);
+        frames++;
         SDL_Delay(16); // ~60fps
     }
 
+    if (world.steps > 0) {
+        SDL_Log("bouncingball: %d balls of radius %.1f, %.3f ms and %.1f pair tests per step",
+                world.count, world.radius,
+                physics_ticks * 1000.0 / SDL_GetPerformanceFrequency() / world.steps,
+                (double)world.pair_tests / world.steps);
+    }
+    Uint32 runtime = SDL_GetTicks() - start_time;
+    SDL_Log("bouncingball: %u frames in %u s (avg %.1f fps)",
+            (unsigned)frames, (unsigned)(runtime / 1000), runtime ? frames * 1000.0f / runtime : 0.0f);
+    sprite_batch_log_summary(&batch, "bouncingball");
+    soft_raster_log_summary(&raster, "bouncingball");
+    sprite_batch_destroy(&batch);
+    soft_raster_destroy(&raster);
+    if (ball_tex) SDL_DestroyTexture(ball_tex);
+    world_destroy(&world);
+
     // Cleanup
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -2,6 +2,17 @@
  * Cityscape Screensaver
  * Replicates the yellow cityscape buildings with blinking windows from starry-n1ght.netlify.app
  *
+ * The skyline scrolls endlessly in three parallax layers. Each layer is a ring
+ * of fixed-width chunks; a chunk's buildings come from a PRNG seeded with the
+ * chunk's world position, so the city never repeats and chunks are rebuilt in
+ * place as they scroll in. All window state lives in one arena allocated at
+ * startup, so memory stays fixed however long the saver runs.
+ *
+ * Scrolling and window toggles advance together on a SCENE_FPS cadence
+ * rather than every frame, so the frames in between have no damage and skip
+ * their present. Chunks keep persistent render target canvases while they fit in
+ * CHUNK_TEXTURE_BUDGET; layers beyond it are drawn straight to the screen.
+ *
  * Program: Portable C screensaver using SDL2
  * Compile: gcc -o cityscape main_cityscape.c `sdl2-config --cflags --libs` -lm
  * Run: ./cityscape
@@ -13,16 +24,20 @@
 #include <stdbool.h>
 #include <time.h>
 #include <math.h>
+#include <string.h>
 #include <unistd.h> // for getopt
+#include "common/power_policy.h"
+#include "common/damage.h"
 
 extern char *optarg;
 
-#define WINDOW_WIDTH 800
+#define WINDOW_WIDTH 800  // Windowed mode size; fullscreen uses the display size
 #define WINDOW_HEIGHT 600
-#define TARGET_FPS 60
-#define FRAME_DELAY_MS (1000 / TARGET_FPS)
+#define MIN_USEFUL_FPS 5 // Windows toggle every 0.5-2 s
+#define MIN_SCROLLING_FPS 15
+#define SCENE_FPS MIN_SCROLLING_FPS // Scene steps per second, and so presents at most
 
-#define NUM_BUILDINGS 15
+// Building sizes for a WINDOW_HEIGHT tall screen, scaled with the screen height
 #define MIN_BUILDING_WIDTH 30
 #define MAX_BUILDING_WIDTH 90
 #define MIN_BUILDING_HEIGHT 100
@@ -39,25 +54,122 @@ extern char *optarg;
 
 #define WINDOW_SPACING 10
 
+// Window toggles are scheduled on a timer wheel in 10 ms ticks. Every delay
+// (0.5-2 s) is shorter than one turn of the wheel, so a single level is
+// enough and each slot only holds windows that are due on that tick.
+#define TIMER_TICK_SECONDS 0.01f
+#define TIMER_WHEEL_SLOTS 256 // Power of two, > MAX_TOGGLE_TICKS
+#define MIN_TOGGLE_TICKS 50
+#define MAX_TOGGLE_TICKS 200
+
+#define NUM_LAYERS 3
+#define CHUNK_BUILDINGS 2 // Chunk width in widest near-layer buildings
+#define CHUNK_TEXTURE_BUDGET (64 * 1024 * 1024) // Chunk canvas bytes; a 4K skyline fits
+
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -f 0|1  Windowed (0) or fullscreen (1) mode (default: fullscreen)\n");
+    fprintf(stderr, "  -s F    Scroll speed multiplier, 0 for a still skyline (default: 1.0)\n");
+    fprintf(stderr, "  -p 0|1  Power-aware frame rate (1=on, 0=off) (default: 1)\n");
+    fprintf(stderr, "  -i N    Minutes between frame rate step downs (default: 5)\n");
+    fprintf(stderr, "  -b 0|1  Blank after the slowest useful frame rate (default: 0)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
 typedef struct {
-    int x, y;          // Bottom-left corner position
+    float height_factor;   // Building heights relative to the base range
+    float width_factor;    // Building widths relative to the base range
+    float speed;           // Scroll speed in pixels per second on a WINDOW_HEIGHT screen
+    Uint8 building_r, building_g, building_b;
+    Uint8 window_r, window_g, window_b;
+} LayerStyle;
+
+// Far to near: tall dim towers behind, the original skyline in front
+static const LayerStyle layer_styles[NUM_LAYERS] = {
+    {1.5f, 0.6f, 3.0f, 90, 68, 2, 140, 140, 140},
+    {1.2f, 0.8f, 6.0f, 170, 128, 5, 200, 200, 200},
+    {1.0f, 1.0f, 12.0f, BUILDING_R, BUILDING_G, BUILDING_B, WINDOW_R, WINDOW_G, WINDOW_B},
+};
+
+typedef struct {
+    int x, y;          // Top-left corner within the chunk texture
     int width, height; // Building dimensions
     int window_rows;   // Number of window rows
     int window_cols;   // Number of window columns
-    uint8_t *window_states;      // 1 = on, 0 = off
-    float *window_timers;        // Seconds until next toggle check
+    int first_window;  // Window number of the first window within the chunk
+    int window_count;
+    int lit_count;     // Maintained on every toggle, never recounted
 } Building;
 
-void initialize_buildings(Building *buildings);
-void update_windows(Building *buildings, float dt);
-void render(SDL_Renderer *renderer, Building *buildings);
+typedef struct {
+    int layer;
+    int slot;                 // Position in the layer's ring
+    long index;               // World chunk number stored in this slot
+    int first_window;         // City-wide window number of the chunk's window 0
+    int window_count;         // Windows in use, at most the per-chunk capacity
+    Building *buildings;      // Arena slice
+    int building_count;
+
+    SDL_Texture *texture;     // Persistent canvas, NULL without render targets
+    bool dirty;               // Texture needs a full redraw
+
+    // Windows toggled since the last flush, in chunk coordinates. Also used
+    // as scratch space for full redraws.
+    SDL_Rect *lit_patches;
+    SDL_Rect *dark_patches;
+    int lit_patch_count;
+    int dark_patch_count;
+} Chunk;
+
+typedef struct {
+    const LayerStyle *style;
+    Chunk *chunks;            // Ring buffer, ring_size slots
+    int head;                 // Slot holding the leftmost chunk
+    long first_index;         // World number of the leftmost chunk
+    float scroll;             // Pixels the leftmost chunk has moved off screen
+    int drawn_scroll;         // Whole-pixel scroll at the last present
+    int texture_height;       // Tallest building the layer can generate
+    int min_width, max_width, min_height, max_height;
+} Layer;
+
+typedef struct {
+    int width, height;        // Screen size the skyline was built for
+    float scale;              // Screen height relative to WINDOW_HEIGHT
+    int chunk_width;
+    int ring_size;            // Chunks per layer: screen width plus one spare
+    Uint32 seed;
+    Layer layers[NUM_LAYERS];
+
+    // Everything below points into one arena allocated at startup
+    void *arena;
+    Chunk *chunks;            // NUM_LAYERS * ring_size
+    int chunk_count;
+    int windows_per_chunk;    // Capacity, the same for every chunk
+    int buildings_per_chunk;
+    int total_windows;        // chunk_count * windows_per_chunk
+    uint64_t *lit_bits;       // Window states, one bit per window (1 = on)
+    uint16_t *window_building; // Building within its chunk, per window
+
+    // Timer wheel: per-slot singly linked lists threaded through wheel_next.
+    // Every window number stays scheduled for the whole run; numbers past a
+    // chunk's window_count are simply rescheduled when they come due, so
+    // recycling a chunk never has to unlink anything.
+    int wheel_head[TIMER_WHEEL_SLOTS];
+    int *wheel_next;
+    Uint32 current_tick;
+    float tick_accum;         // Seconds not yet turned into whole ticks
+    float step_accum;         // Seconds not yet applied to the scene
+    size_t texture_bytes;     // Chunk canvas memory in use
+} City;
+
+bool initialize_city(City *city, SDL_Renderer *renderer, int screen_width, int screen_height, Uint32 seed);
+void free_city(City *city);
+void generate_chunk(City *city, Chunk *chunk, long index);
+void scroll_city(City *city, float dt, DamageTracker *damage);
+void update_windows(City *city, float dt, DamageTracker *damage);
+void flush_chunks(SDL_Renderer *renderer, City *city);
+void render(SDL_Renderer *renderer, City *city);
 
 /**
  * Main program entry point
@@ -65,12 +177,31 @@ void render(SDL_Renderer *renderer, Building *buildings);
 int main(int argc, char *argv[]) {
     int opt;
     int do_fullscreen = 1;
+    float scroll_mult = 1.0f;
+    int power_saving = 1;
+    int idle_minutes = 5;
+    int allow_blank = 0;
 
-    while ((opt = getopt(argc, argv, "f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "f:s:p:i:b:h")) != -1) {
         switch (opt) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 's':
+                scroll_mult = atof(optarg);
+                if (scroll_mult < 0.0f) scroll_mult = 0.0f;
+                if (scroll_mult > 10.0f) scroll_mult = 10.0f;
+                break;
+            case 'p':
+                power_saving = atoi(optarg);
+                break;
+            case 'i':
+                idle_minutes = atoi(optarg);
+                if (idle_minutes < 1) idle_minutes = 1;
+                break;
+            case 'b':
+                allow_blank = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -79,7 +210,8 @@ int main(int argc, char *argv[]) {
     }
 
     setenv("SDL_VIDEODRIVER", "wayland", 1); // Force Wayland for Hyprland
-    srand((unsigned int)time(NULL));
+    Uint32 seed = (Uint32)time(NULL);
+    srand(seed);
 
     // Initialize SDL
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
@@ -123,19 +255,36 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    // Initialize buildings
-    Building buildings[NUM_BUILDINGS];
-    initialize_buildings(buildings);
+    // Build the skyline for the actual output size
+    int screen_width, screen_height;
+    SDL_GetRendererOutputSize(renderer, &screen_width, &screen_height);
+    if (screen_width <= 0 || screen_height <= 0) {
+        screen_width = WINDOW_WIDTH;
+        screen_height = WINDOW_HEIGHT;
+    }
+
+    City city;
+    if (!initialize_city(&city, renderer, screen_width, screen_height, seed)) {
+        fprintf(stderr, "Failed to allocate the skyline\n");
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+
+    DamageTracker damage;
+    damage_init(&damage, city.width, city.height);
 
     // Main loop
-    uint32_t last_time = SDL_GetTicks();
+    PowerPolicy power;
+    power_policy_init(&power, scroll_mult > 0.0f ? MIN_SCROLLING_FPS : MIN_USEFUL_FPS,
+                      power_saving, idle_minutes, allow_blank);
     bool running = true;
     SDL_Event event;
 
     while (running) {
-        uint32_t current_time = SDL_GetTicks();
-        float dt = (current_time - last_time) / 1000.0f;
-        last_time = current_time;
+        float dt = power_policy_begin_frame(&power);
+        bool rebuild = false;
 
         // Handle events
         while (SDL_PollEvent(&event)) {
@@ -148,31 +297,90 @@ int main(int argc, char *argv[]) {
                         running = false;
                     }
                     break;
+                case SDL_WINDOWEVENT:
+                    if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                        // The compositor may settle on the final size late: rebuild for it
+                        int new_width, new_height;
+                        SDL_GetRendererOutputSize(renderer, &new_width, &new_height);
+                        if ((new_width != city.width || new_height != city.height) &&
+                            new_width > 0 && new_height > 0) {
+                            rebuild = true;
+                        }
+                    }
+                    // Exposed, resized, restored, ...: the screen needs a fresh copy
+                    damage_add_full(&damage);
+                    break;
+                case SDL_RENDER_TARGETS_RESET:
+                    for (int i = 0; i < city.chunk_count; i++) {
+                        city.chunks[i].dirty = true;
+                    }
+                    damage_add_full(&damage);
+                    break;
+                case SDL_RENDER_DEVICE_RESET:
+                    // Textures are gone: start over with fresh ones
+                    rebuild = true;
+                    damage_add_full(&damage);
+                    break;
+            }
+        }
+
+        if (rebuild) {
+            int new_width, new_height;
+            SDL_GetRendererOutputSize(renderer, &new_width, &new_height);
+            City rebuilt;
+            if (new_width > 0 && new_height > 0 &&
+                initialize_city(&rebuilt, renderer, new_width, new_height, seed)) {
+                free_city(&city);
+                city = rebuilt;
+                damage.width = city.width;
+                damage.height = city.height;
             }
         }
 
-        // Update window states
-        update_windows(buildings, dt);
+        if (power_policy_is_blank(&power)) {
+            if (!power.blank_presented) {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                SDL_RenderPresent(renderer);
+                power.blank_presented = 1;
+            }
+            damage_add_full(&damage); // Show the scene again once unblanked
+            power_policy_wait(&power);
+            continue;
+        }
 
-        // Clear screen to black
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        // Scroll the layers and update window states, both on the scene
+        // cadence: thousands of windows toggle every second, so stepping
+        // them per frame would damage (and present) every frame
+        city.step_accum += dt;
+        if (city.step_accum >= 1.0f / SCENE_FPS) {
+            scroll_city(&city, city.step_accum * scroll_mult, &damage);
+            update_windows(&city, city.step_accum, &damage);
+            city.step_accum = 0.0f;
+        }
+
+        // Frames where nothing moved a whole pixel and no visible window
+        // toggled skip the redraw and the present
+        if (damage_pending(&damage)) {
+            flush_chunks(renderer, &city);
 
-        // Render buildings and windows
-        render(renderer, buildings);
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            SDL_RenderClear(renderer);
+            render(renderer, &city);
 
-        // Present frame
-        SDL_RenderPresent(renderer);
+            SDL_RenderPresent(renderer);
+        }
+        damage_end_frame(&damage);
 
-        // Maintain target FPS
-        SDL_Delay(FRAME_DELAY_MS);
+        // Sleep until the next frame at the current power policy rate
+        power_policy_wait(&power);
     }
 
+    power_policy_log_summary(&power, "cityscape");
+    damage_log_summary(&damage, "cityscape");
+
     // Cleanup
-    for (int i = 0; i < NUM_BUILDINGS; i++) {
-        free(buildings[i].window_states);
-        free(buildings[i].window_timers);
-    }
+    free_city(&city);
 
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -182,23 +390,239 @@ int main(int argc, char *argv[]) {
 }
 
 /**
- * Initialize building positions, sizes, and window grids
+ * Small seeded PRNG (xorshift32) for reproducible chunk layouts
+ */
+static inline Uint32 chunk_random(Uint32 *state) {
+    Uint32 x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static inline Uint32 chunk_seed(Uint32 seed, int layer, long index) {
+    Uint32 h = seed ^ (0x9E3779B9u * (Uint32)(layer + 1)) ^ (0x85EBCA6Bu * (Uint32)index);
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    return h ? h : 1; // xorshift must not start at zero
+}
+
+static inline bool window_is_lit(const City *city, int window) {
+    return (city->lit_bits[window >> 6] >> (window & 63)) & 1;
+}
+
+static inline void window_set_lit(City *city, int window, bool lit) {
+    uint64_t mask = (uint64_t)1 << (window & 63);
+    if (lit) {
+        city->lit_bits[window >> 6] |= mask;
+    } else {
+        city->lit_bits[window >> 6] &= ~mask;
+    }
+}
+
+/**
+ * Queue a window on the timer wheel to be checked again in 0.5-2 s
  */
-void initialize_buildings(Building *buildings) {
-    int current_x = 0; // Start at left edge
+static inline void schedule_window(City *city, int window) {
+    int delay = MIN_TOGGLE_TICKS + rand() % (MAX_TOGGLE_TICKS - MIN_TOGGLE_TICKS + 1);
+    int slot = (city->current_tick + delay) & (TIMER_WHEEL_SLOTS - 1);
+    city->wheel_next[window] = city->wheel_head[slot];
+    city->wheel_head[slot] = window;
+}
 
-    for (int i = 0; i < NUM_BUILDINGS; i++) {
-        Building *building = &buildings[i];
+/**
+ * Rectangle of a window within its chunk texture, centered in its grid cell
+ */
+static SDL_Rect window_rect(const Building *building, int local_window) {
+    int index = local_window - building->first_window;
+    int row = index / building->window_cols;
+    int col = index % building->window_cols;
+    SDL_Rect rect = {
+        building->x + col * WINDOW_SPACING + 3, // +3 for offset from edge
+        building->y + row * WINDOW_SPACING + 3,
+        WINDOW_SIZE,
+        WINDOW_SIZE
+    };
+    return rect;
+}
 
-        // Random width and height within specified ranges
-        building->width = MIN_BUILDING_WIDTH +
-                         (rand() % (MAX_BUILDING_WIDTH - MIN_BUILDING_WIDTH + 1));
-        building->height = MIN_BUILDING_HEIGHT +
-                          (rand() % (MAX_BUILDING_HEIGHT - MIN_BUILDING_HEIGHT + 1));
+/**
+ * Screen position of a chunk's top-left corner
+ */
+static void chunk_position(const City *city, const Chunk *chunk, int *x, int *y) {
+    const Layer *layer = &city->layers[chunk->layer];
+    int pos = (chunk->slot - layer->head + city->ring_size) % city->ring_size;
+    *x = pos * city->chunk_width - (int)layer->scroll;
+    *y = city->height - layer->texture_height;
+}
+
+static size_t arena_align(size_t size) {
+    return (size + 15) & ~(size_t)15;
+}
+
+/**
+ * Lay out the parallax layers for the screen size, carve every chunk's
+ * storage out of one arena and generate the chunks in view.
+ */
+bool initialize_city(City *city, SDL_Renderer *renderer, int screen_width, int screen_height, Uint32 seed) {
+    memset(city, 0, sizeof(*city));
+    city->width = screen_width;
+    city->height = screen_height;
+    city->scale = (float)screen_height / WINDOW_HEIGHT;
+    city->seed = seed;
+
+    // Building sizes per layer; window size and spacing stay fixed so a 4K
+    // skyline carries thousands of windows
+    int tallest = 0;
+    int narrowest = 0;
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        Layer *layer = &city->layers[l];
+        layer->style = &layer_styles[l];
+        float width_scale = city->scale * layer->style->width_factor;
+        float height_scale = city->scale * layer->style->height_factor;
+        layer->min_width = (int)(MIN_BUILDING_WIDTH * width_scale);
+        layer->max_width = (int)(MAX_BUILDING_WIDTH * width_scale);
+        layer->min_height = (int)(MIN_BUILDING_HEIGHT * height_scale);
+        layer->max_height = (int)(MAX_BUILDING_HEIGHT * height_scale);
+        if (layer->min_width < WINDOW_SPACING) layer->min_width = WINDOW_SPACING;
+        if (layer->max_width < layer->min_width) layer->max_width = layer->min_width;
+        if (layer->min_height < WINDOW_SPACING) layer->min_height = WINDOW_SPACING;
+        if (layer->max_height < layer->min_height) layer->max_height = layer->min_height;
+        if (layer->max_height > screen_height) layer->max_height = screen_height;
+        if (layer->min_height > layer->max_height) layer->min_height = layer->max_height;
+        layer->texture_height = layer->max_height;
+
+        if (layer->texture_height > tallest) tallest = layer->texture_height;
+        if (narrowest == 0 || layer->min_width < narrowest) narrowest = layer->min_width;
+    }
+
+    city->chunk_width = (int)(MAX_BUILDING_WIDTH * city->scale) * CHUNK_BUILDINGS;
+    if (city->chunk_width < WINDOW_SPACING) city->chunk_width = WINDOW_SPACING;
+    // Enough chunks to cover the screen while the leftmost one scrolls out
+    city->ring_size = (screen_width + city->chunk_width - 1) / city->chunk_width + 1;
+    city->chunk_count = NUM_LAYERS * city->ring_size;
+
+    // Per-chunk capacity: window columns of all buildings add up to at most
+    // the chunk width, plus one for a sliver cut off at the chunk edge
+    city->buildings_per_chunk = city->chunk_width / narrowest + 1;
+    city->windows_per_chunk = (city->chunk_width / WINDOW_SPACING + 1) * (tallest / WINDOW_SPACING);
+    if (city->windows_per_chunk < city->buildings_per_chunk) {
+        city->windows_per_chunk = city->buildings_per_chunk; // Scratch space for building rects
+    }
+    city->total_windows = city->chunk_count * city->windows_per_chunk;
+    int words = (city->total_windows + 63) / 64;
+
+    // One allocation for the whole run
+    size_t chunks_size = arena_align(city->chunk_count * sizeof(Chunk));
+    size_t buildings_size = arena_align((size_t)city->chunk_count * city->buildings_per_chunk * sizeof(Building));
+    size_t patches_size = arena_align((size_t)city->chunk_count * city->windows_per_chunk * 2 * sizeof(SDL_Rect));
+    size_t bits_size = arena_align(words * sizeof(uint64_t));
+    size_t next_size = arena_align((size_t)city->total_windows * sizeof(int));
+    size_t owner_size = arena_align((size_t)city->total_windows * sizeof(uint16_t));
+    size_t arena_size = chunks_size + buildings_size + patches_size + bits_size + next_size + owner_size;
+
+    city->arena = calloc(1, arena_size);
+    if (!city->arena) return false;
+
+    char *cursor = city->arena;
+    city->chunks = (Chunk *)cursor;                   cursor += chunks_size;
+    Building *buildings = (Building *)cursor;         cursor += buildings_size;
+    SDL_Rect *patches = (SDL_Rect *)cursor;           cursor += patches_size;
+    city->lit_bits = (uint64_t *)cursor;              cursor += bits_size;
+    city->wheel_next = (int *)cursor;                 cursor += next_size;
+    city->window_building = (uint16_t *)cursor;
+
+    for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+        city->wheel_head[slot] = -1;
+    }
+    for (int window = 0; window < city->total_windows; window++) {
+        schedule_window(city, window);
+    }
+
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        Layer *layer = &city->layers[l];
+        layer->chunks = &city->chunks[l * city->ring_size];
+
+        // Persistent canvases while they fit the budget; without render
+        // target support or past it, chunks are drawn straight to the screen
+        size_t layer_bytes = (size_t)city->ring_size * city->chunk_width * layer->texture_height * 4;
+        bool use_textures = SDL_RenderTargetSupported(renderer) &&
+                            city->texture_bytes + layer_bytes <= CHUNK_TEXTURE_BUDGET;
+        if (use_textures) city->texture_bytes += layer_bytes;
+
+        for (int s = 0; s < city->ring_size; s++) {
+            int c = l * city->ring_size + s;
+            Chunk *chunk = &layer->chunks[s];
+            chunk->layer = l;
+            chunk->slot = s;
+            chunk->first_window = c * city->windows_per_chunk;
+            chunk->buildings = &buildings[c * city->buildings_per_chunk];
+            chunk->lit_patches = &patches[(size_t)c * city->windows_per_chunk * 2];
+            chunk->dark_patches = chunk->lit_patches + city->windows_per_chunk;
+
+            if (use_textures) {
+                chunk->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                                   city->chunk_width, layer->texture_height);
+                if (chunk->texture) {
+                    SDL_SetTextureBlendMode(chunk->texture, SDL_BLENDMODE_BLEND);
+                } else {
+                    fprintf(stderr, "Warning: Failed to create chunk texture: %s\n", SDL_GetError());
+                }
+            }
+
+            generate_chunk(city, chunk, s);
+        }
+    }
+
+    SDL_Log("Cityscape: %d layers of %d chunks (%d px), %d window slots, %zu KB arena, %zu KB canvases for %dx%d",
+            NUM_LAYERS, city->ring_size, city->chunk_width, city->total_windows,
+            arena_size / 1024, city->texture_bytes / 1024, screen_width, screen_height);
+    return true;
+}
+
+void free_city(City *city) {
+    for (int i = 0; i < city->chunk_count; i++) {
+        if (city->chunks[i].texture) SDL_DestroyTexture(city->chunks[i].texture);
+    }
+    free(city->arena);
+    memset(city, 0, sizeof(*city));
+}
+
+/**
+ * Fill a chunk with the buildings of world chunk `index`. The layout only
+ * depends on the seed, layer and index; nothing is allocated.
+ */
+void generate_chunk(City *city, Chunk *chunk, long index) {
+    const Layer *layer = &city->layers[chunk->layer];
+    Uint32 rng = chunk_seed(city->seed, chunk->layer, index);
+
+    chunk->index = index;
+    chunk->building_count = 0;
+    chunk->window_count = 0;
+    chunk->lit_patch_count = 0;
+    chunk->dark_patch_count = 0;
+    chunk->dirty = true;
+
+    int current_x = 0; // Start at the chunk's left edge
+
+    while (current_x < city->chunk_width && chunk->building_count < city->buildings_per_chunk) {
+        Building *building = &chunk->buildings[chunk->building_count];
+
+        // Random width and height within the layer's ranges
+        building->width = layer->min_width + (int)(chunk_random(&rng) % (Uint32)(layer->max_width - layer->min_width + 1));
+        building->height = layer->min_height + (int)(chunk_random(&rng) % (Uint32)(layer->max_height - layer->min_height + 1));
+
+        // A building running past the chunk edge is cut; the next chunk
+        // continues with a new building right next to it
+        if (current_x + building->width > city->chunk_width) {
+            building->width = city->chunk_width - current_x;
+        }
 
         // Position building (side by side, no gaps, bottom-aligned)
         building->x = current_x;
-        building->y = WINDOW_HEIGHT - building->height;
+        building->y = layer->texture_height - building->height;
 
         // Calculate window grid (columns and rows based on spacing)
         building->window_cols = building->width / WINDOW_SPACING;
@@ -208,120 +632,225 @@ void initialize_buildings(Building *buildings) {
         if (building->window_cols < 1) building->window_cols = 1;
         if (building->window_rows < 1) building->window_rows = 1;
 
-        int total_windows = building->window_cols * building->window_rows;
-
-        // Allocate window state and timer arrays
-        building->window_states = malloc(total_windows * sizeof(uint8_t));
-        building->window_timers = malloc(total_windows * sizeof(float));
+        building->first_window = chunk->window_count;
+        building->window_count = building->window_cols * building->window_rows;
+        building->lit_count = 0;
 
         // Initialize window states (30% chance of starting on)
-        for (int j = 0; j < total_windows; j++) {
-            building->window_states[j] = (rand() % 100 < 30) ? 1 : 0;
-            building->window_timers[j] = 0.5f + ((float)rand() / RAND_MAX) * 1.5f; // 0.5-2 sec initial
+        for (int j = 0; j < building->window_count; j++) {
+            int window = chunk->first_window + building->first_window + j;
+            bool lit = chunk_random(&rng) % 100 < 30;
+            window_set_lit(city, window, lit);
+            if (lit) building->lit_count++;
+            city->window_building[window] = (uint16_t)chunk->building_count;
         }
 
+        chunk->window_count += building->window_count;
+        chunk->building_count++;
+
         // Move to next building position (no gaps)
         current_x += building->width;
     }
+}
 
-    // Handle case where buildings exceed window width (wrap or scale, but keep simple)
-    if (current_x > WINDOW_WIDTH) {
-        // For simplicity, just place buildings within bounds
-        current_x = 0;
-        for (int i = 0; i < NUM_BUILDINGS; i++) {
-            buildings[i].x = i * (WINDOW_WIDTH / NUM_BUILDINGS);
-            buildings[i].width = WINDOW_WIDTH / NUM_BUILDINGS;
+/**
+ * Move every layer at its own speed. Chunks that leave on the left are
+ * regenerated in place as the next chunk on the right.
+ */
+void scroll_city(City *city, float dt, DamageTracker *damage) {
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        Layer *layer = &city->layers[l];
+        layer->scroll += layer->style->speed * city->scale * dt;
+
+        while (layer->scroll >= city->chunk_width) {
+            layer->scroll -= city->chunk_width;
+            generate_chunk(city, &layer->chunks[layer->head], layer->first_index + city->ring_size);
+            layer->head = (layer->head + 1) % city->ring_size;
+            layer->first_index++;
+            layer->drawn_scroll = -1; // Positions of every chunk changed
+        }
+
+        if ((int)layer->scroll != layer->drawn_scroll) {
+            layer->drawn_scroll = (int)layer->scroll;
+            damage_add_full(damage);
         }
     }
 }
 
 /**
- * Update window timers and toggle states as needed
+ * Advance the timer wheel and handle the windows that are due. Only expiring
+ * windows are touched, so the cost does not grow with the skyline size.
+ * Toggled windows are queued as patches for their chunk's canvas and
+ * reported to the damage tracker.
  */
-void update_windows(Building *buildings, float dt) {
-    for (int i = 0; i < NUM_BUILDINGS; i++) {
-        Building *building = &buildings[i];
-        int total_windows = building->window_cols * building->window_rows;
-
-        // Count currently lit windows for population control
-        int lit_count = 0;
-        for (int j = 0; j < total_windows; j++) {
-            if (building->window_states[j]) lit_count++;
-        }
+void update_windows(City *city, float dt, DamageTracker *damage) {
+    city->tick_accum += dt;
+
+    while (city->tick_accum >= TIMER_TICK_SECONDS) {
+        city->tick_accum -= TIMER_TICK_SECONDS;
+        city->current_tick++;
+
+        // Detach the due list first: rescheduled windows land in later slots
+        int slot = city->current_tick & (TIMER_WHEEL_SLOTS - 1);
+        int window = city->wheel_head[slot];
+        city->wheel_head[slot] = -1;
+
+        while (window >= 0) {
+            int next = city->wheel_next[window];
+            Chunk *chunk = &city->chunks[window / city->windows_per_chunk];
+            int local = window - chunk->first_window;
 
-        for (int j = 0; j < total_windows; j++) {
-            // Decrement timer
-            building->window_timers[j] -= dt;
+            // Window slots the current chunk does not use just keep ticking
+            if (local < chunk->window_count) {
+                Building *building = &chunk->buildings[city->window_building[window]];
 
-            // Check for state toggle when timer expires
-            if (building->window_timers[j] <= 0.0f) {
                 // 50% chance to toggle state, but only if it helps maintain 20-40% lit windows
-                int target_min_lit = (int)(total_windows * 0.20f);
-                int target_max_lit = (int)(total_windows * 0.40f);
+                int target_min_lit = (int)(building->window_count * 0.20f);
+                int target_max_lit = (int)(building->window_count * 0.40f);
 
                 bool can_toggle = (rand() % 2 == 0); // Base 50% chance
 
                 if (can_toggle) {
                     // Check if toggle would keep lit count in desired range
-                    bool would_be_lit = !building->window_states[j];
-                    int new_lit_count = would_be_lit ? lit_count + 1 : lit_count - 1;
+                    bool would_be_lit = !window_is_lit(city, window);
+                    int new_lit_count = would_be_lit ? building->lit_count + 1 : building->lit_count - 1;
 
                     if (new_lit_count >= target_min_lit && new_lit_count <= target_max_lit) {
                         // Perform the toggle
-                        building->window_states[j] = 1 - building->window_states[j];
-                        lit_count = new_lit_count;
+                        window_set_lit(city, window, would_be_lit);
+                        building->lit_count = new_lit_count;
+
+                        SDL_Rect rect = window_rect(building, local);
+                        if (chunk->lit_patch_count + chunk->dark_patch_count >= city->windows_per_chunk) {
+                            // Off-screen chunks are not flushed every frame: redraw instead of overflowing
+                            chunk->dirty = true;
+                            chunk->lit_patch_count = 0;
+                            chunk->dark_patch_count = 0;
+                        }
+                        if (chunk->texture && !chunk->dirty) {
+                            if (would_be_lit) {
+                                chunk->lit_patches[chunk->lit_patch_count++] = rect;
+                            } else {
+                                chunk->dark_patches[chunk->dark_patch_count++] = rect;
+                            }
+                        }
+
+                        int chunk_x, chunk_y;
+                        chunk_position(city, chunk, &chunk_x, &chunk_y);
+                        damage_add(damage, chunk_x + rect.x, chunk_y + rect.y, rect.w, rect.h);
                     }
                 }
-
-                // Reset timer (0.5-2 seconds)
-                building->window_timers[j] = 0.5f + ((float)rand() / RAND_MAX) * 1.5f;
             }
+
+            // Check again in 0.5-2 seconds
+            schedule_window(city, window);
+            window = next;
         }
     }
 }
 
 /**
- * Render all buildings and their windows
+ * Draw a chunk's buildings and lit windows at an offset, one batched fill
+ * each. Used for full canvas redraws (offset 0) and for drawing straight to
+ * the screen without render target support.
  */
-void render(SDL_Renderer *renderer, Building *buildings) {
-    // Set building color (mustard yellow)
-    SDL_SetRenderDrawColor(renderer, BUILDING_R, BUILDING_G, BUILDING_B, 255);
+static void draw_chunk(SDL_Renderer *renderer, City *city, Chunk *chunk, int offset_x, int offset_y) {
+    const LayerStyle *style = city->layers[chunk->layer].style;
 
-    for (int i = 0; i < NUM_BUILDINGS; i++) {
-        Building *building = &buildings[i];
-
-        // Create SDL_Rect for building
+    // Buildings, using the dark patch buffer as scratch (capacity >= building count)
+    for (int i = 0; i < chunk->building_count; i++) {
+        Building *building = &chunk->buildings[i];
         SDL_Rect building_rect = {
-            building->x,
-            building->y,
+            building->x + offset_x,
+            building->y + offset_y,
             building->width,
             building->height
         };
+        chunk->dark_patches[i] = building_rect;
+    }
+    SDL_SetRenderDrawColor(renderer, style->building_r, style->building_g, style->building_b, 255);
+    SDL_RenderFillRects(renderer, chunk->dark_patches, chunk->building_count);
+
+    // Lit windows, walking only the set bits of this chunk's window range
+    int count = 0;
+    int first = chunk->first_window;
+    int last = chunk->first_window + chunk->window_count; // Exclusive
+    for (int w = first >> 6; w <= (last - 1) >> 6 && last > first; w++) {
+        uint64_t bits = city->lit_bits[w];
+        while (bits) {
+            int window = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (window < first || window >= last) continue;
+
+            int local = window - first;
+            SDL_Rect rect = window_rect(&chunk->buildings[city->window_building[window]], local);
+            rect.x += offset_x;
+            rect.y += offset_y;
+            chunk->lit_patches[count++] = rect;
+        }
+    }
+    SDL_SetRenderDrawColor(renderer, style->window_r, style->window_g, style->window_b, 255);
+    SDL_RenderFillRects(renderer, chunk->lit_patches, count);
 
-        // Draw building as filled rectangle
-        SDL_RenderFillRect(renderer, &building_rect);
-
-        // Draw lit windows
-        SDL_SetRenderDrawColor(renderer, WINDOW_R, WINDOW_G, WINDOW_B, 255);
-
-        for (int row = 0; row < building->window_rows; row++) {
-            for (int col = 0; col < building->window_cols; col++) {
-                int window_index = row * building->window_cols + col;
-
-                if (building->window_states[window_index]) {
-                    // Calculate window position (centered in grid cells, offset from edges)
-                    int window_x = building->x + col * WINDOW_SPACING + 3; // +3 for offset from edge
-                    int window_y = building->y + row * WINDOW_SPACING + 3;
+    // Pending patches are part of the full draw
+    chunk->lit_patch_count = 0;
+    chunk->dark_patch_count = 0;
+}
 
-                    SDL_Rect window_rect = {
-                        window_x,
-                        window_y,
-                        WINDOW_SIZE,
-                        WINDOW_SIZE
-                    };
+/**
+ * Bring every chunk canvas up to date: full redraws for freshly generated
+ * chunks, two batched fills of toggled windows for the rest.
+ */
+void flush_chunks(SDL_Renderer *renderer, City *city) {
+    for (int i = 0; i < city->chunk_count; i++) {
+        Chunk *chunk = &city->chunks[i];
+        if (!chunk->texture) continue;
+        if (!chunk->dirty && chunk->lit_patch_count == 0 && chunk->dark_patch_count == 0) continue;
+
+        const LayerStyle *style = city->layers[chunk->layer].style;
+        SDL_SetRenderTarget(renderer, chunk->texture);
+
+        if (chunk->dirty) {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0); // Transparent above the buildings
+            SDL_RenderClear(renderer);
+            draw_chunk(renderer, city, chunk, 0, 0);
+            chunk->dirty = false;
+        } else {
+            // Lit windows in the layer's window color, dark ones painted over
+            // in the building color
+            if (chunk->lit_patch_count > 0) {
+                SDL_SetRenderDrawColor(renderer, style->window_r, style->window_g, style->window_b, 255);
+                SDL_RenderFillRects(renderer, chunk->lit_patches, chunk->lit_patch_count);
+            }
+            if (chunk->dark_patch_count > 0) {
+                SDL_SetRenderDrawColor(renderer, style->building_r, style->building_g, style->building_b, 255);
+                SDL_RenderFillRects(renderer, chunk->dark_patches, chunk->dark_patch_count);
+            }
+            chunk->lit_patch_count = 0;
+            chunk->dark_patch_count = 0;
+        }
+    }
+    SDL_SetRenderTarget(renderer, NULL);
+}
 
-                    SDL_RenderFillRect(renderer, &window_rect);
-                }
+/**
+ * Composite the layers far to near, one copy per visible chunk
+ */
+void render(SDL_Renderer *renderer, City *city) {
+    for (int l = 0; l < NUM_LAYERS; l++) {
+        Layer *layer = &city->layers[l];
+
+        for (int pos = 0; pos < city->ring_size; pos++) {
+            Chunk *chunk = &layer->chunks[(layer->head + pos) % city->ring_size];
+            int x, y;
+            chunk_position(city, chunk, &x, &y);
+            if (x >= city->width) break;
+
+            if (chunk->texture) {
+                SDL_Rect dst = {x, y, city->chunk_width, layer->texture_height};
+                SDL_RenderCopy(renderer, chunk->texture, NULL, &dst);
+            } else {
+                draw_chunk(renderer, city, chunk, x, y);
             }
         }
     }
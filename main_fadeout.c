@@ -4,6 +4,8 @@
 #include <time.h>
 #include <unistd.h> // for getopt
 #include "assets/omarchy_logo.h"
+#include "common/power_policy.h"
+#include "common/damage.h"
 
 extern char *optarg;
 
@@ -12,6 +14,10 @@ static void usage(const char *prog) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -p 0|1  Power-aware frame rate (1=on, 0=off) (default: 1)\n");
+    fprintf(stderr, "  -i N    Minutes between frame rate step downs (default: 5)\n");
+    fprintf(stderr, "  -b 0|1  Blank after the slowest useful frame rate (default: 0)\n");
+    fprintf(stderr, "  -d 0|1  Fade to black once, then turn the display off (default: 0)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -19,8 +25,12 @@ int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int power_saving = 1;
+    int idle_minutes = 5;
+    int allow_blank = 0;
+    int fade_to_dpms = 0;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:p:i:b:d:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -30,6 +40,19 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'p':
+                power_saving = atoi(optarg);
+                break;
+            case 'i':
+                idle_minutes = atoi(optarg);
+                if (idle_minutes < 1) idle_minutes = 1;
+                break;
+            case 'b':
+                allow_blank = atoi(optarg);
+                break;
+            case 'd':
+                fade_to_dpms = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -151,6 +174,10 @@ int main(int argc, char *argv[]) {
     }
     SDL_FreeSurface(screenshot_surf);
 
+    // The fade darkens the screenshot itself through its color mod, so each
+    // frame is one opaque copy that covers every pixel: no clear, no overlay
+    SDL_SetTextureBlendMode(bg_tex, SDL_BLENDMODE_NONE);
+
     // Hide cursor during screensaver
     system("hyprctl keyword cursor:invisible true &>/dev/null");
 
@@ -159,7 +186,20 @@ int main(int argc, char *argv[]) {
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
 
+    // A 10 s fade still looks smooth at 15 fps
+    PowerPolicy power;
+    power_policy_init(&power, 15, power_saving, idle_minutes, allow_blank);
+
+    // The whole screen changes together, so damage is all or nothing: only
+    // when the 8-bit fade level actually steps
+    DamageTracker damage;
+    damage_init(&damage, W, H);
+    int last_alpha = -1;
+    int dpms_off = 0;
+
     while (!quit) {
+        power_policy_begin_frame(&power);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 SDL_Log("Screensaver quit triggered: event type %d", e.type);
@@ -171,9 +211,29 @@ int main(int argc, char *argv[]) {
                     SDL_Log("Screensaver quit triggered: mouse motion after grace period");
                     quit = 1;
                 }
+            } else if (e.type == SDL_WINDOWEVENT) {
+                damage_add_full(&damage);
             }
         }
 
+        // Faded to DPMS: nothing left to draw until input ends the saver
+        if (dpms_off) {
+            SDL_WaitEventTimeout(NULL, POWER_BLANK_WAIT_MS);
+            continue;
+        }
+
+        if (power_policy_is_blank(&power)) {
+            if (!power.blank_presented) {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                SDL_RenderPresent(renderer);
+                power.blank_presented = 1;
+            }
+            damage_add_full(&damage); // Show the fade again once unblanked
+            power_policy_wait(&power);
+            continue;
+        }
+
         Uint32 current_time = SDL_GetTicks();
         float time_s = (current_time - start_time) / 1000.0f;
 
@@ -181,7 +241,10 @@ int main(int argc, char *argv[]) {
         float cycle_time = fmodf(time_s, 10.0f); // 10 second cycle
         float fade_amount;
 
-        if (cycle_time < 5.0f) {
+        if (fade_to_dpms) {
+            // A single 5 second fade to black, which then stays
+            fade_amount = SDL_min(time_s / 5.0f, 1.0f) * 255.0f;
+        } else if (cycle_time < 5.0f) {
             // First 5 seconds: fade in from transparent (0) to fully black (255)
             fade_amount = (cycle_time / 5.0f) * 255.0f;
         } else {
@@ -189,24 +252,39 @@ int main(int argc, char *argv[]) {
             fade_amount = ((10.0f - cycle_time) / 5.0f) * 255.0f;
         }
 
-        // Clear renderer to black each frame
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
-
-        // Draw background texture first
-        if (bg_tex) {
-            SDL_RenderCopy(renderer, bg_tex, NULL, NULL);
+        Uint8 alpha = (Uint8)fade_amount;
+        if (alpha != last_alpha) {
+            damage_add_full(&damage);
+            last_alpha = alpha;
+        }
+        if (!damage_pending(&damage)) {
+            damage_end_frame(&damage);
+            power_policy_wait(&power);
+            continue;
         }
 
-        // Draw full-screen black overlay with alpha blending (like spotlight)
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, (Uint8)fade_amount);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_RenderFillRect(renderer, NULL);
+        // Background darkened by the fade in the same copy
+        Uint8 level = 255 - alpha;
+        SDL_SetTextureColorMod(bg_tex, level, level, level);
+        SDL_RenderCopy(renderer, bg_tex, NULL, NULL);
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        damage_end_frame(&damage);
+
+        if (fade_to_dpms && alpha == 255) {
+            SDL_Log("fadeout: faded out after %.1f s, turning the display off", time_s);
+            system("hyprctl dispatch dpms off > /dev/null 2>&1");
+            dpms_off = 1;
+            continue;
+        }
+        power_policy_wait(&power);
     }
 
+    power_policy_log_summary(&power, "fadeout");
+    damage_log_summary(&damage, "fadeout");
+
+    if (dpms_off) system("hyprctl dispatch dpms on > /dev/null 2>&1");
+
     // Exit fullscreen on quit to show Waybar immediately
     system("(hyprctl dispatch fullscreen > /dev/null 2>&1)");
     SDL_Delay(200); // Allow Hyprland to process fullscreen exit
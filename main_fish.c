@@ -1,37 +1,50 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
-#include "assets/fish_angel.h"
-#include "assets/fish_butterfly.h"
-#include "assets/fish_clown.h"
-#include "assets/fish_flounder.h"
-#include "assets/fish_guppy.h"
-#include "assets/fish_jelly.h"
-#include "assets/fish_minnow.h"
-#include "assets/fish_red.h"
-#include "assets/fish_seahorse.h"
-#include "assets/fish_sprite.h"
-#include "assets/fish_striped.h"
-#include "assets/seafloor.h"
-#include "assets/bubbles_50.h"
+#include "assets/fish_atlas.h"
 #include <math.h>
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/particles.h"
+#include "common/quality_governor.h"
+#include "common/mipmap.h"
+#include "common/sprite_batch.h"
+#include "common/thread_pool.h"
 
 #define WINDOW_WIDTH 0  // fullscreen
 #define WINDOW_HEIGHT 0
 #define SPRITE_SIZE 145
 #define FISH_FRAME_COUNT 4  // not used
 
+// Schooling mode (-b 1): fish steer by separation, alignment and cohesion
+// instead of following the entities[] paths. Neighbours are found through a
+// uniform grid of cells one neighbour radius wide, rebuilt every step.
+#define SCHOOL_DEFAULT_FISH 1000
+#define SCHOOL_MAX_FISH 20000
+#define SCHOOL_DEFAULT_BUBBLES 150
+#define SCHOOL_MAX_BUBBLES 2000
+#define SCHOOL_STEP (1.0f / 60.0f)      // Fixed simulation step, seconds
+#define SCHOOL_MAX_STEPS 4              // Steps per frame before the simulation slows instead
+#define SCHOOL_MAX_NEIGHBOURS 24        // Flockmates considered per fish
+#define SCHOOL_MIN_SPEED 45.0f          // px/s, times -s
+#define SCHOOL_MAX_SPEED 130.0f
+#define SCHOOL_MIN_FISH_SIZE 24
+#define SCHOOL_MAX_TILT 0.5f            // radians
+#define SCHOOL_SPECIES 11               // Fish sprites come first in the atlas
+
 extern char *optarg;
 
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
-    fprintf(stderr, "  -t N    Number of fish (default: all)\n");
-    fprintf(stderr, "  -m N    Number of bubbles (default: all)\n");
+    fprintf(stderr, "  -t N    Number of fish (default: all, or %d when schooling, max %d)\n",
+            SCHOOL_DEFAULT_FISH, SCHOOL_MAX_FISH);
+    fprintf(stderr, "  -m N    Bubbles alive at once (default: 15, or %d when schooling)\n", SCHOOL_DEFAULT_BUBBLES);
+    fprintf(stderr, "  -b 0|1  Schooling mode: fish flock instead of following set paths (default: 0)\n");
+    fprintf(stderr, "  -j N    Simulation threads when schooling (default: one per core)\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -97,14 +110,327 @@ const Entity entities[] = {
     {1, 10, 8, 4}, // bubble right
 };
 
+typedef struct {
+    int capacity;
+    int count;                          // Fish simulated and drawn (governor knob)
+    float *x, *y;                       // Centre, px
+    float *vx, *vy;                     // Velocity, px/s
+    float *nvx, *nvy;                   // Velocity for the next step, written by the steer pass
+    float *phase;                       // Flap animation offset, s
+    Uint8 *species;
+
+    // Uniform grid, rebuilt by counting sort each step
+    float cell;
+    int cols, rows;
+    int *cell_start;                    // cols * rows + 1 offsets into cell_fish
+    int *cell_fish;                     // Fish indices grouped by cell, ascending within a cell
+    int *fish_cell;
+
+    float size;                         // Drawn size, px
+    float radius;                       // Neighbour radius, px
+    float separation;                   // Personal space, px
+    float width;                        // Wrap width, px (screen plus a fish either side)
+    float top, bottom;                  // Band the fish keep to
+    float min_speed, max_speed;
+    float dt;
+    Uint32 step;
+    float bubble_credit;                // Fractional bubbles owed to the emitter
+    Uint32 rng;
+    void *arena;
+} School;
+
+/**
+ * Deterministic noise in [-1, 1] from (fish, step), so the wander term does
+ * not depend on which thread steers which fish
+ */
+static inline float school_noise(Uint32 i, Uint32 step) {
+    Uint32 h = i * 0x9E3779B1u ^ step * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    h *= 0x297A2D39u;
+    h ^= h >> 15;
+    return (h & 0xFFFF) * (2.0f / 65535.0f) - 1.0f;
+}
+
+static inline Uint32 school_rand(School *s) {
+    s->rng ^= s->rng << 13;
+    s->rng ^= s->rng >> 17;
+    s->rng ^= s->rng << 5;
+    return s->rng;
+}
+
+static int school_init(School *s, int capacity, int W, int H, float floor_h, float speed_mult) {
+    SDL_memset(s, 0, sizeof(*s));
+    s->capacity = capacity;
+    s->count = capacity;
+
+    // Fewer, larger fish when there are only a few hundred
+    s->size = 72.0f * sqrtf(300.0f / capacity);
+    if (s->size > 72.0f) s->size = 72.0f;
+    if (s->size < SCHOOL_MIN_FISH_SIZE) s->size = SCHOOL_MIN_FISH_SIZE;
+    s->radius = s->size * 1.5f;
+    s->separation = s->size * 0.6f;
+    s->width = W + 2.0f * s->size;
+    s->top = s->size * 0.5f;
+    s->bottom = H - floor_h * 0.5f;
+    if (s->bottom < s->top + s->size) s->bottom = s->top + s->size;
+    s->min_speed = SCHOOL_MIN_SPEED * speed_mult;
+    s->max_speed = SCHOOL_MAX_SPEED * speed_mult;
+    s->dt = SCHOOL_STEP;
+    s->rng = 0x2545F491u;
+
+    s->cell = s->radius;
+    s->cols = (int)ceilf(s->width / s->cell);
+    s->rows = (int)ceilf(H / s->cell) + 1;
+    int cells = s->cols * s->rows;
+
+    size_t n = (size_t)capacity;
+    size_t bytes = sizeof(float) * n * 7 + n + sizeof(int) * (n * 2 + cells + 1);
+    char *p = malloc(bytes);
+    if (!p) return -1;
+    s->arena = p;
+    s->x = (float *)p;
+    s->y = s->x + n;
+    s->vx = s->y + n;
+    s->vy = s->vx + n;
+    s->nvx = s->vy + n;
+    s->nvy = s->nvx + n;
+    s->phase = s->nvy + n;
+    s->cell_start = (int *)(s->phase + n);
+    s->cell_fish = s->cell_start + cells + 1;
+    s->fish_cell = s->cell_fish + n;
+    s->species = (Uint8 *)(s->fish_cell + n);
+
+    // Species are dealt out in runs so each starts as a loose school
+    for (int i = 0; i < capacity; i++) {
+        s->species[i] = (Uint8)((i * SCHOOL_SPECIES) / capacity);
+        s->x[i] = (rand() % 10000) * 0.0001f * s->width - s->size;
+        s->y[i] = s->top + (rand() % 10000) * 0.0001f * (s->bottom - s->top);
+        float dir = (rand() & 1) ? 1.0f : -1.0f;
+        float speed = s->min_speed + (rand() % 100) * 0.01f * (s->max_speed - s->min_speed) * 0.5f;
+        s->vx[i] = dir * speed;
+        s->vy[i] = ((rand() % 200) - 100) * 0.002f * speed;
+        s->phase[i] = (rand() % 600) * 0.001f;
+    }
+    return 0;
+}
+
+static void school_destroy(School *s) {
+    free(s->arena);
+    SDL_memset(s, 0, sizeof(*s));
+}
+
+static void school_build_grid(School *s) {
+    int cells = s->cols * s->rows;
+    float inv_cell = 1.0f / s->cell;
+    SDL_memset(s->cell_start, 0, sizeof(int) * (size_t)(cells + 1));
+
+    for (int i = 0; i < s->count; i++) {
+        int cx = (int)((s->x[i] + s->size) * inv_cell);
+        int cy = (int)(s->y[i] * inv_cell);
+        if (cx < 0) cx = 0;
+        if (cx >= s->cols) cx = s->cols - 1;
+        if (cy < 0) cy = 0;
+        if (cy >= s->rows) cy = s->rows - 1;
+        s->fish_cell[i] = cy * s->cols + cx;
+        s->cell_start[s->fish_cell[i] + 1]++;
+    }
+    for (int c = 0; c < cells; c++) {
+        s->cell_start[c + 1] += s->cell_start[c];
+    }
+    // Scatter in index order using cell_start as the write cursor, then
+    // shift it back; keeps each cell's fish ascending so neighbour order
+    // (and the neighbour cap) is the same on every run
+    for (int i = 0; i < s->count; i++) {
+        s->cell_fish[s->cell_start[s->fish_cell[i]]++] = i;
+    }
+    for (int c = cells; c > 0; c--) {
+        s->cell_start[c] = s->cell_start[c - 1];
+    }
+    s->cell_start[0] = 0;
+}
+
+/**
+ * Steer fish [begin, end). Reads positions and velocities only and writes
+ * nvx/nvy for its own range, so any split across threads gives the same
+ * result.
+ */
+static void school_steer(void *user, int begin, int end) {
+    School *s = user;
+    const float r2 = s->radius * s->radius;
+    const float sep2 = s->separation * s->separation;
+
+    for (int i = begin; i < end; i++) {
+        float xi = s->x[i], yi = s->y[i];
+        float vxi = s->vx[i], vyi = s->vy[i];
+        int sp = s->species[i];
+        int cx = s->fish_cell[i] % s->cols;
+        int cy = s->fish_cell[i] / s->cols;
+
+        float sep_x = 0, sep_y = 0;
+        float ali_x = 0, ali_y = 0;
+        float coh_x = 0, coh_y = 0;
+        int mates = 0, seen = 0;
+
+        for (int gy = cy - 1; gy <= cy + 1 && seen < SCHOOL_MAX_NEIGHBOURS; gy++) {
+            if (gy < 0 || gy >= s->rows) continue;
+            for (int gx = cx - 1; gx <= cx + 1 && seen < SCHOOL_MAX_NEIGHBOURS; gx++) {
+                if (gx < 0 || gx >= s->cols) continue;
+                int c = gy * s->cols + gx;
+                for (int k = s->cell_start[c]; k < s->cell_start[c + 1]; k++) {
+                    int j = s->cell_fish[k];
+                    if (j == i) continue;
+                    float dx = xi - s->x[j];
+                    float dy = yi - s->y[j];
+                    float d2 = dx * dx + dy * dy;
+                    if (d2 > r2) continue;
+
+                    // Everyone keeps their distance; only the same species school
+                    if (d2 < sep2 && d2 > 1e-4f) {
+                        sep_x += dx / d2;
+                        sep_y += dy / d2;
+                    }
+                    if (s->species[j] == sp) {
+                        ali_x += s->vx[j];
+                        ali_y += s->vy[j];
+                        coh_x += s->x[j];
+                        coh_y += s->y[j];
+                        mates++;
+                    }
+                    if (++seen >= SCHOOL_MAX_NEIGHBOURS) break;
+                }
+            }
+        }
+
+        // Accelerations in px/s^2
+        float ax = sep_x * 60.0f * s->size;
+        float ay = sep_y * 60.0f * s->size;
+        if (mates > 0) {
+            float inv = 1.0f / mates;
+            ax += (ali_x * inv - vxi) * 1.5f + (coh_x * inv - xi) * 0.8f;
+            ay += (ali_y * inv - vyi) * 1.5f + (coh_y * inv - yi) * 0.8f;
+        }
+        ax += school_noise((Uint32)i, s->step) * 20.0f;
+        ay += school_noise((Uint32)i + 0x10000u, s->step) * 35.0f;
+
+        // Obstacles: turn away from the surface and the seafloor well before them
+        float margin = s->size;
+        if (yi < s->top + margin) ay += (s->top + margin - yi) * 8.0f;
+        if (yi > s->bottom - margin) ay -= (yi - (s->bottom - margin)) * 12.0f;
+
+        float nvx = vxi + ax * s->dt;
+        float nvy = vyi + ay * s->dt;
+
+        // Fish swim, they do not climb: keep the heading within about 30 degrees
+        float max_vy = fabsf(nvx) * 0.6f + 10.0f;
+        if (nvy > max_vy) nvy = max_vy;
+        if (nvy < -max_vy) nvy = -max_vy;
+
+        float speed = sqrtf(nvx * nvx + nvy * nvy);
+        if (speed > s->max_speed) {
+            nvx *= s->max_speed / speed;
+            nvy *= s->max_speed / speed;
+        } else if (speed < s->min_speed) {
+            if (speed < 1e-3f) {
+                nvx = s->min_speed;
+                nvy = 0;
+            } else {
+                nvx *= s->min_speed / speed;
+                nvy *= s->min_speed / speed;
+            }
+        }
+        s->nvx[i] = nvx;
+        s->nvy[i] = nvy;
+    }
+}
+
+/**
+ * Start a bubble rising from (x, y) unless `limit` are already alive.
+ * Returns its slot, or -1.
+ */
+static int bubble_spawn(ParticlePool *bubbles, int limit, float x, float y, float rise, float size) {
+    if (bubbles->live >= limit) return -1;
+    int b = particle_spawn(bubbles, x, y, 0, -rise);
+    if (b >= 0) bubbles->size[b] = size;
+    return b;
+}
+
+/**
+ * Sway every bubble from side to side, then move them all; bubbles that
+ * leave the top of the pool bounds die there
+ */
+static void bubble_update(ParticlePool *bubbles, float dt) {
+    for (int b = 0; b < bubbles->high; b++) {
+        if (bubbles->life[b] > 0) bubbles->vx[b] = sinf(bubbles->y[b] * 0.05f + bubbles->vy[b]) * 12.0f;
+    }
+    particle_pool_update(bubbles, dt);
+}
+
+/**
+ * Queue every live bubble, flipping between the two frames as it rises.
+ * Bubbles with a decay rate flip every 0.2 s of their age instead.
+ */
+static void bubble_queue(SpriteBatch *batch, const ParticlePool *bubbles, const AtlasFrame *frames) {
+    const SDL_Color white = {255, 255, 255, 255};
+    for (int b = 0; b < bubbles->high; b++) {
+        if (bubbles->life[b] <= 0) continue;
+        float w = bubbles->size[b];
+        float h = w * 1.12f; // 50x56 sprite
+        SDL_FRect dstrect = {bubbles->x[b] - w * 0.5f, bubbles->y[b] - h * 0.5f, w, h};
+        int frame;
+        if (bubbles->decay[b] > 0.0f) {
+            float age = (1.0f - bubbles->life[b]) / bubbles->decay[b];
+            frame = (int)(age / 0.2f) & 1;
+        } else {
+            frame = (int)floorf(bubbles->y[b] * 0.1f) & 1;
+        }
+        sprite_batch_add(batch, &frames[frame], &dstrect, 0, white);
+    }
+}
+
+/**
+ * One fixed step: grid, parallel steering, then serial integration
+ */
+static void school_step(School *s, ThreadPool *pool, ParticlePool *bubbles, int bubble_limit) {
+    school_build_grid(s);
+    thread_pool_run(pool, school_steer, s, s->count, 256);
+
+    for (int i = 0; i < s->count; i++) {
+        s->vx[i] = s->nvx[i];
+        s->vy[i] = s->nvy[i];
+        s->x[i] += s->vx[i] * s->dt;
+        s->y[i] += s->vy[i] * s->dt;
+        if (s->x[i] < -s->size) s->x[i] += s->width;
+        if (s->x[i] >= s->width - s->size) s->x[i] -= s->width;
+        if (s->y[i] < s->top) s->y[i] = s->top;
+        if (s->y[i] > s->bottom) s->y[i] = s->bottom;
+    }
+    s->step++;
+
+    // About one bubble per fish every 20 s from a random fish's mouth,
+    // spread evenly over the steps
+    s->bubble_credit += s->count * s->dt / 20.0f;
+    while (s->bubble_credit >= 1.0f && s->count > 0) {
+        int f = (int)(school_rand(s) % (Uint32)s->count);
+        float mouth = s->x[f] + (s->vx[f] < 0 ? -0.5f : 0.5f) * s->size;
+        bubble_spawn(bubbles, bubble_limit, mouth, s->y[f], 40.0f + school_rand(s) % 40, 25.0f);
+        s->bubble_credit -= 1.0f;
+    }
+    bubble_update(bubbles, s->dt);
+}
+
 int main(int argc, char *argv[]) {
     int opt;
-    int fish_count = 33; // increased max default by 3
-    int bubble_count = 15;
+    int fish_count = -1;  // -1 = mode default
+    int bubble_count = -1;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int adaptive_quality = 1;
+    int schooling = 0;
+    int threads = 0;
 
-    while ((opt = getopt(argc, argv, "t:m:s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "t:m:s:f:q:b:j:h")) != -1) {
         switch (opt) {
             case 't':
                 fish_count = atoi(optarg);
@@ -120,6 +446,15 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
+            case 'b':
+                schooling = atoi(optarg);
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -127,6 +462,14 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    if (fish_count < 0) fish_count = schooling ? SCHOOL_DEFAULT_FISH : 33; // increased max default by 3
+    if (bubble_count < 0) bubble_count = schooling ? SCHOOL_DEFAULT_BUBBLES : 15;
+    if (schooling) {
+        if (fish_count < 1) fish_count = 1;
+        if (fish_count > SCHOOL_MAX_FISH) fish_count = SCHOOL_MAX_FISH;
+        if (bubble_count > SCHOOL_MAX_BUBBLES) bubble_count = SCHOOL_MAX_BUBBLES;
+    }
+
     setenv("SDL_VIDEODRIVER", "wayland", 1); // Force Wayland for Hyprland
     srand(time(NULL));
 
@@ -150,6 +493,9 @@ int main(int argc, char *argv[]) {
     for (size_t j = 0; j < entity_count; j++) {
         if (entities[j].is_toaster == 0) { entity_delay[j] = 0.0f; break; }
     }
+    // Each bubble column (is_toaster==1) sends up one bubble after its delay
+    int bubble_sent[entity_count];
+    SDL_memset(bubble_sent, 0, sizeof(bubble_sent));
 
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         SDL_Log("SDL_Init Error: %s", SDL_GetError());
@@ -192,89 +538,96 @@ int main(int argc, char *argv[]) {
     int fish_size = SPRITE_SIZE / 2;
     float margin_pct = 1.0f + 2.0f * fish_size / (float)W;
 
-    // Load textures
-    SDL_Texture *fish_texs[11], *bg_tex, *bubble_tex;
-    SDL_Surface *surf;
-    int bg_w = 0, bg_h = 0;
-    for (int i = 0; i < 11; i++) {
-        const unsigned char *data = NULL;
-        unsigned int len = 0;
-        switch (i) {
-            case 0: data = fish_angel; len = fish_angel_len; break;
-            case 1: data = fish_butterfly; len = fish_butterfly_len; break;
-            case 2: data = fish_flounder; len = fish_flounder_len; break;
-            case 3: data = fish_guppy; len = fish_guppy_len; break;
-            case 4: data = fish_jelly; len = fish_jelly_len; break;
-            case 5: data = fish_minnow; len = fish_minnow_len; break;
-            case 6: data = fish_red; len = fish_red_len; break;
-            case 7: data = fish_seahorse; len = fish_seahorse_len; break;
-            case 8: data = fish_sprite; len = fish_sprite_len; break;
-            case 9: data = fish_striped; len = fish_striped_len; break;
-            case 10: data = fish_clown; len = fish_clown_len; break;
-        }
-        SDL_RWops *rw = SDL_RWFromConstMem(data, len);
-        if (!rw) {
-            SDL_Log("Error creating RWops for embedded fish texture %d: %s", i, SDL_GetError());
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        surf = IMG_Load_RW(rw, 1); // 1 to autoclose
-        if (!surf) {
-            SDL_Log("Error loading embedded fish texture %d: %s", i, IMG_GetError());
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        fish_texs[i] = SDL_CreateTextureFromSurface(renderer, surf);
-        SDL_FreeSurface(surf);
+    // Load the sprite atlas: every fish, bubble and seafloor frame in one
+    // texture (regenerate with `make atlases`)
+    SDL_RWops *rw = SDL_RWFromConstMem(fish_atlas, fish_atlas_len);
+    if (!rw) {
+        SDL_Log("Error creating RWops for embedded fish atlas: %s", SDL_GetError());
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
-
-    // Background seabed
-    SDL_RWops *rw_bg = SDL_RWFromConstMem(seafloor, seafloor_len);
-    if (!rw_bg) {
-        SDL_Log("Error creating RWops for embedded seafloor: %s", SDL_GetError());
-        // Skip background
-        bg_tex = NULL;
-    } else {
-        surf = IMG_Load_RW(rw_bg, 1); // 1 to autoclose
-        if (!surf) {
-            SDL_Log("Error loading embedded seafloor: %s", IMG_GetError());
-            // Skip background
-            bg_tex = NULL;
-        } else {
-            bg_tex = SDL_CreateTextureFromSurface(renderer, surf);
-            bg_w = surf->w;
-            bg_h = surf->h;
-            SDL_FreeSurface(surf);
-        }
+    SDL_Surface *surf = IMG_Load_RW(rw, 1); // 1 to autoclose
+    if (!surf) {
+        SDL_Log("Error loading embedded fish atlas: %s", IMG_GetError());
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
 
-    // Bubbles
-    SDL_RWops *rw_bubble = SDL_RWFromConstMem(bubbles_50, bubbles_50_len);
-    if (!rw_bubble) {
-        SDL_Log("Error creating RWops for embedded bubbles: %s", SDL_GetError());
+    // Fish are drawn at half their 145 px frames or less, so they come from
+    // a half-size copy of the atlas. The chain stops there: the 2 px gutters
+    // between frames shrink to 1 px, and one more halving would let linear
+    // filtering bleed neighbouring frames into small fish.
+    MipTexture atlas;
+    int atlas_ok = mip_create(&atlas, renderer, surf, FISH_ATLAS_WIDTH / 2) == 0;
+    SDL_FreeSurface(surf);
+    SpriteBatch batch;
+    if (!atlas_ok || sprite_batch_init(&batch, atlas.levels[0], FISH_ATLAS_WIDTH, FISH_ATLAS_HEIGHT, 64) != 0) {
+        SDL_Log("Error creating fish atlas texture: %s", SDL_GetError());
+        mip_destroy(&atlas);
         SDL_DestroyRenderer(renderer);
         SDL_DestroyWindow(window);
         IMG_Quit();
         SDL_Quit();
         return 1;
     }
-    surf = IMG_Load_RW(rw_bubble, 1); // 1 to autoclose
-    if (!surf) {
-        SDL_Log("Error loading embedded bubbles: %s", IMG_GetError());
+    const SDL_Color white = {255, 255, 255, 255};
+    const AtlasFrame *seafloor = &fish_atlas_frames[fish_atlas_sprites[FISH_ATLAS_SEAFLOOR].first];
+    const AtlasFrame *bubble_frames = &fish_atlas_frames[fish_atlas_sprites[FISH_ATLAS_BUBBLE].first];
+
+    // Bubbles in both modes live in a particle pool and die above the top edge
+    ParticlePool bubbles;
+    if (particle_pool_init(&bubbles, bubble_count, 0) != 0) {
+        SDL_Log("Out of memory for %d bubbles", bubble_count);
+        sprite_batch_destroy(&batch);
+        mip_destroy(&atlas);
         SDL_DestroyRenderer(renderer);
         SDL_DestroyWindow(window);
         IMG_Quit();
         SDL_Quit();
         return 1;
     }
-    bubble_tex = SDL_CreateTextureFromSurface(renderer, surf);
-    SDL_FreeSurface(surf);
+    particle_pool_set_bounds(&bubbles, -W, -56.0f, 2.0f * W, 2.0f * H);
+
+    School school = {0};
+    ThreadPool pool = {0};
+    if (schooling) {
+        if (school_init(&school, fish_count, W, H, (float)seafloor->h, speed_mult) != 0 ||
+            sprite_batch_reserve(&batch, fish_count + bubble_count + W / seafloor->w + 2) != 0) {
+            SDL_Log("Out of memory for %d schooling fish", fish_count);
+            school_destroy(&school);
+            particle_pool_destroy(&bubbles);
+            sprite_batch_destroy(&batch);
+            mip_destroy(&atlas);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        thread_pool_init(&pool, threads);
+        SDL_Log("fishsaver: schooling %d fish at %.0f px on %d threads",
+                fish_count, school.size, thread_pool_threads(&pool));
+    }
+    float drawn_size = schooling ? school.size : (float)fish_size;
+    int fish_level = mip_pick_scale(&atlas, drawn_size / SPRITE_SIZE);
+    SDL_Log("fishsaver: fish drawn from the %dx%d atlas level",
+            atlas.widths[fish_level], atlas.heights[fish_level]);
+
+    // Fish and bubble counts are density knobs scaled by the quality governor,
+    // never above what -t/-m asked for
+    int fish_limit = fish_count;
+    int bubble_limit = bubble_count;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    int fish_floor = schooling ? 100 : 4;
+    governor_register_knob(&gov, "fish", &fish_limit, fish_count < fish_floor ? fish_count : fish_floor, fish_count);
+    governor_register_knob(&gov, "bubbles", &bubble_limit, bubble_count < 1 ? bubble_count : 1, bubble_count);
 
     // Hide cursor during screensaver
     system("hyprctl keyword cursor:invisible true &>/dev/null");
@@ -283,8 +636,15 @@ int main(int argc, char *argv[]) {
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    float time_s = 0;
+    Uint64 prev_counter = SDL_GetPerformanceCounter();
+    float step_accum = 0;
+    Uint64 sim_ticks = 0;
+    Uint32 sim_steps = 0;
 
     while (!quit) {
+        governor_begin_frame(&gov);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 SDL_Log("Screensaver quit triggered: event type %d", e.type);
@@ -300,117 +660,161 @@ int main(int argc, char *argv[]) {
         }
 
         Uint32 current_time = SDL_GetTicks();
-        float time_s = (current_time - start_time) / 1000.0f;
+        float prev_time_s = time_s;
+        time_s = (current_time - start_time) / 1000.0f;
 
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
         SDL_RenderClear(renderer);
 
-        // Background seabed
-        if (bg_tex) {
-            for (int x = 0; x < W; x += bg_w) {
-                SDL_Rect bgrect = {x, H - bg_h, bg_w, bg_h};
-                SDL_RenderCopy(renderer, bg_tex, NULL, &bgrect);
-            }
-        } else {
-            SDL_SetRenderDrawColor(renderer, 139, 69, 19, 255); // brown color
-            SDL_RenderFillRect(renderer, &(SDL_Rect){0, H - 100, W, 100}); // sea floor bottom
+        // Background seabed, tiled across the bottom
+        sprite_batch_set_texture(&batch, renderer, atlas.levels[0]);
+        for (int x = 0; x < W; x += seafloor->w) {
+            SDL_FRect bgrect = {(float)x, (float)(H - seafloor->h), (float)seafloor->w, (float)seafloor->h};
+            sprite_batch_add(&batch, seafloor, &bgrect, 0, white);
         }
 
-        size_t entity_count = sizeof(entities) / sizeof(entities[0]);
-
-        // Render bubbles (is_toaster==1)
-        int drawn_bubbles = 0;
-        for (size_t i = 0; i < entity_count; i++) {
-            if (drawn_bubbles >= bubble_count) break;
-            const Entity ent = entities[i];
-            if (ent.is_toaster != 1) continue;
-            const struct AnimParam ap = anim_params[ent.anim_type];
-            const struct Pos pos = poses[ent.pos_index];
-
-            float local_time = time_s - (ap.delay + entity_delay[i]);
-            if (local_time < 0) continue;
-
-            float current_x = pos.top_pct * W / 100.0f - 25.0f; // center bubble
-            float current_y = (H + 56.0f) - local_time * ((H + 56.0f) / ap.fly_duration);
-            if (current_y < -56) continue;
-
-            SDL_Rect dstrect = {(int)current_x, (int)current_y, 50, 56};
-
-            // Bubble animation (2 frames)
-            float bubble_cycle = fmodf(local_time, 0.4f);
-            int bubble_frame = (int)(bubble_cycle / 0.2f) % 2;
-            SDL_Rect bubble_srcrect = {bubble_frame * 50, 0, 50, 56};
-
-            SDL_RenderCopy(renderer, bubble_tex, &bubble_srcrect, &dstrect);
-            drawn_bubbles++;
-        }
+        if (schooling) {
+            // Fixed steps keep the flock identical at any frame rate; after
+            // a stall, catch up a few steps and then let it slow down
+            Uint64 now = SDL_GetPerformanceCounter();
+            step_accum += (float)(now - prev_counter) / SDL_GetPerformanceFrequency();
+            prev_counter = now;
+            if (step_accum > SCHOOL_MAX_STEPS * SCHOOL_STEP) step_accum = SCHOOL_MAX_STEPS * SCHOOL_STEP;
+            school.count = fish_limit;
+            while (step_accum >= SCHOOL_STEP) {
+                Uint64 t0 = SDL_GetPerformanceCounter();
+                school_step(&school, &pool, &bubbles, bubble_limit);
+                sim_ticks += SDL_GetPerformanceCounter() - t0;
+                sim_steps++;
+                step_accum -= SCHOOL_STEP;
+            }
 
-        // Render fish (is_toaster==0)
-        int drawn_fish = 0;
-        for (size_t i = 0; i < entity_count; i++) {
-            const Entity ent = entities[i];
-            if (ent.is_toaster != 0) continue;
-            if (drawn_fish >= fish_count) continue;
-            const struct AnimParam ap = anim_params[ent.anim_type];
-
-            // Animation timing
-            float local_time = time_s - (ap.delay + entity_delay[i]);
-            if (local_time < 0) continue;
-
-            float current_top_pct = random_row_pct[i];
-
-            float effective_duration = ap.fly_duration * entity_speed_mult[i] * 1.2f;
-            float cycle_time = fmodf(local_time, effective_duration);
-            float fly_f = cycle_time / effective_duration;
-
-            // Calculate fish size (fixed 50% smaller)
-            int fish_size = SPRITE_SIZE / 2;
-
-            // Calculate start position
-            float start_y = (current_top_pct / 100.0f * H) - fish_size / 2.0f;
-
-            // Fish swim animation
-            int direction = ap.flap_direction;
-            float start_left_pct, end_left_pct;
-            if (direction == 0) { // ltr
-                start_left_pct = -margin_pct;
-                end_left_pct = 1.0f + margin_pct;
-            } else { // rtl
-                start_left_pct = 1.0f + margin_pct;
-                end_left_pct = -margin_pct;
+            bubble_queue(&batch, &bubbles, bubble_frames);
+
+            // Tilt each fish along its heading; flipped sprites turn the other way
+            sprite_batch_set_texture(&batch, renderer, atlas.levels[fish_level]);
+            float half = school.size * 0.5f;
+            for (int i = 0; i < school.count; i++) {
+                int flip = school.vx[i] < 0;
+                float tilt = atan2f(school.vy[i], fabsf(school.vx[i]));
+                if (tilt > SCHOOL_MAX_TILT) tilt = SCHOOL_MAX_TILT;
+                if (tilt < -SCHOOL_MAX_TILT) tilt = -SCHOOL_MAX_TILT;
+                SDL_FRect dstrect = {school.x[i] - half, school.y[i] - half, school.size, school.size};
+                int flap_frame = (int)((time_s + school.phase[i]) / 0.3f) % 2;
+                const AtlasSprite *sprite = &fish_atlas_sprites[school.species[i]];
+                const AtlasFrame *frame = &fish_atlas_frames[sprite->first + flap_frame % sprite->count];
+                sprite_batch_add_rotated(&batch, frame, &dstrect, flip ? -tilt : tilt, flip, white);
+            }
+        } else {
+            size_t entity_count = sizeof(entities) / sizeof(entities[0]);
+
+            // Bubble columns (is_toaster==1) release their bubble into the pool
+            // once its delay has passed, already risen by the time overshot.
+            // It lives a little longer than its rise, so its age (for the
+            // frame flip) can be read back from its life.
+            for (size_t i = 0; i < entity_count; i++) {
+                const Entity ent = entities[i];
+                if (ent.is_toaster != 1 || bubble_sent[i]) continue;
+                const struct AnimParam ap = anim_params[ent.anim_type];
+                float local_time = time_s - (ap.delay + entity_delay[i]);
+                if (local_time < 0) continue;
+
+                // Over the governor's bubble limit, the column retries each
+                // frame until its bubble would already be gone
+                float rise = (H + 56.0f) / ap.fly_duration;
+                float y = H + 84.0f - local_time * rise;
+                if (y < -56.0f) {
+                    bubble_sent[i] = 1;
+                    continue;
+                }
+                float x = poses[ent.pos_index].top_pct * W / 100.0f; // center bubble
+                int b = bubble_spawn(&bubbles, bubble_limit, x, y, rise, 50.0f);
+                if (b < 0) continue;
+                bubble_sent[i] = 1;
+                bubbles.decay[b] = 0.5f / ap.fly_duration;
+                bubbles.life[b] -= local_time * bubbles.decay[b];
             }
-            float delta_left_pct = end_left_pct - start_left_pct;
-            float current_left_pct = start_left_pct + delta_left_pct * fly_f;
+            particle_pool_update(&bubbles, time_s - prev_time_s);
+            bubble_queue(&batch, &bubbles, bubble_frames);
+
+            // Render fish (is_toaster==0)
+            sprite_batch_set_texture(&batch, renderer, atlas.levels[fish_level]);
+            int drawn_fish = 0;
+            for (size_t i = 0; i < entity_count; i++) {
+                const Entity ent = entities[i];
+                if (ent.is_toaster != 0) continue;
+                if (drawn_fish >= fish_limit) continue;
+                const struct AnimParam ap = anim_params[ent.anim_type];
+
+                // Animation timing
+                float local_time = time_s - (ap.delay + entity_delay[i]);
+                if (local_time < 0) continue;
+
+                float current_top_pct = random_row_pct[i];
+
+                float effective_duration = ap.fly_duration * entity_speed_mult[i] * 1.2f;
+                float cycle_time = fmodf(local_time, effective_duration);
+                float fly_f = cycle_time / effective_duration;
+
+                // Calculate fish size (fixed 50% smaller)
+                int fish_size = SPRITE_SIZE / 2;
+
+                // Calculate start position
+                float start_y = (current_top_pct / 100.0f * H) - fish_size / 2.0f;
+
+                // Fish swim animation
+                int direction = ap.flap_direction;
+                float start_left_pct, end_left_pct;
+                if (direction == 0) { // ltr
+                    start_left_pct = -margin_pct;
+                    end_left_pct = 1.0f + margin_pct;
+                } else { // rtl
+                    start_left_pct = 1.0f + margin_pct;
+                    end_left_pct = -margin_pct;
+                }
+                float delta_left_pct = end_left_pct - start_left_pct;
+                float current_left_pct = start_left_pct + delta_left_pct * fly_f;
 
-            float current_x = current_left_pct * W - fish_size / 2.0f;
-            float current_y = start_y;
-            SDL_Rect dstrect = {(int)current_x, (int)current_y, fish_size, fish_size};
+                float current_x = current_left_pct * W - fish_size / 2.0f;
+                float current_y = start_y;
+                SDL_FRect dstrect = {(float)(int)current_x, (float)(int)current_y, (float)fish_size, (float)fish_size};
 
-            // Fish sprite animation (2 frames)
-            float flap_cycle = fmodf(local_time, 0.6f); // 2 frames, 0.3s each
-            int flap_frame = (int)(flap_cycle / 0.3f) % 2;
-            SDL_Rect srcrect = {flap_frame * SPRITE_SIZE, 0, SPRITE_SIZE, SPRITE_SIZE};
+                // Fish sprite animation (2 frames)
+                float flap_cycle = fmodf(local_time, 0.6f); // 2 frames, 0.3s each
+                int flap_frame = (int)(flap_cycle / 0.3f) % 2;
+                const AtlasSprite *sprite = &fish_atlas_sprites[ent.toast_type];
+                const AtlasFrame *frame = &fish_atlas_frames[sprite->first + flap_frame % sprite->count];
 
-            SDL_RendererFlip flip = (direction == 1) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
-            SDL_RenderCopyEx(renderer, fish_texs[ent.toast_type], &srcrect, &dstrect, 0.0, NULL, flip);
-            drawn_fish++;
+                sprite_batch_add(&batch, frame, &dstrect, direction == 1, white);
+                drawn_fish++;
+            }
         }
 
-
+        // Seafloor and bubbles in one draw, then fish from their mip level
+        sprite_batch_flush(&batch, renderer);
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        governor_end_frame(&gov); // ~60fps
+    }
+
+    governor_log_summary(&gov, "fishsaver");
+    sprite_batch_log_summary(&batch, "fishsaver");
+    if (schooling && sim_steps > 0) {
+        SDL_Log("fishsaver: %.2f ms per simulation step (%u steps)",
+                1000.0 * sim_ticks / SDL_GetPerformanceFrequency() / sim_steps, sim_steps);
     }
 
     // Cleanup - restore cursor visibility
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
     // Cleanup
-    for (int i = 0; i < 11; i++) {
-        SDL_DestroyTexture(fish_texs[i]);
+    if (schooling) {
+        thread_pool_destroy(&pool);
+        school_destroy(&school);
     }
-    if (bg_tex) SDL_DestroyTexture(bg_tex);
-    SDL_DestroyTexture(bubble_tex);
+    particle_pool_destroy(&bubbles);
+    sprite_batch_destroy(&batch);
+    mip_destroy(&atlas);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
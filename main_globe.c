@@ -3,16 +3,47 @@
 #include <stdint.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h> // for getopt
 #include "assets/globe_texture.h"
+#include "common/mipmap.h"
+#include "common/power_policy.h"
+#include "common/simd.h"
 
 #define PI 3.14159f
 
 #define WINDOW_WIDTH 0  // fullscreen
 #define WINDOW_HEIGHT 0
-#define SPRITE_SIZE 145
-#define FISH_FRAME_COUNT 4  // not used
+
+#define STRIP_FRAMES 21         // Frames in globe_texture.h, one full turn
+#define MAP_W 1024              // Equirectangular map size, power of two for wrapping
+#define MAP_H 512
+#define MAP_MAX_LAT 1.40f       // Rows nearer the poles than this (radians) repeat it
+#define SPIN_TIME 1.4f          // Seconds per turn, as the CSS spin
+#define DEFAULT_SIZE 240
+#define MAX_GLOBES 16
+
+// Per-diameter lookup table: for every pixel of the globe's square, where
+// it lands on the map at rotation 0 and how brightly it is lit
+typedef struct {
+    int size;                   // Diameter in pixels
+    int stride;                 // Row length padded to SIMD_WIDTH
+    int map_w, map_h;           // Map level the table samples, map_w a power of two
+    float *u;                   // Map column at rotation 0
+    int *row;                   // Map row offset (row * map_w)
+    int *light;                 // Lighting, 0..256 fixed point
+    Uint32 *alpha;              // Edge coverage, already shifted to bits 24-31
+    int *span_start;            // First and last+1 covered pixel per row,
+    int *span_end;              // rounded out to SIMD_WIDTH
+    void *arena;
+} GlobeLut;
+
+typedef struct {
+    float x, y, vx, vy;
+    float phase;                // Rotation offset, turns
+    SDL_Texture *tex;
+} Globe;
 
 extern char *optarg;
 
@@ -21,19 +52,266 @@ static void usage(const char *prog) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -r N    Globe diameter in pixels (default: %d)\n", DEFAULT_SIZE);
+    fprintf(stderr, "  -n N    Number of globes (default: 1)\n");
+    fprintf(stderr, "  -p 0|1  Power-aware frame rate (1=on, 0=off) (default: 1)\n");
+    fprintf(stderr, "  -i N    Minutes between frame rate step downs (default: 5)\n");
+    fprintf(stderr, "  -b 0|1  Blank after the slowest useful frame rate (default: 0)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
-// Single globe texture
+/**
+ * Rebuild an equirectangular map from the spinning sprite strip. Every frame
+ * is an orthographic view turned a further 1/STRIP_FRAMES of a revolution, so
+ * each map texel is the average of the frames that see it, weighted toward
+ * the ones that see it face on (which also smooths out the strip's dither).
+ */
+static Uint32 *globe_build_map(SDL_Surface *strip) {
+    SDL_Surface *src = SDL_ConvertSurfaceFormat(strip, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!src) return NULL;
+
+    Uint32 *map = malloc(sizeof(Uint32) * MAP_W * MAP_H);
+    float *sin_phi = malloc(sizeof(float) * MAP_W * STRIP_FRAMES);
+    float *cos_phi = malloc(sizeof(float) * MAP_W * STRIP_FRAMES);
+    if (!map || !sin_phi || !cos_phi) {
+        free(map);
+        free(sin_phi);
+        free(cos_phi);
+        SDL_FreeSurface(src);
+        return NULL;
+    }
+
+    int frame_w = src->w / STRIP_FRAMES;
+    float radius = src->h / 2.0f - 1.5f; // Stay off the dark anti-aliased rim
+    float cx = frame_w / 2.0f - 0.5f;
+    float cy = src->h / 2.0f - 0.5f;
+
+    // Longitude relative to each frame's view direction
+    for (int col = 0; col < MAP_W; col++) {
+        float lon = (col + 0.5f) / MAP_W * 2.0f * PI;
+        for (int k = 0; k < STRIP_FRAMES; k++) {
+            float phi = lon - k * 2.0f * PI / STRIP_FRAMES;
+            sin_phi[col * STRIP_FRAMES + k] = sinf(phi);
+            cos_phi[col * STRIP_FRAMES + k] = cosf(phi);
+        }
+    }
+
+    SDL_LockSurface(src);
+    for (int row = 0; row < MAP_H; row++) {
+        float lat = PI / 2.0f - (row + 0.5f) / MAP_H * PI;
+        if (lat > MAP_MAX_LAT) lat = MAP_MAX_LAT;
+        if (lat < -MAP_MAX_LAT) lat = -MAP_MAX_LAT;
+        float cos_lat = cosf(lat);
+        int sy = (int)(cy - radius * sinf(lat) + 0.5f);
+        const Uint32 *src_row = (const Uint32 *)((const Uint8 *)src->pixels + sy * src->pitch);
+
+        for (int col = 0; col < MAP_W; col++) {
+            float r = 0.0f, g = 0.0f, b = 0.0f, wsum = 0.0f;
+            for (int k = 0; k < STRIP_FRAMES; k++) {
+                float facing = cos_lat * cos_phi[col * STRIP_FRAMES + k];
+                if (facing <= 0.0f) continue;
+                int sx = (int)(cx + radius * cos_lat * sin_phi[col * STRIP_FRAMES + k] + 0.5f);
+                Uint32 p = src_row[k * frame_w + sx];
+                float w = facing * facing * facing * facing;
+                r += ((p >> 16) & 0xFF) * w;
+                g += ((p >> 8) & 0xFF) * w;
+                b += (p & 0xFF) * w;
+                wsum += w;
+            }
+            if (wsum > 0.0f) {
+                r /= wsum;
+                g /= wsum;
+                b /= wsum;
+            }
+            map[row * MAP_W + col] = 0xFF000000u | ((Uint32)r << 16) | ((Uint32)g << 8) | (Uint32)b;
+        }
+    }
+    SDL_UnlockSurface(src);
+    SDL_FreeSurface(src);
+    free(sin_phi);
+    free(cos_phi);
+    return map;
+}
+
+/**
+ * Halve the map while the halved copy still has at least one texel per pixel
+ * at the centre of a globe `size` pixels wide, where a pixel steps
+ * map_w / (PI * size) columns. Point sampling the full 1024 px map
+ * for a small globe crawls as it spins; the box-filtered level does not, and
+ * keeps the shading loop's gathers in cache. Returns the map to use, freeing
+ * `map` if it was replaced, and its size in *map_w and *map_h.
+ */
+static Uint32 *globe_map_level(Uint32 *map, int size, int *map_w, int *map_h) {
+    *map_w = MAP_W;
+    *map_h = MAP_H;
+    if (MAP_W / 2 < PI * size) return map;
+
+    SDL_Surface *level = SDL_CreateRGBSurfaceWithFormatFrom(map, MAP_W, MAP_H, 32, MAP_W * sizeof(Uint32),
+                                                            SDL_PIXELFORMAT_ARGB8888);
+    int owned = 0;
+    while (level && level->w / 2 >= PI * size && level->h > 1) {
+        SDL_Surface *next = mip_downsample(level);
+        if (!next) break;
+        if (owned) SDL_FreeSurface(level);
+        level = next;
+        owned = 1;
+    }
+    if (!level || !owned) {
+        if (level) SDL_FreeSurface(level);
+        return map;
+    }
+
+    Uint32 *out = malloc(sizeof(Uint32) * level->w * level->h);
+    if (out) {
+        for (int y = 0; y < level->h; y++) {
+            memcpy(out + (size_t)y * level->w, (const Uint8 *)level->pixels + y * level->pitch,
+                   sizeof(Uint32) * level->w);
+        }
+        *map_w = level->w;
+        *map_h = level->h;
+        free(map);
+    }
+    SDL_FreeSurface(level);
+    return out ? out : map;
+}
+
+static void globe_lut_destroy(GlobeLut *lut) {
+    free(lut->arena);
+    SDL_memset(lut, 0, sizeof(*lut));
+}
+
+/**
+ * Precompute map coordinates, lighting and edge coverage for every pixel of
+ * a globe `size` pixels across, sampling a map_w x map_h map. Lit from the
+ * upper left, like the strip.
+ */
+static int globe_lut_create(GlobeLut *lut, int size, int map_w, int map_h) {
+    SDL_memset(lut, 0, sizeof(*lut));
+    lut->size = size;
+    lut->map_w = map_w;
+    lut->map_h = map_h;
+    lut->stride = simd_round_up(size);
+
+    size_t cells = (size_t)lut->stride * size;
+    lut->arena = calloc(1, cells * (sizeof(float) + sizeof(int) * 2 + sizeof(Uint32)) +
+                           (size_t)size * 2 * sizeof(int));
+    if (!lut->arena) return -1;
+    lut->u = lut->arena;
+    lut->row = (int *)(lut->u + cells);
+    lut->light = lut->row + cells;
+    lut->alpha = (Uint32 *)(lut->light + cells);
+    lut->span_start = (int *)(lut->alpha + cells);
+    lut->span_end = lut->span_start + size;
+
+    const float lx = -0.45f, ly = -0.35f, lz = 0.82f; // Normalized light direction
+    float radius = size / 2.0f;
+
+    for (int y = 0; y < size; y++) {
+        int first = size, last = -1;
+        for (int x = 0; x < size; x++) {
+            size_t i = (size_t)y * lut->stride + x;
+            float dx = (x + 0.5f - radius) / radius;
+            float dy = (y + 0.5f - radius) / radius;
+            float d2 = dx * dx + dy * dy;
+
+            // Coverage of a one-pixel wide rim
+            float coverage = (1.0f - sqrtf(d2)) * radius + 0.5f;
+            if (coverage <= 0.0f) continue;
+            if (coverage > 1.0f) coverage = 1.0f;
+            if (d2 > 1.0f) {
+                float d = sqrtf(d2); // Rim pixel just outside: shade it as the edge
+                dx /= d;
+                dy /= d;
+                d2 = 1.0f;
+            }
+
+            float nz = sqrtf(1.0f - d2);
+            float lat = asinf(-dy);
+            float lon = atan2f(dx, nz);
+            float u = lon / (2.0f * PI) * map_w;
+            if (u < 0.0f) u += map_w;
+            int row = (int)((PI / 2.0f - lat) / PI * map_h);
+            if (row > map_h - 1) row = map_h - 1;
+
+            float diffuse = dx * lx + dy * ly + nz * lz;
+            if (diffuse < 0.0f) diffuse = 0.0f;
+            float light = 0.30f + 0.80f * diffuse;
+            if (light > 1.0f) light = 1.0f;
+
+            lut->u[i] = u;
+            lut->row[i] = row * map_w;
+            lut->light[i] = (int)(light * 256.0f);
+            lut->alpha[i] = (Uint32)(coverage * 255.0f + 0.5f) << 24;
+            if (x < first) first = x;
+            last = x;
+        }
+        lut->span_start[y] = first & ~(SIMD_WIDTH - 1);
+        lut->span_end[y] = last < 0 ? lut->span_start[y] : simd_round_up(last + 1);
+    }
+    return 0;
+}
+
+/**
+ * Shade one globe at `turn` (0..1) into a locked pixel buffer. Pixels outside
+ * the disc are written transparent.
+ */
+static void globe_render(const GlobeLut *lut, const Uint32 *map, float turn, Uint32 *pixels, int pitch) {
+    f32x4 offset = simd_splat((turn - floorf(turn)) * lut->map_w);
+    const i32x4 wrap = {lut->map_w - 1, lut->map_w - 1, lut->map_w - 1, lut->map_w - 1};
+    const i32x4 mask8 = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    for (int y = 0; y < lut->size; y++) {
+        Uint32 *out = (Uint32 *)((Uint8 *)pixels + (size_t)y * pitch);
+        int start = lut->span_start[y];
+        int end = SDL_min(lut->span_end[y], lut->size & ~(SIMD_WIDTH - 1));
+
+        SDL_memset(out, 0, sizeof(Uint32) * start);
+        int x = start;
+        for (; x < end; x += SIMD_WIDTH) {
+            size_t i = (size_t)y * lut->stride + x;
+            f32x4 u = simd_load(lut->u + i) + offset;
+            i32x4 row, light;
+            memcpy(&row, lut->row + i, sizeof(row));
+            memcpy(&light, lut->light + i, sizeof(light));
+            i32x4 idx = (__builtin_convertvector(u, i32x4) & wrap) + row;
+
+            i32x4 texel = {(int)map[idx[0]], (int)map[idx[1]], (int)map[idx[2]], (int)map[idx[3]]};
+            i32x4 r = ((((texel >> 16) & mask8) * light) >> 8) << 16;
+            i32x4 g = ((((texel >> 8) & mask8) * light) >> 8) << 8;
+            i32x4 b = ((texel & mask8) * light) >> 8;
+            u32x4 alpha;
+            memcpy(&alpha, lut->alpha + i, sizeof(alpha));
+            u32x4 pixel = (u32x4)(r | g | b) | alpha;
+            memcpy(out + x, &pixel, sizeof(pixel));
+        }
 
-SDL_Texture *globe_tex;
+        // Odd diameters leave a few columns past the last full vector
+        for (; x < lut->size; x++) {
+            size_t i = (size_t)y * lut->stride + x;
+            if (!lut->alpha[i]) {
+                out[x] = 0;
+                continue;
+            }
+            int col = ((int)(lut->u[i] + offset[0])) & (lut->map_w - 1);
+            Uint32 t = map[lut->row[i] + col];
+            int l = lut->light[i];
+            out[x] = lut->alpha[i] | (((((t >> 16) & 0xFF) * l) >> 8) << 16) |
+                     (((((t >> 8) & 0xFF) * l) >> 8) << 8) | (((t & 0xFF) * l) >> 8);
+        }
+    }
+}
 
 int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int power_saving = 1;
+    int idle_minutes = 5;
+    int allow_blank = 0;
+    int globe_size = DEFAULT_SIZE;
+    int globe_count = 1;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:r:n:p:i:b:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -43,6 +321,25 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'r':
+                globe_size = atoi(optarg);
+                if (globe_size < 16) globe_size = 16;
+                break;
+            case 'n':
+                globe_count = atoi(optarg);
+                if (globe_count < 1) globe_count = 1;
+                if (globe_count > MAX_GLOBES) globe_count = MAX_GLOBES;
+                break;
+            case 'p':
+                power_saving = atoi(optarg);
+                break;
+            case 'i':
+                idle_minutes = atoi(optarg);
+                if (idle_minutes < 1) idle_minutes = 1;
+                break;
+            case 'b':
+                allow_blank = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -109,19 +406,72 @@ int main(int argc, char *argv[]) {
         SDL_Quit();
         return 1;
     }
-    globe_tex = SDL_CreateTextureFromSurface(renderer, surf);
+    Uint32 *map = globe_build_map(surf);
     SDL_FreeSurface(surf);
 
+    // Globes must fit on screen to bounce
+    if (globe_size > SDL_min(W, H)) globe_size = SDL_min(W, H);
+
+    int map_w = MAP_W, map_h = MAP_H;
+    if (map) map = globe_map_level(map, globe_size, &map_w, &map_h);
+
+    GlobeLut lut;
+    if (!map || globe_lut_create(&lut, globe_size, map_w, map_h) != 0) {
+        SDL_Log("Error building globe lookup tables: out of memory");
+        free(map);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
+    }
+
     // Initialize globe physics
-    float x = 100, y = 100, vx = 200, vy = 150;
-    int ball_size = 240;
+    Globe globes[MAX_GLOBES];
+    for (int i = 0; i < globe_count; i++) {
+        Globe *g = &globes[i];
+        g->x = (float)(rand() % SDL_max(1, W - globe_size));
+        g->y = (float)(rand() % SDL_max(1, H - globe_size));
+        g->vx = (rand() % 2 ? 200.0f : -200.0f) * (0.8f + 0.4f * rand() / RAND_MAX);
+        g->vy = (rand() % 2 ? 150.0f : -150.0f) * (0.8f + 0.4f * rand() / RAND_MAX);
+        g->phase = (float)i / globe_count;
+        g->tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                   globe_size, globe_size);
+        if (!g->tex) {
+            SDL_Log("Error creating globe texture: %s", SDL_GetError());
+            for (int j = 0; j < i; j++) SDL_DestroyTexture(globes[j].tex);
+            globe_lut_destroy(&lut);
+            free(map);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        SDL_SetTextureBlendMode(g->tex, SDL_BLENDMODE_BLEND);
+    }
+    if (globe_count == 1) {
+        globes[0].x = 100;
+        globes[0].y = 100;
+        globes[0].vx = 200;
+        globes[0].vy = 150;
+    }
+
+    Uint64 shade_ticks = 0;
+    Uint32 shade_frames = 0;
 
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
 
+    // A turn every 1.4 s still reads as smooth rotation at 15 fps
+    PowerPolicy power;
+    power_policy_init(&power, 15, power_saving, idle_minutes, allow_blank);
+
     while (!quit) {
+        float dt = power_policy_begin_frame(&power);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 SDL_Log("Screensaver quit triggered: event type %d", e.type);
@@ -136,45 +486,68 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (power_policy_is_blank(&power)) {
+            if (!power.blank_presented) {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                SDL_RenderPresent(renderer);
+                power.blank_presented = 1;
+            }
+            power_policy_wait(&power);
+            continue;
+        }
+
         Uint32 current_time = SDL_GetTicks();
         float time_s = (current_time - start_time) / 1000.0f;
 
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
         SDL_RenderClear(renderer);
 
-        // Update physics
-        const float dt = 0.016f;
-        x += vx * dt * speed_mult;
-        y += vy * dt * speed_mult;
-
-        // Wall collisions
-        if (x < 0) { x = 0; vx = -vx; }
-        else if (x > W - ball_size) { x = W - ball_size; vx = -vx; }
-        if (y < 0) { y = 0; vy = -vy; }
-        else if (y > H - ball_size) { y = H - ball_size; vy = -vy; }
+        // Update physics (time based, the frame rate varies with the power policy)
+        float turn = time_s * speed_mult / SPIN_TIME;
+        for (int i = 0; i < globe_count; i++) {
+            Globe *g = &globes[i];
+            g->x += g->vx * dt * speed_mult;
+            g->y += g->vy * dt * speed_mult;
 
-        // Globe spin animation using toaster sprite code logic
-        const float total_spin_time = 1.4f; // Match CSS spin duration
-        float local_turn = fmod(time_s, total_spin_time);
-        float turn_phase = local_turn / total_spin_time;
-        int flap_frame = (int)(turn_phase * 21) % 21; // 21 frames
-        // Clamp
-        if (flap_frame < 0) flap_frame = 0;
-        if (flap_frame > 20) flap_frame = 20;
-
-        // Render spinning globe
-        SDL_Rect src_rect = {flap_frame * 240, 0, 240, 240};
-        SDL_Rect dst_rect = {(int)x, (int)y, 240, 240};
-        SDL_RenderCopy(renderer, globe_tex, &src_rect, &dst_rect);
+            // Wall collisions
+            if (g->x < 0) { g->x = 0; g->vx = -g->vx; }
+            else if (g->x > W - globe_size) { g->x = W - globe_size; g->vx = -g->vx; }
+            if (g->y < 0) { g->y = 0; g->vy = -g->vy; }
+            else if (g->y > H - globe_size) { g->y = H - globe_size; g->vy = -g->vy; }
 
+            // Shade the sphere at its current rotation straight into the texture
+            void *pixels;
+            int pitch;
+            Uint64 t0 = SDL_GetPerformanceCounter();
+            if (SDL_LockTexture(g->tex, NULL, &pixels, &pitch) == 0) {
+                globe_render(&lut, map, turn + g->phase, pixels, pitch);
+                SDL_UnlockTexture(g->tex);
+            }
+            shade_ticks += SDL_GetPerformanceCounter() - t0;
 
+            SDL_Rect dst_rect = {(int)g->x, (int)g->y, globe_size, globe_size};
+            SDL_RenderCopy(renderer, g->tex, NULL, &dst_rect);
+        }
+        shade_frames++;
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        power_policy_wait(&power);
+    }
+
+    power_policy_log_summary(&power, "globe");
+    if (shade_frames > 0) {
+        SDL_Log("globe: %d x %d px from a %dx%d map, shading %.2f ms/frame",
+                globe_count, globe_size, map_w, map_h,
+                shade_ticks * 1000.0 / SDL_GetPerformanceFrequency() / shade_frames);
     }
 
     // Cleanup
-    SDL_DestroyTexture(globe_tex);
+    for (int i = 0; i < globe_count; i++) {
+        SDL_DestroyTexture(globes[i].tex);
+    }
+    globe_lut_destroy(&lut);
+    free(map);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
@@ -3,8 +3,11 @@
 #include <stdint.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/simd.h"
+#include "common/thread_pool.h"
 
 #define PI 3.14159f
 
@@ -13,51 +16,364 @@
 #define SPRITE_SIZE 145
 #define FISH_FRAME_COUNT 4  // not used
 
+#define HARDRAIN_MODE_RINGS 0
+#define HARDRAIN_MODE_WATER 1
+
+// Rings mode: every ripple grows from RING_MIN_RADIUS to RING_MAX_RADIUS
+// over RING_GROW_SECONDS, then starts again
+#define RING_DEFAULT_RIPPLES 10
+#define RING_MAX_RIPPLES 20000
+#define RING_MIN_RADIUS 10.0f
+#define RING_MAX_RADIUS 100.0f
+#define RING_GROW_SECONDS 5.0f
+#define RING_THICKNESS 1.0f
+#define RING_LODS 4                     // 16, 32, 64 and 128 segments
+#define RING_MIN_SEGMENTS 16
+#define RING_MAX_ERROR 0.25f            // Pixels between a chord and the true circle
+
+// Water mode: a damped wave equation on a heightfield one cell per
+// WATER_DEFAULT_CELL screen pixels, shaded into a streaming texture that is
+// stretched over the screen. Interior rows are padded by WATER_PAD cells
+// each side so four-wide loads of the left and right neighbours never need
+// an edge case.
+#define WATER_DEFAULT_CELL 4
+#define WATER_DEFAULT_DROPS 60          // Per second at -s 1
+#define WATER_MAX_DROPS 2000
+#define WATER_PAD SIMD_WIDTH
+#define WATER_DAMPING (63.0f / 64.0f)
+#define WATER_STEP (1.0f / 60.0f)
+#define WATER_MAX_STEPS 4
+#define WATER_DROP_DEPTH 160.0f
+#define WATER_REFRACTION (1.0f / 24.0f) // Floor offset in cells per unit of slope
+#define WATER_SHINE 0.6f                // Brightness per unit of slope
+#define WATER_TILE 24                   // Floor tile size in cells
+
 extern char *optarg;
 
-void drawCircleOutline(SDL_Renderer *renderer, int centerX, int centerY, int radius, SDL_Color color) {
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-    int inner_radius = radius - 1; // 1 pixel thick ring
-    for (int y = centerY - radius; y <= centerY + radius; y++) {
-        int dy = y - centerY;
-        int dy_squared = dy * dy;
-        int dx_outer_squared = radius * radius - dy_squared;
-        if (dx_outer_squared > 0) {
-            int dx_outer = (int)sqrtf(dx_outer_squared);
-            int dx_inner = (inner_radius > 0 && dy_squared < inner_radius * inner_radius) ? (int)sqrtf(inner_radius * inner_radius - dy_squared) : 0;
-            SDL_RenderDrawLine(renderer, centerX - dx_outer, y, centerX - dx_inner, y);
-            SDL_RenderDrawLine(renderer, centerX + dx_inner, y, centerX + dx_outer, y);
+typedef struct {
+    int w, h;                           // Interior cells; w is a multiple of SIMD_WIDTH
+    int stride;                         // Floats per row, borders included
+    float *cur, *prev;                  // (h + 2) rows each, zero border all round
+    Uint32 *out;                        // Locked texture rows while shading
+    int out_pitch;                      // Pixels per locked row
+    void *arena;
+} Water;
+
+static inline float *water_row(const Water *water, float *buf, int y) {
+    return buf + (size_t)(y + 1) * water->stride + WATER_PAD;
+}
+
+static void water_destroy(Water *water) {
+    free(water->arena);
+    SDL_memset(water, 0, sizeof(*water));
+}
+
+static int water_init(Water *water, int W, int H, int cell) {
+    SDL_memset(water, 0, sizeof(*water));
+    water->w = simd_round_up((W + cell - 1) / cell);
+    water->h = (H + cell - 1) / cell;
+    water->stride = water->w + 2 * WATER_PAD;
+
+    size_t heights = (size_t)water->stride * (water->h + 2);
+    float *p = calloc(heights * 2, sizeof(float));
+    if (!p) return -1;
+    water->arena = p;
+    water->cur = p;
+    water->prev = p + heights;
+    return 0;
+}
+
+/**
+ * A raindrop: push a small dimple into the surface
+ */
+static void water_drop(Water *water, float cx, float cy, float radius) {
+    int r = (int)ceilf(radius);
+    for (int y = (int)cy - r; y <= (int)cy + r; y++) {
+        if (y < 0 || y >= water->h) continue;
+        float *row = water_row(water, water->cur, y);
+        for (int x = (int)cx - r; x <= (int)cx + r; x++) {
+            if (x < 0 || x >= water->w) continue;
+            float d2 = ((x - cx) * (x - cx) + (y - cy) * (y - cy)) / (radius * radius);
+            if (d2 < 1.0f) row[x] -= WATER_DROP_DEPTH * (1.0f - d2);
+        }
+    }
+}
+
+/**
+ * One wave step for rows [begin, end): next = average of the four
+ * neighbours * 2 - previous, damped. The result overwrites `prev`, which
+ * only this row's cell reads, so bands can run on any thread.
+ */
+static void water_step_rows(void *user, int begin, int end) {
+    Water *water = user;
+    const f32x4 half = simd_splat(0.5f);
+    const f32x4 damping = simd_splat(WATER_DAMPING);
+    for (int y = begin; y < end; y++) {
+        const float *c = water_row(water, water->cur, y);
+        const float *up = c - water->stride;
+        const float *down = c + water->stride;
+        float *p = water_row(water, water->prev, y);
+        for (int x = 0; x < water->w; x += SIMD_WIDTH) {
+            f32x4 sum = simd_load(c + x - 1) + simd_load(c + x + 1) + simd_load(up + x) + simd_load(down + x);
+            simd_store(p + x, (sum * half - simd_load(p + x)) * damping);
         }
     }
 }
 
+/**
+ * Shade rows [begin, end): the pool floor is seen through the surface slope
+ * (refraction) and the slope facing the light brightens it. The floor is a
+ * dark blue-green gradient with faint tile grout, worked out per pixel
+ * rather than looked up, since a four-lane gather costs more than the maths.
+ */
+static void water_shade_rows(void *user, int begin, int end) {
+    Water *water = user;
+    const f32x4 refraction = simd_splat(WATER_REFRACTION);
+    const f32x4 shine = simd_splat(WATER_SHINE);
+    const f32x4 lane = {0, 1, 2, 3};
+    const f32x4 inv_tile = simd_splat(1.0f / WATER_TILE);
+    const float inv_h = 1.0f / water->h;
+    const i32x4 alpha = {(int)0xFF000000u, (int)0xFF000000u, (int)0xFF000000u, (int)0xFF000000u};
+
+    for (int y = begin; y < end; y++) {
+        const float *c = water_row(water, water->cur, y);
+        const float *up = c - water->stride;
+        const float *down = c + water->stride;
+        Uint32 *out = water->out + (size_t)y * water->out_pitch;
+        const f32x4 fy = simd_splat((float)y);
+
+        for (int x = 0; x < water->w; x += SIMD_WIDTH) {
+            f32x4 dx = simd_load(c + x + 1) - simd_load(c + x - 1);
+            f32x4 dy = simd_load(down + x) - simd_load(up + x);
+
+            // Where this pixel's ray meets the floor
+            f32x4 sx = simd_splat((float)x) + lane + dx * refraction;
+            f32x4 sy = fy + dy * refraction;
+
+            // Grout: 1 on a tile edge, fading to 0 a cell away
+            f32x4 tx = sx * inv_tile;
+            f32x4 ty = sy * inv_tile;
+            tx = simd_abs(tx - simd_floor(tx + 0.5f)) * (float)WATER_TILE;
+            ty = simd_abs(ty - simd_floor(ty + 0.5f)) * (float)WATER_TILE;
+            f32x4 grout = simd_max(simd_splat(0.0f), 1.0f - simd_min(tx, ty));
+            f32x4 depth = simd_clamp(sy * inv_h, 0.0f, 1.0f);
+
+            // Light from the top left: slopes facing it brighten, the others darken
+            f32x4 light = (dx + dy) * -shine;
+            f32x4 r = 8.0f + 10.0f * depth + 18.0f * grout + light;
+            f32x4 g = 40.0f + 50.0f * depth + 30.0f * grout + light;
+            f32x4 b = 70.0f + 60.0f * depth + 36.0f * grout + light;
+            i32x4 ir = __builtin_convertvector(simd_clamp(r, 0.0f, 255.0f), i32x4);
+            i32x4 ig = __builtin_convertvector(simd_clamp(g, 0.0f, 255.0f), i32x4);
+            i32x4 ib = __builtin_convertvector(simd_clamp(b, 0.0f, 255.0f), i32x4);
+            i32x4 argb = alpha | (ir << 16) | (ig << 8) | ib;
+            memcpy(out + x, &argb, sizeof(argb));
+        }
+    }
+}
+
+/**
+ * Shade the surface straight into a locked streaming texture of w x h
+ */
+static void water_shade(Water *water, ThreadPool *pool, SDL_Texture *texture) {
+    void *pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0) return;
+    water->out = pixels;
+    water->out_pitch = pitch / (int)sizeof(Uint32);
+    thread_pool_run(pool, water_shade_rows, water, water->h, 8);
+    SDL_UnlockTexture(texture);
+}
+
+static void water_step(Water *water, ThreadPool *pool) {
+    thread_pool_run(pool, water_step_rows, water, water->h, 8);
+    float *t = water->cur;
+    water->cur = water->prev;
+    water->prev = t;
+}
+
+/**
+ * Ring outlines as triangles, all drawn with one SDL_RenderGeometry call.
+ * Unit circles at a few levels of detail are computed once; each ring
+ * picks the coarsest one whose chords stay within RING_MAX_ERROR of the
+ * true circle at its radius, then scales and translates it.
+ */
+typedef struct {
+    int segments[RING_LODS];
+    float max_radius[RING_LODS];        // Largest radius each LOD draws cleanly
+    float *cos_table[RING_LODS];
+    float *sin_table[RING_LODS];
+    int *pattern[RING_LODS];            // Two triangles per segment, from vertex 0
+
+    SDL_Vertex *vertices;
+    int *indices;
+    int vertex_count, vertex_capacity;
+    int index_count, index_capacity;
+
+    // Statistics for the exit summary
+    Uint32 frames;
+    Uint32 draw_calls;
+    Uint32 rings;
+} RingBatch;
+
+static void ring_batch_destroy(RingBatch *b) {
+    for (int l = 0; l < RING_LODS; l++) {
+        free(b->cos_table[l]);
+        free(b->sin_table[l]);
+        free(b->pattern[l]);
+    }
+    free(b->vertices);
+    free(b->indices);
+    SDL_memset(b, 0, sizeof(*b));
+}
+
+static int ring_batch_init(RingBatch *b) {
+    SDL_memset(b, 0, sizeof(*b));
+    for (int l = 0; l < RING_LODS; l++) {
+        int n = RING_MIN_SEGMENTS << l;
+        b->segments[l] = n;
+        b->max_radius[l] = RING_MAX_ERROR / (1.0f - cosf(PI / n));
+        b->cos_table[l] = malloc(sizeof(float) * n);
+        b->sin_table[l] = malloc(sizeof(float) * n);
+        b->pattern[l] = malloc(sizeof(int) * 6 * n);
+        if (!b->cos_table[l] || !b->sin_table[l] || !b->pattern[l]) {
+            ring_batch_destroy(b);
+            return -1;
+        }
+
+        // Vertex 2k is on the outer edge at angle k, 2k + 1 on the inner edge
+        for (int k = 0; k < n; k++) {
+            b->cos_table[l][k] = cosf(2.0f * PI * k / n);
+            b->sin_table[l][k] = sinf(2.0f * PI * k / n);
+            int next = (k + 1) % n;
+            int *idx = &b->pattern[l][k * 6];
+            idx[0] = 2 * k;
+            idx[1] = 2 * next;
+            idx[2] = 2 * k + 1;
+            idx[3] = 2 * k + 1;
+            idx[4] = 2 * next;
+            idx[5] = 2 * next + 1;
+        }
+    }
+    return 0;
+}
+
+static int ring_batch_reserve(RingBatch *b, int vertices, int indices) {
+    if (vertices > b->vertex_capacity) {
+        int capacity = SDL_max(vertices, b->vertex_capacity * 2);
+        SDL_Vertex *v = realloc(b->vertices, sizeof(SDL_Vertex) * (size_t)capacity);
+        if (!v) return -1;
+        b->vertices = v;
+        b->vertex_capacity = capacity;
+    }
+    if (indices > b->index_capacity) {
+        int capacity = SDL_max(indices, b->index_capacity * 2);
+        int *idx = realloc(b->indices, sizeof(int) * (size_t)capacity);
+        if (!idx) return -1;
+        b->indices = idx;
+        b->index_capacity = capacity;
+    }
+    return 0;
+}
+
+/**
+ * Queue a ring of outer radius `radius`, RING_THICKNESS pixels wide
+ */
+static void ring_batch_add(RingBatch *b, float cx, float cy, float radius, SDL_Color color) {
+    int l = 0;
+    while (l < RING_LODS - 1 && radius > b->max_radius[l]) l++;
+    int n = b->segments[l];
+    if (ring_batch_reserve(b, b->vertex_count + 2 * n, b->index_count + 6 * n) != 0) return;
+
+    float inner = SDL_max(radius - RING_THICKNESS, 0.0f);
+    const float *cs = b->cos_table[l];
+    const float *sn = b->sin_table[l];
+    SDL_Vertex *v = &b->vertices[b->vertex_count];
+    for (int k = 0; k < n; k++) {
+        v[2 * k].position = (SDL_FPoint){cx + cs[k] * radius, cy + sn[k] * radius};
+        v[2 * k + 1].position = (SDL_FPoint){cx + cs[k] * inner, cy + sn[k] * inner};
+        v[2 * k].color = v[2 * k + 1].color = color;
+        v[2 * k].tex_coord = v[2 * k + 1].tex_coord = (SDL_FPoint){0, 0};
+    }
+
+    const int *pattern = b->pattern[l];
+    int *idx = &b->indices[b->index_count];
+    for (int i = 0; i < 6 * n; i++) {
+        idx[i] = pattern[i] + b->vertex_count;
+    }
+    b->vertex_count += 2 * n;
+    b->index_count += 6 * n;
+    b->rings++;
+}
+
+static void ring_batch_flush(RingBatch *b, SDL_Renderer *renderer) {
+    if (b->index_count > 0) {
+        SDL_RenderGeometry(renderer, NULL, b->vertices, b->vertex_count, b->indices, b->index_count);
+        b->draw_calls++;
+    }
+    b->vertex_count = 0;
+    b->index_count = 0;
+    b->frames++;
+}
+
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
-    fprintf(stderr, "  -t N    Number of toasters (default: all)\n");
-    fprintf(stderr, "  -m N    Number of toast pieces (default: all)\n");
+    fprintf(stderr, "  -m MODE rings or water (default: rings)\n");
+    fprintf(stderr, "  -c N    Rings: number of ripples (default: %d, max %d)\n", RING_DEFAULT_RIPPLES, RING_MAX_RIPPLES);
+    fprintf(stderr, "  -r N    Water: screen pixels per heightfield cell (default: %d)\n", WATER_DEFAULT_CELL);
+    fprintf(stderr, "  -n N    Water: raindrops per second (default: %d, max %d)\n", WATER_DEFAULT_DROPS, WATER_MAX_DROPS);
+    fprintf(stderr, "  -j N    Water: simulation threads (default: one per core)\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
-struct Pos {
-    float top_pct, left_pct;
-};
-
-typedef struct Entity {
-    int anim_type;
-    int pos_index;
-    int toast_type;
-} Entity;
+typedef struct {
+    float x, y;                         // Screen pixels
+    float delay;                        // Seconds before the first ring
+} Ripple;
 
 int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int mode = HARDRAIN_MODE_RINGS;
+    int ripple_count = RING_DEFAULT_RIPPLES;
+    int cell = WATER_DEFAULT_CELL;
+    int drop_rate = WATER_DEFAULT_DROPS;
+    int threads = 0;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "m:c:r:n:j:s:f:h")) != -1) {
         switch (opt) {
+            case 'm':
+                if (strcmp(optarg, "water") == 0) {
+                    mode = HARDRAIN_MODE_WATER;
+                } else if (strcmp(optarg, "rings") == 0) {
+                    mode = HARDRAIN_MODE_RINGS;
+                } else {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'c':
+                ripple_count = atoi(optarg);
+                if (ripple_count < 1) ripple_count = 1;
+                if (ripple_count > RING_MAX_RIPPLES) ripple_count = RING_MAX_RIPPLES;
+                break;
+            case 'r':
+                cell = atoi(optarg);
+                if (cell < 1) cell = 1;
+                if (cell > 16) cell = 16;
+                break;
+            case 'n':
+                drop_rate = atoi(optarg);
+                if (drop_rate < 0) drop_rate = 0;
+                if (drop_rate > WATER_MAX_DROPS) drop_rate = WATER_MAX_DROPS;
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
             case 's':
                 speed_mult = atof(optarg);
                 if (speed_mult <= 0.1f) speed_mult = 0.1f;
@@ -113,9 +429,6 @@ int main(int argc, char *argv[]) {
     int W, H;
     SDL_GetRendererOutputSize(renderer, &W, &H);
 
-    struct Pos poses[10];
-    Entity entities[10];
-
     SDL_Color rain_colors[8] = {
         {0x00, 0x00, 0x6e, 255}, // dkblue
         {0xc8, 0xd3, 0x54, 255}, // lime
@@ -127,15 +440,57 @@ int main(int argc, char *argv[]) {
         {0x39, 0x71, 0x32, 255}  // green
     };
 
-    for(int i=0; i<10; i++) {
-        poses[i] = (struct Pos){rand() % 100, rand() % 100};
-        entities[i] = (Entity){i * 0.5f, i, rand() % 8}; // Staggered start times
+    Ripple *ripples = NULL;
+    RingBatch rings = {0};
+    if (mode == HARDRAIN_MODE_RINGS) {
+        ripples = malloc(sizeof(Ripple) * ripple_count);
+        if (!ripples || ring_batch_init(&rings) != 0) {
+            SDL_Log("Error allocating %d ripples", ripple_count);
+            free(ripples);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        for (int i = 0; i < ripple_count; i++) {
+            ripples[i].x = (float)rand() / RAND_MAX * W;
+            ripples[i].y = (float)rand() / RAND_MAX * H;
+            ripples[i].delay = fmodf(i * 0.5f, RING_GROW_SECONDS); // Staggered start times
+        }
     }
 
+    Water water = {0};
+    ThreadPool pool = {0};
+    SDL_Texture *water_tex = NULL;
+    if (mode == HARDRAIN_MODE_WATER) {
+        if (water_init(&water, W, H, cell) == 0) {
+            water_tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                          water.w, water.h);
+        }
+        if (!water_tex) {
+            SDL_Log("Error creating water surface: %s", SDL_GetError());
+            water_destroy(&water);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        SDL_SetTextureScaleMode(water_tex, SDL_ScaleModeLinear);
+        thread_pool_init(&pool, threads);
+    }
+    SDL_Rect water_dst = {0, 0, water.w * cell, water.h * cell};
+    float step_credit = 0.0f;
+    float drop_credit = 0.0f;
+    Uint64 step_ticks = 0, shade_ticks = 0;
+    Uint32 steps = 0, shade_frames = 0;
+
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    Uint32 last_ticks = start_time;
 
     while (!quit) {
         while (SDL_PollEvent(&e)) {
@@ -152,37 +507,61 @@ int main(int argc, char *argv[]) {
 
         Uint32 current_time = SDL_GetTicks();
         float time_s = (current_time - start_time) / 1000.0f;
+        float dt = (current_time - last_ticks) / 1000.0f;
+        last_ticks = current_time;
 
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
         SDL_RenderClear(renderer);
 
-        // Render rain drops as growing outline circles
-        for (size_t i = 0; i < 10; i++) {
-            const Entity ent = entities[i];
-            const struct Pos pos = poses[ent.pos_index];
-
-            float x = pos.left_pct * W / 100.0f;
-            float y = pos.top_pct * H / 100.0f;
-
-            int ix = (int)x;
-            int iy = (int)y;
+        if (mode == HARDRAIN_MODE_WATER) {
+            // Drops land at a steady rate; their size is in screen pixels so
+            // the look does not change with the heightfield resolution
+            drop_credit += drop_rate * speed_mult * dt;
+            while (drop_credit >= 1.0f) {
+                float radius = (4.0f + rand() % 8) / cell;
+                water_drop(&water, (float)(rand() % water.w), (float)(rand() % water.h), SDL_max(radius, 1.5f));
+                drop_credit -= 1.0f;
+            }
 
-            // Animate radius (grow only from small to large)
-            float fly_duration = 5.0f; // 5 second grow
-            float local_time = time_s - ent.anim_type;
-            if (local_time < 0) continue;
-            local_time = fmodf(local_time, fly_duration);
-            float factor = local_time / fly_duration;
-            int radius = 10 + (int)(90.0f * factor);
+            Uint64 t0 = SDL_GetPerformanceCounter();
+            step_credit += dt * speed_mult;
+            if (step_credit > WATER_STEP * WATER_MAX_STEPS) step_credit = WATER_STEP * WATER_MAX_STEPS;
+            int stepped = 0;
+            while (step_credit >= WATER_STEP) {
+                water_step(&water, &pool);
+                step_credit -= WATER_STEP;
+                stepped++;
+            }
+            Uint64 t1 = SDL_GetPerformanceCounter();
+            water_shade(&water, &pool, water_tex);
+            step_ticks += t1 - t0;
+            steps += stepped;
+            shade_ticks += SDL_GetPerformanceCounter() - t1;
+            shade_frames++;
+
+            SDL_RenderCopy(renderer, water_tex, NULL, &water_dst);
+        }
 
-            // Draw outline circle with cycling RGB colors
+        // Render rain drops as growing outline circles
+        if (mode == HARDRAIN_MODE_RINGS) {
             uint32_t time_mod = (uint32_t)(time_s * 10); // Slower color cycling
-            SDL_Color color = {(time_mod + (uint32_t)i * 30) % 256, (time_mod + (uint32_t)i * 60) % 256, (time_mod + (uint32_t)i * 90) % 256, 255};
-            drawCircleOutline(renderer, ix, iy, radius, color);
+            for (int i = 0; i < ripple_count; i++) {
+                const Ripple *rp = &ripples[i];
+
+                // Animate radius (grow only from small to large)
+                float local_time = time_s - rp->delay;
+                if (local_time < 0) continue;
+                local_time = fmodf(local_time, RING_GROW_SECONDS);
+                float radius = RING_MIN_RADIUS + (RING_MAX_RADIUS - RING_MIN_RADIUS) * local_time / RING_GROW_SECONDS;
+                if (rp->x + radius < 0 || rp->x - radius > W || rp->y + radius < 0 || rp->y - radius > H) continue;
+
+                // Cycling RGB colors
+                SDL_Color color = {(time_mod + (uint32_t)i * 30) % 256, (time_mod + (uint32_t)i * 60) % 256, (time_mod + (uint32_t)i * 90) % 256, 255};
+                ring_batch_add(&rings, rp->x, rp->y, radius, color);
+            }
+            ring_batch_flush(&rings, renderer);
         }
 
-
-
         SDL_RenderPresent(renderer);
         SDL_Delay(16); // ~60fps
     }
@@ -190,6 +569,24 @@ int main(int argc, char *argv[]) {
     // Cleanup - restore cursor visibility
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
+    if (mode == HARDRAIN_MODE_WATER) {
+        double freq = (double)SDL_GetPerformanceFrequency();
+        SDL_Log("hardrain: %dx%d water cells on %d threads, %.2f ms per step, %.2f ms shading per frame",
+                water.w, water.h, thread_pool_threads(&pool),
+                steps ? step_ticks * 1000.0 / freq / steps : 0.0,
+                shade_frames ? shade_ticks * 1000.0 / freq / shade_frames : 0.0);
+        thread_pool_destroy(&pool);
+        SDL_DestroyTexture(water_tex);
+        water_destroy(&water);
+    } else {
+        if (rings.frames > 0) {
+            SDL_Log("hardrain: %.1f ripples in %.2f draw calls per frame",
+                    (float)rings.rings / rings.frames, (float)rings.draw_calls / rings.frames);
+        }
+        ring_batch_destroy(&rings);
+        free(ripples);
+    }
+
     // Cleanup
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
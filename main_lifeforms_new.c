@@ -1,8 +1,11 @@
 #include <SDL.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/power_policy.h"
+#include "common/soft_raster.h"
 
 extern char *optarg;
 
@@ -13,6 +16,10 @@ static void usage(const char *prog) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -p 0|1  Power-aware frame rate (1=on, 0=off) (default: 1)\n");
+    fprintf(stderr, "  -i N    Minutes between frame rate step downs (default: 5)\n");
+    fprintf(stderr, "  -b 0|1  Blank after the slowest useful frame rate (default: 0)\n");
+    fprintf(stderr, "  -R sdl|cpu  Draw with SDL or the tiled CPU rasterizer (default: sdl)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -401,12 +408,123 @@ typedef struct {
 
 const int NUM_CONSTELLATIONS = sizeof(constellations) / sizeof(Constellation);
 
+/**
+ * Untextured triangles for one SDL_RenderGeometry call per frame: twinkling
+ * stars, constellation lines and constellation stars all go in together.
+ * Grows on demand and keeps its size between frames.
+ */
+typedef struct {
+    SDL_Vertex *vertices;
+    int *indices;
+    int vertex_count, vertex_capacity;
+    int index_count, index_capacity;
+} Geometry;
+
+static int geometry_reserve(Geometry *g, int vertices, int indices) {
+    if (g->vertex_count + vertices > g->vertex_capacity) {
+        int capacity = SDL_max(g->vertex_count + vertices, g->vertex_capacity * 2);
+        SDL_Vertex *v = realloc(g->vertices, sizeof(SDL_Vertex) * (size_t)capacity);
+        if (!v) return -1;
+        g->vertices = v;
+        g->vertex_capacity = capacity;
+    }
+    if (g->index_count + indices > g->index_capacity) {
+        int capacity = SDL_max(g->index_count + indices, g->index_capacity * 2);
+        int *idx = realloc(g->indices, sizeof(int) * (size_t)capacity);
+        if (!idx) return -1;
+        g->indices = idx;
+        g->index_capacity = capacity;
+    }
+    return 0;
+}
+
+static void geometry_vertex(Geometry *g, float x, float y, SDL_Color color) {
+    SDL_Vertex *v = &g->vertices[g->vertex_count++];
+    v->position = (SDL_FPoint){x, y};
+    v->color = color;
+    v->tex_coord = (SDL_FPoint){0, 0};
+}
+
+// Two triangles over vertices a, b, c, d in order around the quad
+static void geometry_quad_indices(Geometry *g, int a, int b, int c, int d) {
+    int *idx = &g->indices[g->index_count];
+    idx[0] = a;
+    idx[1] = b;
+    idx[2] = c;
+    idx[3] = a;
+    idx[4] = c;
+    idx[5] = d;
+    g->index_count += 6;
+}
+
+/**
+ * One pixel at (x, y), the geometry equivalent of SDL_RenderDrawPoint
+ */
+static void geometry_point(Geometry *g, float x, float y, SDL_Color color) {
+    if (geometry_reserve(g, 4, 6) != 0) return;
+    int base = g->vertex_count;
+    geometry_vertex(g, x, y, color);
+    geometry_vertex(g, x + 1, y, color);
+    geometry_vertex(g, x + 1, y + 1, color);
+    geometry_vertex(g, x, y + 1, color);
+    geometry_quad_indices(g, base, base + 1, base + 2, base + 3);
+}
+
+/**
+ * An anti-aliased line `width` pixels thick: a solid core strip with a
+ * one-pixel strip either side that fades to transparent
+ */
+static void geometry_line(Geometry *g, float x1, float y1, float x2, float y2, float width, SDL_Color color) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len < 0.01f || geometry_reserve(g, 8, 18) != 0) return;
+
+    float nx = -dy / len;
+    float ny = dx / len;
+    float core = width * 0.5f;
+    float edge = core + 1.0f;
+    SDL_Color clear = {color.r, color.g, color.b, 0};
+
+    // Across the line at each end: outer left, core left, core right, outer right
+    int base = g->vertex_count;
+    const float offsets[4] = {-edge, -core, core, edge};
+    for (int end = 0; end < 2; end++) {
+        float x = end ? x2 : x1;
+        float y = end ? y2 : y1;
+        for (int k = 0; k < 4; k++) {
+            geometry_vertex(g, x + nx * offsets[k], y + ny * offsets[k], (k == 0 || k == 3) ? clear : color);
+        }
+    }
+    for (int k = 0; k < 3; k++) {
+        geometry_quad_indices(g, base + k, base + k + 1, base + 4 + k + 1, base + 4 + k);
+    }
+}
+
+static void geometry_flush(Geometry *g, SDL_Renderer *renderer) {
+    if (g->index_count > 0) {
+        SDL_RenderGeometry(renderer, NULL, g->vertices, g->vertex_count, g->indices, g->index_count);
+    }
+    g->vertex_count = 0;
+    g->index_count = 0;
+}
+
+static void geometry_destroy(Geometry *g) {
+    free(g->vertices);
+    free(g->indices);
+    SDL_memset(g, 0, sizeof(*g));
+}
+
 int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int power_saving = 1;
+    int idle_minutes = 5;
+    int allow_blank = 0;
+    int cpu_raster = 0;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:p:i:b:R:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -416,6 +534,26 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'p':
+                power_saving = atoi(optarg);
+                break;
+            case 'i':
+                idle_minutes = atoi(optarg);
+                if (idle_minutes < 1) idle_minutes = 1;
+                break;
+            case 'b':
+                allow_blank = atoi(optarg);
+                break;
+            case 'R':
+                if (strcmp(optarg, "sdl") == 0) {
+                    cpu_raster = 0;
+                } else if (strcmp(optarg, "cpu") == 0) {
+                    cpu_raster = 1;
+                } else {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -495,17 +633,69 @@ int main(int argc, char *argv[]) {
         galaxy_stars[i].twinkle_phase = rand() % 360; // random start phase
     }
 
+    // The steady stars never change, so draw them once into a texture that
+    // replaces the per-frame clear. With -R cpu the image itself is the
+    // rasterizer's background and everything else becomes its primitives.
+    SDL_Texture *galaxy_tex = NULL;
+    SoftRaster raster = {0};
+    SDL_Surface *galaxy_surf = SDL_CreateRGBSurfaceWithFormat(0, W, H, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (galaxy_surf) {
+        SDL_FillRect(galaxy_surf, NULL, 0xFF000000);
+        for (int i = 0; i < GALAXY_STARS; i++) {
+            if (galaxy_stars[i].is_twinkle) continue;
+            Uint32 b = galaxy_stars[i].brightness;
+            Uint32 *row = (Uint32 *)((Uint8 *)galaxy_surf->pixels + galaxy_stars[i].y * galaxy_surf->pitch);
+            row[galaxy_stars[i].x] = 0xFF000000 | (b << 16) | (b << 8) | b;
+        }
+        if (!cpu_raster) {
+            galaxy_tex = SDL_CreateTextureFromSurface(renderer, galaxy_surf);
+            SDL_FreeSurface(galaxy_surf);
+            galaxy_surf = NULL;
+        }
+    }
+    if (cpu_raster ? !galaxy_surf || soft_raster_init(&raster, renderer, W, H, 0) != 0 : !galaxy_tex) {
+        SDL_Log("Error creating galaxy texture: %s", SDL_GetError());
+        if (galaxy_surf) SDL_FreeSurface(galaxy_surf);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+    if (galaxy_tex) SDL_SetTextureBlendMode(galaxy_tex, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    Geometry geometry = {0};
+
     // Main loop
     SDL_Event e;
     int quit = 0;
 
+    // Constellations form over seconds, 15 fps keeps the lines smooth
+    PowerPolicy power;
+    power_policy_init(&power, 15, power_saving, idle_minutes, allow_blank);
+    Uint32 start_time = SDL_GetTicks();
+    Uint32 frames = 0;
+
     while (!quit) {
+        float dt = power_policy_begin_frame(&power);
+        float frame_scale = dt / 0.016f; // Per-frame factors below were tuned at ~60fps
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 quit = 1;
             }
         }
 
+        if (power_policy_is_blank(&power)) {
+            if (!power.blank_presented) {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                SDL_RenderPresent(renderer);
+                power.blank_presented = 1;
+            }
+            power_policy_wait(&power);
+            continue;
+        }
+
         // Check if current group is all dissolved and advance to next group
         int all_dissolved = 1;
         for (int c = 0; c < 3; c++) {
@@ -623,7 +813,7 @@ int main(int argc, char *argv[]) {
             const Constellation *constellation = &constellations[active_indices[c]];
             const float phase_duration = 3.0f; // seconds per phase
 
-            active_timers[c] += 0.016f * speed_mult;
+            active_timers[c] += dt * speed_mult;
 
             // Phase logic for this constellation
             if (active_phases[c] == PHASE_SCATTER) {
@@ -651,8 +841,9 @@ int main(int argc, char *argv[]) {
                 for (int i = 0; i < active_num_stars[c]; i++) {
                     float t = scatter_progress * speed_mult;
                     if (t > 1) t = 1;
-                    active_stars[c][i].pos.x += (active_stars[c][i].target.x - active_stars[c][i].pos.x) * t * 0.1f;
-                    active_stars[c][i].pos.y += (active_stars[c][i].target.y - active_stars[c][i].pos.y) * t * 0.1f;
+                    float pull = 1.0f - powf(1.0f - t * 0.1f, frame_scale);
+                    active_stars[c][i].pos.x += (active_stars[c][i].target.x - active_stars[c][i].pos.x) * pull;
+                    active_stars[c][i].pos.y += (active_stars[c][i].target.y - active_stars[c][i].pos.y) * pull;
                 }
 
                 if (active_timers[c] >= phase_duration) {
@@ -697,8 +888,8 @@ int main(int argc, char *argv[]) {
                 if (dissolve_progress >= constellation->num_edges * 0.1f) {
                     // Scatter stars when nearly dissolved
                     for (int i = 0; i < active_num_stars[c]; i++) {
-                        active_stars[c][i].pos.x += (rand() % 150 - 75) * dissolve_progress;
-                        active_stars[c][i].pos.y += (rand() % 150 - 75) * dissolve_progress;
+                        active_stars[c][i].pos.x += (rand() % 150 - 75) * dissolve_progress * frame_scale;
+                        active_stars[c][i].pos.y += (rand() % 150 - 75) * dissolve_progress * frame_scale;
                     }
                 }
 
@@ -706,33 +897,37 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        // Rendering - black background
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        // Rendering - the static galaxy doubles as the black background
+        if (cpu_raster) {
+            soft_raster_clear_image(&raster, galaxy_surf->pixels, galaxy_surf->pitch);
+        } else {
+            SDL_RenderCopy(renderer, galaxy_tex, NULL, NULL);
+        }
 
-        // Draw galaxy background stars - high resolution with frequent twinkling
-        for (int i = 0; i < GALAXY_STARS; i++) {
-            int brightness = galaxy_stars[i].brightness;
-            if (galaxy_stars[i].is_twinkle) {
-                // Twinkle effect: modulate brightness with sine wave
-                galaxy_stars[i].twinkle_phase += 0.2f; // faster twinkling
-                float twinkle = sin(galaxy_stars[i].twinkle_phase) * 0.6f + 0.5f; // 0.2-0.8 range
-                brightness = galaxy_stars[i].brightness * (0.4f + twinkle * 0.6f); // vary from 40% to 100%
-                if (brightness > 255) brightness = 255;
-                if (brightness < 0) brightness = 0;
+        // Twinkling galaxy stars - high resolution with frequent twinkling
+        for (int i = 0; i < TWINKLE_STARS; i++) {
+            // Twinkle effect: modulate brightness with sine wave
+            galaxy_stars[i].twinkle_phase += 0.2f * frame_scale; // faster twinkling
+            float twinkle = sin(galaxy_stars[i].twinkle_phase) * 0.6f + 0.5f; // 0.2-0.8 range
+            int brightness = galaxy_stars[i].brightness * (0.4f + twinkle * 0.6f); // vary from 40% to 100%
+            if (brightness > 255) brightness = 255;
+            if (brightness < 0) brightness = 0;
+            SDL_Color color = {brightness, brightness, brightness, 255};
+            if (cpu_raster) {
+                soft_raster_point(&raster, galaxy_stars[i].x, galaxy_stars[i].y, color);
+            } else {
+                geometry_point(&geometry, galaxy_stars[i].x, galaxy_stars[i].y, color);
             }
-            SDL_SetRenderDrawColor(renderer, brightness, brightness, brightness, 255);
-            SDL_RenderDrawPoint(renderer, galaxy_stars[i].x, galaxy_stars[i].y);
         }
 
-        // Draw each constellation
+        // Each constellation
         for (int c = 0; c < 3; c++) {
             const Constellation *constellation = &constellations[active_indices[c]];
             int offset_x = x_offsets[c];
             int offset_y = y_offsets[c];
 
-            // Draw connections
-            SDL_SetRenderDrawColor(renderer, constellation->line_color.r, constellation->line_color.g, constellation->line_color.b, constellation->line_color.a);
+            // Connections, thicker for DNA
+            float width = (active_indices[c] == 4 || active_indices[c] == 29) ? 3.0f : 2.0f; // DNA indices
             for (int i = 0; i < constellation->num_edges; i++) {
                 const Edge *edge = &constellation->edges[i];
                 if (edge->v1 >= active_num_stars[c] || edge->v2 >= active_num_stars[c]) continue;
@@ -742,38 +937,52 @@ int main(int argc, char *argv[]) {
                     Star *s1 = &active_stars[c][edge->v1];
                     Star *s2 = &active_stars[c][edge->v2];
 
-                    int x1 = W/2 + offset_x + (int)s1->pos.x;
-                    int y1 = H/2 + offset_y + (int)s1->pos.y;
-                    int x2 = W/2 + offset_x + (int)(s1->pos.x + (s2->pos.x - s1->pos.x) * line_progress);
-                    int y2 = H/2 + offset_y + (int)(s1->pos.y + (s2->pos.y - s1->pos.y) * line_progress);
-
-                    // Thicker for DNA
-                    if (active_indices[c] == 4 || active_indices[c] == 29) { // DNA indices
-                        for (int thickness = -1; thickness <= 1; thickness++) {
-                            SDL_RenderDrawLine(renderer, x1 + thickness, y1, x2 + thickness, y2);
-                        }
+                    float x1 = W/2 + offset_x + s1->pos.x;
+                    float y1 = H/2 + offset_y + s1->pos.y;
+                    float x2 = W/2 + offset_x + s1->pos.x + (s2->pos.x - s1->pos.x) * line_progress;
+                    float y2 = H/2 + offset_y + s1->pos.y + (s2->pos.y - s1->pos.y) * line_progress;
+                    if (cpu_raster) {
+                        soft_raster_line(&raster, x1, y1, x2, y2, width, constellation->line_color);
                     } else {
-                        SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
-                        SDL_RenderDrawLine(renderer, x1 + 1, y1, x2 + 1, y2);
+                        geometry_line(&geometry, x1, y1, x2, y2, width, constellation->line_color);
                     }
                 }
             }
 
-            // Draw stars - single point to match galaxy background size
-            SDL_SetRenderDrawColor(renderer, constellation->star_color.r, constellation->star_color.g, constellation->star_color.b, constellation->star_color.a);
+            // Stars - single point to match galaxy background size
             for (int i = 0; i < active_num_stars[c]; i++) {
                 if (active_stars[c][i].is_active) {
                     int x = W/2 + offset_x + (int)active_stars[c][i].pos.x;
                     int y = H/2 + offset_y + (int)active_stars[c][i].pos.y;
-                    SDL_RenderDrawPoint(renderer, x, y);
+                    if (cpu_raster) {
+                        soft_raster_point(&raster, x, y, constellation->star_color);
+                    } else {
+                        geometry_point(&geometry, x, y, constellation->star_color);
+                    }
                 }
             }
         }
+        if (cpu_raster) {
+            soft_raster_flush(&raster, renderer);
+        } else {
+            geometry_flush(&geometry, renderer);
+        }
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16);
+        frames++;
+        power_policy_wait(&power);
     }
 
+    Uint32 runtime = SDL_GetTicks() - start_time;
+    SDL_Log("lifeforms: %u frames in %u s (avg %.1f fps)",
+            (unsigned)frames, (unsigned)(runtime / 1000), runtime ? frames * 1000.0f / runtime : 0.0f);
+    power_policy_log_summary(&power, "lifeforms");
+    soft_raster_log_summary(&raster, "lifeforms");
+    geometry_destroy(&geometry);
+    soft_raster_destroy(&raster);
+    if (galaxy_surf) SDL_FreeSurface(galaxy_surf);
+    if (galaxy_tex) SDL_DestroyTexture(galaxy_tex);
+
     // Cleanup
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
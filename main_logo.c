@@ -5,6 +5,7 @@
 #include <time.h>
 #include <unistd.h> // for getopt
 #include "assets/logo.h"
+#include "common/mipmap.h"
 
 extern char *optarg;
 
@@ -100,9 +101,21 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    // The logo shrinks to half width, so keep a half-size level next to the
+    // full one. Frames pick by the more shrunk axis: the other axis (never
+    // below 0.7x) is then mildly magnified instead of the width aliasing.
     int logo_w = surf->w, logo_h = surf->h;
-    SDL_Texture *logo_tex = SDL_CreateTextureFromSurface(renderer, surf);
+    MipTexture logo_mip;
+    int mip_ok = mip_create(&logo_mip, renderer, surf, SDL_min(logo_w, logo_h) / 2) == 0;
     SDL_FreeSurface(surf);
+    if (!mip_ok) {
+        SDL_Log("Error creating logo texture: %s", SDL_GetError());
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
+    }
 
     // Initialize bouncing physics for logo position
     float x = W / 2.0f, y = H / 2.0f, vx = 150.0f, vy = 100.0f;
@@ -171,7 +184,11 @@ int main(int argc, char *argv[]) {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
         SDL_RenderClear(renderer);
 
-        SDL_RenderCopyEx(renderer, logo_tex, NULL, &dst_rect, rotation, &center, SDL_FLIP_NONE);
+        // Nearest level (in octaves, hence the 1/sqrt(2)) rather than the
+        // smallest covering one: the squeeze bottoms out at exactly 0.5x,
+        // which the odd-width half level never quite covers
+        int level = mip_pick_scale(&logo_mip, SDL_min(scaleX, scaleY) * 0.7071f);
+        SDL_RenderCopyEx(renderer, logo_mip.levels[level], NULL, &dst_rect, rotation, &center, SDL_FLIP_NONE);
 
         SDL_RenderPresent(renderer);
         SDL_Delay(16); // ~60fps
@@ -181,7 +198,7 @@ int main(int argc, char *argv[]) {
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
     // Cleanup
-    SDL_DestroyTexture(logo_tex);
+    mip_destroy(&logo_mip);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
@@ -3,6 +3,7 @@
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h> // for getopt
+#include "common/quality_governor.h"
 
 extern char *optarg;
 
@@ -11,10 +12,13 @@ static void usage(const char *prog) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
-#define MAX_STREAMS 200
+#define MAX_STREAMS 400          // Stream pool capacity (headroom for the quality governor)
+#define DEFAULT_ACTIVE_STREAMS 190
+#define MIN_ACTIVE_STREAMS 40
 #define MAX_CHARS_PER_STREAM 35
 #define FONT_SIZE 12
 
@@ -41,8 +45,9 @@ int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int adaptive_quality = 1;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:q:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -52,6 +57,9 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -161,6 +169,12 @@ int main(int argc, char *argv[]) {
         streams[i].brightness[0] = 255;
     }
 
+    // Active stream target is the density knob scaled by the quality governor
+    int stream_target = DEFAULT_ACTIVE_STREAMS;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    governor_register_knob(&gov, "streams", &stream_target, MIN_ACTIVE_STREAMS, MAX_STREAMS - 10);
+
     // Hide cursor during screensaver
     system("hyprctl keyword cursor:invisible true &>/dev/null");
 
@@ -171,6 +185,8 @@ int main(int argc, char *argv[]) {
     Uint32 start_time = SDL_GetTicks();
 
     while (!quit) {
+        governor_begin_frame(&gov);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 quit = 1;
@@ -198,8 +214,9 @@ int main(int argc, char *argv[]) {
             if (streams[i].active) active_count++;
         }
 
-        // Maintain maximum streams for blanket coverage
-        while (active_count < MAX_STREAMS - 10) {  // Keep 190+ active streams
+        // Maintain the governed stream count for blanket coverage; surplus
+        // streams are not respawned, so density drops without popping
+        while (active_count < stream_target) {
             for (int i = 0; i < MAX_STREAMS; i++) {
                 if (!streams[i].active) {
                     streams[i].column_x = rand() % (W + 100);  // Overshoot screen edges
@@ -279,9 +296,11 @@ int main(int argc, char *argv[]) {
         }
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        governor_end_frame(&gov); // ~60fps
     }
 
+    governor_log_summary(&gov, "matrix");
+
     // Cleanup - restore cursor visibility
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
@@ -7,9 +7,242 @@
 #include <unistd.h> // for getopt
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include "common/quote_fetcher.h"
 
 extern char *optarg;
 
+// Streaming mode (-i): input lines become a ticker of short segments, each
+// rasterised only while it is on screen
+#define STREAM_SEGMENT_BYTES 128        // Keeps every texture far below max width
+#define STREAM_SEGMENTS 1024            // Queued segments; reading pauses when full
+#define STREAM_LINE_BYTES 4096          // Longer lines are cut into several segments
+#define STREAM_READ_BUDGET 65536        // Bytes read per frame at most
+#define STREAM_GAP 80                   // Pixels between lines
+#define STREAM_TAIL_BYTES 4096          // A regular file starts this far from its end
+#define STREAM_MAX_CATCH_UP 4.0f        // Fastest scroll, as a multiple of normal, with a backlog
+#define TEXT_CACHE_SLOTS 64
+
+typedef struct {
+    char text[STREAM_SEGMENT_BYTES + 1];
+    double x;                           // Ticker position of the left edge
+    int w;
+    Uint32 id;
+} Segment;
+
+typedef struct {
+    int fd;
+    int regular;                        // A file to follow, not a pipe
+    char line[STREAM_LINE_BYTES + 1];
+    int line_len;
+
+    Segment segments[STREAM_SEGMENTS];  // Ring, oldest at `first`
+    int first, count;
+    Uint32 next_id;
+    double scroll;                      // Ticker position of the screen's left edge
+
+    Uint32 lines, dropped_bytes;
+} TextStream;
+
+typedef struct {
+    Uint32 id;                          // Segment id, 0 = free
+    SDL_Texture *texture;
+    int w, h;
+    Uint32 last_used;
+} TextCacheSlot;
+
+typedef struct {
+    TextCacheSlot slots[TEXT_CACHE_SLOTS];
+    Uint32 frame;
+    Uint32 hits, misses;
+} TextCache;
+
+/**
+ * Open `path` (or stdin for "-") for non-blocking reads. A regular file is
+ * followed like tail -f, starting near its end.
+ */
+static int text_stream_open(TextStream *s, const char *path) {
+    SDL_memset(s, 0, sizeof(*s));
+    s->next_id = 1;
+    s->fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY | O_NONBLOCK);
+    if (s->fd < 0) return -1;
+    fcntl(s->fd, F_SETFL, fcntl(s->fd, F_GETFL) | O_NONBLOCK);
+
+    struct stat st;
+    if (fstat(s->fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        s->regular = 1;
+        if (st.st_size > STREAM_TAIL_BYTES) {
+            lseek(s->fd, st.st_size - STREAM_TAIL_BYTES, SEEK_SET);
+            s->line_len = -1;           // Skip the partial first line
+        }
+    }
+    return 0;
+}
+
+/**
+ * Queue `len` bytes of a line as one segment placed after the last one, or
+ * at the right edge of the screen if the ticker has run dry. A full ring
+ * drops the text instead of overwriting queued segments.
+ */
+static void text_stream_push(TextStream *s, TTF_Font *font, int screen_w, const char *text, int len, int line_end) {
+    if (s->count >= STREAM_SEGMENTS) {
+        s->dropped_bytes += len;
+        return;
+    }
+    Segment *seg = &s->segments[(s->first + s->count) % STREAM_SEGMENTS];
+    memcpy(seg->text, text, len);
+    seg->text[len] = '\0';
+    seg->id = s->next_id++;
+    if (s->next_id == 0) s->next_id = 1;
+    if (TTF_SizeUTF8(font, seg->text, &seg->w, NULL) != 0) seg->w = 0;
+
+    double start = s->scroll + screen_w;
+    if (s->count > 0) {
+        const Segment *last = &s->segments[(s->first + s->count - 1) % STREAM_SEGMENTS];
+        double after = last->x + last->w;
+        if (after > start) start = after;
+    }
+    seg->x = start;
+    if (line_end) seg->w += STREAM_GAP;  // The gap rides along as blank width
+    s->count++;
+}
+
+/**
+ * Cut a finished line into segments, at UTF-8 character boundaries. A lead
+ * byte is at most three bytes back; input with none there (binary or
+ * invalid UTF-8) is cut at the full segment length.
+ */
+static void text_stream_line(TextStream *s, TTF_Font *font, int screen_w) {
+    const char *p = s->line;
+    int left = s->line_len;
+    while (left > 0 && (p[left - 1] == '\r' || p[left - 1] == ' ' || p[left - 1] == '\t')) left--;
+    if (left == 0) return;
+    s->lines++;
+    while (left > 0) {
+        int n = left < STREAM_SEGMENT_BYTES ? left : STREAM_SEGMENT_BYTES;
+        if (n < left) {
+            int cut = n;
+            while (cut > n - 3 && ((unsigned char)p[cut] & 0xC0) == 0x80) cut--;
+            if (((unsigned char)p[cut] & 0xC0) != 0x80) n = cut;
+        }
+        text_stream_push(s, font, screen_w, p, n, n == left);
+        p += n;
+        left -= n;
+    }
+}
+
+/**
+ * Read whatever input is ready, without waiting. Reading pauses while the
+ * segment queue is nearly full, so a fast writer is held back by its pipe
+ * (or simply read later, for a file) and memory stays bounded.
+ */
+static void text_stream_poll(TextStream *s, TTF_Font *font, int screen_w) {
+    if (s->fd < 0) return;
+    char buf[4096];
+    int budget = STREAM_READ_BUDGET;
+    int line_segments = STREAM_LINE_BYTES / (STREAM_SEGMENT_BYTES - 3) + 1; // Cuts back up to 3 bytes
+
+    for (;;) {
+        // n bytes complete at most n / 2 lines ("x\n") plus the one already
+        // in progress, so never read more than the queue can take
+        int room = (STREAM_SEGMENTS - s->count - line_segments) * 2;
+        int want = SDL_min(SDL_min(room, budget), (int)sizeof(buf));
+        if (want <= 0) return;
+        ssize_t got = read(s->fd, buf, want);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) {
+            // Nothing new; a followed file that shrank was rotated or truncated
+            struct stat st;
+            if (s->regular && fstat(s->fd, &st) == 0 && lseek(s->fd, 0, SEEK_CUR) > st.st_size) {
+                lseek(s->fd, 0, SEEK_SET);
+                s->line_len = 0;
+            }
+            return;
+        }
+        budget -= (int)got;
+
+        for (ssize_t i = 0; i < got; i++) {
+            char c = buf[i];
+            if (c == '\n') {
+                if (s->line_len > 0) text_stream_line(s, font, screen_w);
+                s->line_len = 0;
+            } else if (s->line_len < 0) {
+                continue;               // Still skipping a partial line
+            } else if (s->line_len < STREAM_LINE_BYTES) {
+                s->line[s->line_len++] = c == '\t' ? ' ' : c;
+            } else {
+                s->dropped_bytes++;
+            }
+        }
+    }
+}
+
+/**
+ * Move the ticker on and forget segments that have left the screen. Speeds
+ * up while more than a screen of text is waiting so a busy log catches up.
+ */
+static void text_stream_scroll(TextStream *s, float pixels, int screen_w) {
+    if (s->count > 0) {
+        const Segment *last = &s->segments[(s->first + s->count - 1) % STREAM_SEGMENTS];
+        double backlog = last->x + last->w - (s->scroll + screen_w);
+        if (backlog > screen_w) pixels *= SDL_min((float)(backlog / screen_w), STREAM_MAX_CATCH_UP);
+    }
+    s->scroll += pixels;
+    while (s->count > 0) {
+        const Segment *seg = &s->segments[s->first];
+        if (seg->x + seg->w > s->scroll) break;
+        s->first = (s->first + 1) % STREAM_SEGMENTS;
+        s->count--;
+    }
+}
+
+static void text_stream_close(TextStream *s) {
+    if (s->fd > STDIN_FILENO) close(s->fd);
+    s->fd = -1;
+}
+
+/**
+ * The texture for a segment, rasterised on first use. When every slot is
+ * taken, the least recently drawn texture is evicted.
+ */
+static TextCacheSlot *text_cache_get(TextCache *c, SDL_Renderer *renderer, TTF_Font *font, const Segment *seg) {
+    TextCacheSlot *victim = &c->slots[0];
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        TextCacheSlot *slot = &c->slots[i];
+        if (slot->id == seg->id) {
+            slot->last_used = c->frame;
+            c->hits++;
+            return slot;
+        }
+        if (slot->id == 0 || (victim->id != 0 && slot->last_used < victim->last_used)) victim = slot;
+    }
+
+    c->misses++;
+    if (victim->texture) SDL_DestroyTexture(victim->texture);
+    SDL_memset(victim, 0, sizeof(*victim));
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface *surface = TTF_RenderUTF8_Blended(font, seg->text, white);
+    if (!surface) return NULL;
+    victim->texture = SDL_CreateTextureFromSurface(renderer, surface);
+    victim->w = surface->w;
+    victim->h = surface->h;
+    SDL_FreeSurface(surface);
+    if (!victim->texture) return NULL;
+    victim->id = seg->id;
+    victim->last_used = c->frame;
+    return victim;
+}
+
+static void text_cache_destroy(TextCache *c) {
+    for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+        if (c->slots[i].texture) SDL_DestroyTexture(c->slots[i].texture);
+    }
+    SDL_memset(c, 0, sizeof(*c));
+}
+
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
@@ -17,6 +250,11 @@ static void usage(const char *prog) {
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
     fprintf(stderr, "  -t STR  Message text (default: 'OUT TO LUNCH')\n");
     fprintf(stderr, "  -r      Random quote from internet (requires curl)\n");
+    fprintf(stderr, "  -u URL  Random quotes from URL instead (JSON or plain text)\n");
+    fprintf(stderr, "  -F PATH Random quotes from the lines of a local file\n");
+    fprintf(stderr, "  -c CMD  Random quotes from the output of a shell command\n");
+    fprintf(stderr, "  -q N    Quotes to fetch ahead (default: 4)\n");
+    fprintf(stderr, "  -i PATH Scroll lines from a file, FIFO or '-' for stdin as they arrive\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -27,8 +265,12 @@ int main(int argc, char *argv[]) {
     char message_text[1024] = "OUT TO LUNCH";
     int random_mode = 0;
     const char *message = message_text;
+    QuoteSourceKind quote_kind = QUOTE_SOURCE_URL;
+    const char *quote_location = QUOTE_DEFAULT_URL;
+    int quote_depth = 4;
+    const char *stream_path = NULL;
 
-    while ((opt = getopt(argc, argv, "s:f:t:rh")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:t:ru:F:c:q:i:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -39,11 +281,32 @@ int main(int argc, char *argv[]) {
                 do_fullscreen = atoi(optarg);
                 break;
             case 't':
-                strcpy(message_text, optarg);
+                SDL_strlcpy(message_text, optarg, sizeof(message_text));
                 break;
             case 'r':
                 random_mode = 1;
                 break;
+            case 'u':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_URL;
+                quote_location = optarg;
+                break;
+            case 'F':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_FILE;
+                quote_location = optarg;
+                break;
+            case 'c':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_COMMAND;
+                quote_location = optarg;
+                break;
+            case 'q':
+                quote_depth = atoi(optarg);
+                break;
+            case 'i':
+                stream_path = optarg;
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -54,27 +317,6 @@ int main(int argc, char *argv[]) {
     // Removed setenv for style testing
     srand(time(NULL));
 
-    if (random_mode) {
-        FILE *fp = popen("curl -s http://api.quotable.io/random | sed 's/.*\"content\":\"//' | sed 's/\",\"author.*//'", "r");
-        if (fp) {
-            if (fgets(message_text, sizeof(message_text), fp)) {
-                char *newline = strchr(message_text, '\n');
-                if (newline) *newline = '\0';
-                if (strlen(message_text) > 0) {
-                    message = message_text;
-                }
-            }
-            int status = pclose(fp);
-            if (status != 0) {
-                // Command failed, keep default
-                message = message_text;
-            }
-        } else {
-            // popen failed, keep default
-            message = message_text;
-        }
-    }
-
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         SDL_Log("SDL_Init Error: %s", SDL_GetError());
         return 1;
@@ -158,9 +400,9 @@ int main(int argc, char *argv[]) {
         }
 
         SDL_Color white = {255, 255, 255, 255};
-        SDL_Surface *surface = TTF_RenderText_Blended(font, text, white);
+        SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text, white);
         if (!surface) {
-            SDL_Log("TTF_RenderText_Blended Error: %s", TTF_GetError());
+            SDL_Log("TTF_RenderUTF8_Blended Error: %s", TTF_GetError());
             return;
         }
 
@@ -173,10 +415,45 @@ int main(int argc, char *argv[]) {
     // Initial text render
     update_text_texture(message);
 
+    // Quotes arrive in the background. The fetcher starts with a cached or
+    // built-in quote queued, shown right away; if it cannot start, the
+    // default text keeps scrolling.
+    QuoteFetcher *quotes = NULL;
+    if (random_mode) {
+        quotes = quote_fetcher_start(quote_kind, quote_location, quote_depth);
+        if (!quotes) {
+            SDL_Log("Warning: Failed to start quote fetcher: %s", SDL_GetError());
+        } else if (quote_fetcher_poll(quotes, message_text, sizeof(message_text))) {
+            update_text_texture(message_text);
+        }
+    }
+    int shown_cycle = 0;
+
+    // Streaming mode replaces the single message with a ticker of input lines
+    TextStream *stream = NULL;
+    TextCache text_cache = {0};
+    if (stream_path) {
+        stream = malloc(sizeof(TextStream));
+        if (!stream || text_stream_open(stream, stream_path) != 0) {
+            SDL_Log("Error opening %s: %s", stream_path, strerror(errno));
+            free(stream);
+            quote_fetcher_stop(quotes, "messages");
+            SDL_DestroyTexture(text_texture);
+            TTF_CloseFont(font);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            TTF_Quit();
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+    }
+
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    Uint32 last_ticks = start_time;
 
     while (!quit) {
         while (SDL_PollEvent(&e)) {
@@ -187,19 +464,40 @@ int main(int argc, char *argv[]) {
 
         Uint32 current_time = SDL_GetTicks();
         float time_s = (current_time - start_time) / 1000.0f;
+        float dt = (current_time - last_ticks) / 1000.0f;
+        last_ticks = current_time;
+
+        if (stream) {
+            text_stream_poll(stream, font, W);
+            text_stream_scroll(stream, W / 10.0f * speed_mult * dt, W);
+
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // black background
+            SDL_RenderClear(renderer);
 
-        // Update quote every 10 seconds (after each marquee cycle) if random mode
-        if (random_mode && fmodf(time_s, 10.0f) < 0.016f) {
-            FILE *fp = popen("curl -s http://api.quotable.io/random | sed 's/.*\"content\":\"//' | sed 's/\",\"author.*//'", "r");
-            if (fp) {
-                if (fgets(message_text, sizeof(message_text), fp)) {
-                    char *newline = strchr(message_text, '\n');
-                    if (newline) *newline = '\0';
-                    if (strlen(message_text) > 0 && strcmp(message_text, "OUT TO LUNCH") != 0) {
-                        update_text_texture(message_text);
-                    }
-                }
-                pclose(fp);
+            // Only segments overlapping the screen are rasterised and drawn
+            text_cache.frame++;
+            for (int i = 0; i < stream->count; i++) {
+                const Segment *seg = &stream->segments[(stream->first + i) % STREAM_SEGMENTS];
+                double x = seg->x - stream->scroll;
+                if (x >= W) break;
+                TextCacheSlot *slot = text_cache_get(&text_cache, renderer, font, seg);
+                if (!slot) continue;
+                SDL_Rect dst_rect = {(int)x, H / 2 - slot->h / 2, slot->w, slot->h};
+                SDL_RenderCopy(renderer, slot->texture, NULL, &dst_rect);
+            }
+
+            SDL_RenderPresent(renderer);
+            SDL_Delay(16); // ~60fps
+            continue;
+        }
+
+        // Take the next quote once per 10 second marquee cycle, as the old
+        // text leaves the screen
+        int marquee_cycle = (int)(time_s / 10.0f);
+        if (marquee_cycle != shown_cycle) {
+            shown_cycle = marquee_cycle;
+            if (quotes && quote_fetcher_poll(quotes, message_text, sizeof(message_text))) {
+                update_text_texture(message_text);
             }
         }
 
@@ -229,6 +527,15 @@ int main(int argc, char *argv[]) {
         SDL_Delay(16); // ~60fps
     }
 
+    quote_fetcher_stop(quotes, "messages");
+    if (stream) {
+        SDL_Log("messages: %u lines streamed (%u bytes dropped), %u segments rasterised, %u cache hits",
+                stream->lines, stream->dropped_bytes, text_cache.misses, text_cache.hits);
+        text_stream_close(stream);
+        free(stream);
+        text_cache_destroy(&text_cache);
+    }
+
     // Cleanup
     SDL_DestroyTexture(text_texture);
     SDL_DestroyRenderer(renderer);
@@ -7,6 +7,7 @@
 #include <unistd.h> // for getopt
 #include <stdio.h>
 #include <string.h>
+#include "common/quote_fetcher.h"
 
 extern char *optarg;
 
@@ -17,6 +18,10 @@ static void usage(const char *prog) {
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
     fprintf(stderr, "  -t STR  Message text (default: 'OUT TO LUNCH')\n");
     fprintf(stderr, "  -r      Random quote from internet (requires curl)\n");
+    fprintf(stderr, "  -u URL  Random quotes from URL instead (JSON or plain text)\n");
+    fprintf(stderr, "  -F PATH Random quotes from the lines of a local file\n");
+    fprintf(stderr, "  -c CMD  Random quotes from the output of a shell command\n");
+    fprintf(stderr, "  -q N    Quotes to fetch ahead (default: 4)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -27,8 +32,11 @@ int main(int argc, char *argv[]) {
     char message_text[1024] = "OUT TO LUNCH";
     int random_mode = 0;
     const char *message = message_text;
+    QuoteSourceKind quote_kind = QUOTE_SOURCE_URL;
+    const char *quote_location = QUOTE_DEFAULT_URL;
+    int quote_depth = 4;
 
-    while ((opt = getopt(argc, argv, "s:f:t:rh")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:t:ru:F:c:q:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -39,11 +47,29 @@ int main(int argc, char *argv[]) {
                 do_fullscreen = atoi(optarg);
                 break;
             case 't':
-                strcpy(message_text, optarg);
+                SDL_strlcpy(message_text, optarg, sizeof(message_text));
                 break;
             case 'r':
                 random_mode = 1;
                 break;
+            case 'u':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_URL;
+                quote_location = optarg;
+                break;
+            case 'F':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_FILE;
+                quote_location = optarg;
+                break;
+            case 'c':
+                random_mode = 1;
+                quote_kind = QUOTE_SOURCE_COMMAND;
+                quote_location = optarg;
+                break;
+            case 'q':
+                quote_depth = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -54,27 +80,6 @@ int main(int argc, char *argv[]) {
     // Removed setenv for style testing
     srand(time(NULL));
 
-    if (random_mode) {
-        FILE *fp = popen("curl -s http://api.quotable.io/random | sed 's/.*\"content\":\"//' | sed 's/\",\"author.*//'", "r");
-        if (fp) {
-            if (fgets(message_text, sizeof(message_text), fp)) {
-                char *newline = strchr(message_text, '\n');
-                if (newline) *newline = '\0';
-                if (strlen(message_text) > 0) {
-                    message = message_text;
-                }
-            }
-            int status = pclose(fp);
-            if (status != 0) {
-                // Command failed, keep default
-                message = message_text;
-            }
-        } else {
-            // popen failed, keep default
-            message = message_text;
-        }
-    }
-
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         SDL_Log("SDL_Init Error: %s", SDL_GetError());
         return 1;
@@ -158,9 +163,9 @@ int main(int argc, char *argv[]) {
         }
 
         SDL_Color white = {255, 255, 255, 255};
-        SDL_Surface *surface = TTF_RenderText_Blended(font, text, white);
+        SDL_Surface *surface = TTF_RenderUTF8_Blended(font, text, white);
         if (!surface) {
-            SDL_Log("TTF_RenderText_Blended Error: %s", TTF_GetError());
+            SDL_Log("TTF_RenderUTF8_Blended Error: %s", TTF_GetError());
             return;
         }
 
@@ -173,6 +178,20 @@ int main(int argc, char *argv[]) {
     // Initial text render
     update_text_texture(message);
 
+    // Quotes arrive in the background. The fetcher starts with a cached or
+    // built-in quote queued, shown right away; if it cannot start, the
+    // default text keeps scrolling.
+    QuoteFetcher *quotes = NULL;
+    if (random_mode) {
+        quotes = quote_fetcher_start(quote_kind, quote_location, quote_depth);
+        if (!quotes) {
+            SDL_Log("Warning: Failed to start quote fetcher: %s", SDL_GetError());
+        } else if (quote_fetcher_poll(quotes, message_text, sizeof(message_text))) {
+            update_text_texture(message_text);
+        }
+    }
+    int shown_cycle = 0;
+
     // Initialize bouncing physics
     float Y = H / 2.0f, Vy = 200.0f;
 
@@ -191,18 +210,13 @@ int main(int argc, char *argv[]) {
         Uint32 current_time = SDL_GetTicks();
         float time_s = (current_time - start_time) / 1000.0f;
 
-        // Update quote every 10 seconds (after each marquee cycle) if random mode
-        if (random_mode && fmodf(time_s, 10.0f) < 0.016f) {
-            FILE *fp = popen("curl -s http://api.quotable.io/random | sed 's/.*\"content\":\"//' | sed 's/\",\"author.*//'", "r");
-            if (fp) {
-                if (fgets(message_text, sizeof(message_text), fp)) {
-                    char *newline = strchr(message_text, '\n');
-                    if (newline) *newline = '\0';
-                    if (strlen(message_text) > 0 && strcmp(message_text, "OUT TO LUNCH") != 0) {
-                        update_text_texture(message_text);
-                    }
-                }
-                pclose(fp);
+        // Take the next quote once per 10 second marquee cycle, as the old
+        // text leaves the screen
+        int marquee_cycle = (int)(time_s / 10.0f);
+        if (marquee_cycle != shown_cycle) {
+            shown_cycle = marquee_cycle;
+            if (quotes && quote_fetcher_poll(quotes, message_text, sizeof(message_text))) {
+                update_text_texture(message_text);
             }
         }
 
@@ -233,6 +247,8 @@ int main(int argc, char *argv[]) {
         SDL_Delay(16); // ~60fps
     }
 
+    quote_fetcher_stop(quotes, "messages2");
+
     // Cleanup
     SDL_DestroyTexture(text_texture);
     SDL_DestroyRenderer(renderer);
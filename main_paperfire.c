@@ -5,35 +5,31 @@
 #include <stdlib.h>
 #include <unistd.h> // for getopt
 #include <stdbool.h>
+#include "common/particles.h"
+#include "common/quality_governor.h"
 
 extern char *optarg;
 
 #define PI 3.14159f
 #define FIRE_GRID_SIZE 80  // 80x80 fire grid
-#define MAX_PARTICLES 1000
-
-typedef struct {
-    float x, y;
-    float vx, vy;
-    float life;      // 0-1 how much life remaining
-    int type;        // 0=ember, 1=ash, 2=smoke
-    float size;
-    SDL_Color color;
-} Particle;
+#define MAX_PARTICLES 100000
+#define DEFAULT_PARTICLES 1000
+#define MIN_PARTICLES 150
+#define FRAME_TIME 0.016f        // Simulation step at -s 1; per-frame rates below are per step
 
 typedef struct {
     float fire_intensity[FIRE_GRID_SIZE][FIRE_GRID_SIZE];  // 0-1 fire level
     float burn_level[FIRE_GRID_SIZE][FIRE_GRID_SIZE];      // 0-1 burn progress
     float ash_level[FIRE_GRID_SIZE][FIRE_GRID_SIZE];       // 0-1 ash coverage
-    Particle particles[MAX_PARTICLES];
-    int particle_count;
 } FireSystem;
 
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -p N    Embers, ash and smoke particles (default: %d, max %d)\n", DEFAULT_PARTICLES, MAX_PARTICLES);
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -41,9 +37,16 @@ int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int adaptive_quality = 1;
+    int particle_count = DEFAULT_PARTICLES;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "p:s:f:q:h")) != -1) {
         switch (opt) {
+            case 'p':
+                particle_count = atoi(optarg);
+                if (particle_count < MIN_PARTICLES) particle_count = MIN_PARTICLES;
+                if (particle_count > MAX_PARTICLES) particle_count = MAX_PARTICLES;
+                break;
             case 's':
                 speed_mult = atof(optarg);
                 if (speed_mult <= 0.1f) speed_mult = 0.1f;
@@ -52,6 +55,9 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -139,6 +145,30 @@ int main(int argc, char *argv[]) {
     float animation_time = 0;
     const float paper_appear_time = 2.0f;     // Paper fades in
 
+    // Embers, ash and smoke share one pool drawn as soft dots in one call;
+    // twice the -p count leaves headroom for the quality governor
+    ParticlePool particles;
+    SDL_Texture *dot_tex = NULL;
+    if (particle_pool_init(&particles, particle_count * 2, 0) != 0 ||
+        !(dot_tex = particle_dot_texture(renderer, 16))) {
+        SDL_Log("Error creating particle pool: %s", SDL_GetError());
+        particle_pool_destroy(&particles);
+        SDL_DestroyTexture(paper_tex);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
+    }
+    particles.shrink = 1;
+    particle_pool_set_bounds(&particles, -64.0f, -64.0f, W + 64.0f, H + 64.0f);
+
+    // Live particle cap is the density knob scaled by the quality governor
+    int particle_limit = particle_count;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    governor_register_knob(&gov, "particles", &particle_limit, MIN_PARTICLES, particle_count * 2);
+
     // Hide cursor during screensaver
     system("hyprctl keyword cursor:invisible true &>/dev/null");
 
@@ -148,6 +178,8 @@ int main(int argc, char *argv[]) {
     Uint32 start_time = SDL_GetTicks();
 
     while (!quit) {
+        governor_begin_frame(&gov);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 quit = 1;
@@ -160,7 +192,11 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        animation_time += 0.016f * speed_mult;
+        float dt = FRAME_TIME * speed_mult;
+        animation_time += dt;
+
+        // Spawn odds per burning cell per step scale with the particle cap
+        float spawn_rate = 0.015f * particle_limit / DEFAULT_PARTICLES;
 
         // Update fire simulation
         // Spread fire intensity
@@ -196,32 +232,37 @@ int main(int argc, char *argv[]) {
                     fire_sys.burn_level[x][y] += fire_sys.fire_intensity[x][y] * 0.02f * speed_mult;
                     if (fire_sys.burn_level[x][y] > 1.0f) fire_sys.burn_level[x][y] = 1.0f;
 
-                    // Create embers/smoke particles occasionally
-                    if (rand() % 200 < 3 && fire_sys.particle_count < MAX_PARTICLES) {
-                        int idx = fire_sys.particle_count++;
-                        Particle *p = &fire_sys.particles[idx];
-
+                    // Create embers/smoke particles occasionally; velocities and
+                    // rates are per step, converted to per second for the pool
+                    int spawns = (int)spawn_rate + ((rand() % 10000) < (spawn_rate - (int)spawn_rate) * 10000);
+                    for (int s = 0; s < spawns && particles.live < particle_limit; s++) {
                         // Position relative to paper (now fullscreen)
                         float paper_x = x * (paper_width / (float)FIRE_GRID_SIZE);
                         float paper_y = y * (paper_height / (float)FIRE_GRID_SIZE);
 
-                        p->x = paper_x + (rand() % 10 - 5);
-                        p->y = paper_y;
-                        p->vx = (rand() % 40 - 20) / 10.0f;
-                        p->vy = -(rand() % 20 + 10) / 10.0f;  // Upward
-                        p->life = 1.0f;
-                        p->size = 2 + rand() % 3;
-                        p->type = rand() % 3;  // Mix of ember/ash/smoke
-
-                        if (p->type == 0) {  // Ember - glowy red/orange
-                            p->color.r = 255; p->color.g = 100 + rand() % 100; p->color.b = 0; p->color.a = 255;
-                        } else if (p->type == 1) {  // Ash - dark gray
-                            int gray = 50 + rand() % 100;
-                            p->color.r = p->color.g = p->color.b = gray; p->color.a = 200;
-                        } else {  // Smoke - light gray, transparent
-                            int gray = 150 + rand() % 100;
-                            p->color.r = p->color.g = p->color.b = gray; p->color.a = 100;
-                            p->vy = -(rand() % 30 + 5) / 10.0f;  // Gentler rise
+                        int type = rand() % 3;  // Mix of ember/ash/smoke
+                        float vx = (rand() % 40 - 20) / 10.0f;
+                        float vy = type == 2 ? -(rand() % 30 + 5) / 10.0f   // Smoke: gentler rise
+                                             : -(rand() % 20 + 10) / 10.0f; // Upward
+                        int p = particle_spawn(&particles, paper_x + (rand() % 10 - 5), paper_y,
+                                               vx / FRAME_TIME, vy / FRAME_TIME);
+                        if (p < 0) break;
+                        // Soft dots look smaller than the old solid squares, so draw them twice the size
+                        particles.size[p] = (2 + rand() % 3) * 2.0f;
+                        particles.decay[p] = 0.01f / FRAME_TIME;
+
+                        if (type == 0) {  // Ember - glowy red/orange
+                            particles.color[p] = (SDL_Color){255, (Uint8)(100 + rand() % 100), 0, 255};
+                        } else if (type == 1) {  // Ash - dark gray, falls
+                            Uint8 gray = (Uint8)(50 + rand() % 100);
+                            particles.color[p] = (SDL_Color){gray, gray, gray, 200};
+                            particles.ay[p] = 0.1f / (FRAME_TIME * FRAME_TIME);
+                        } else {  // Smoke - light gray, transparent, rises, drifts with the wind, fades slower
+                            Uint8 gray = (Uint8)(150 + rand() % 100);
+                            particles.color[p] = (SDL_Color){gray, gray, gray, 100};
+                            particles.ay[p] = -0.05f / (FRAME_TIME * FRAME_TIME);
+                            particles.ax[p] = sinf(animation_time + p) * 0.2f / (FRAME_TIME * FRAME_TIME);
+                            particles.decay[p] = 0.015f / FRAME_TIME;
                         }
                     }
                 }
@@ -234,37 +275,7 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        // Update particles
-        for (int i = 0; i < fire_sys.particle_count; i++) {
-            Particle *p = &fire_sys.particles[i];
-            if (p->life <= 0) continue;
-
-            p->x += p->vx * speed_mult;
-            p->y += p->vy * speed_mult;
-
-            // Apply gravity/wind
-            if (p->type == 1) {  // Ash falls
-                p->vy += 0.1f * speed_mult;
-            } else if (p->type == 2) {  // Smoke rises
-                p-> vy -= 0.05f * speed_mult;
-                p->vx += (sinf(animation_time + i) * 0.2f) * speed_mult;  // Drift with wind
-            }
-
-            // Fade out
-            p->life -= 0.01f * speed_mult;
-            if (p->type == 2) {  // Smoke fades slower
-                p->life -= 0.005f * speed_mult;
-            }
-        }
-
-        // Remove dead particles
-        int write_idx = 0;
-        for (int read_idx = 0; read_idx < fire_sys.particle_count; read_idx++) {
-            if (fire_sys.particles[read_idx].life > 0) {
-                fire_sys.particles[write_idx++] = fire_sys.particles[read_idx];
-            }
-        }
-        fire_sys.particle_count = write_idx;
+        particle_pool_update(&particles, dt);
 
         // Rendering
         SDL_SetRenderDrawColor(renderer, 20, 20, 20, 255);  // Dark background
@@ -332,24 +343,10 @@ int main(int argc, char *argv[]) {
         SDL_DestroyTexture(burn_tex);
 
         // Render particles
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
-        for (int i = 0; i < fire_sys.particle_count; i++) {
-            Particle *p = &fire_sys.particles[i];
-            if (p->life <= 0) continue;
-
-            int alpha = (int)(p->life * p->color.a);
-            SDL_SetRenderDrawColor(renderer, p->color.r, p->color.g, p->color.b, alpha);
-
-            int size = (int)(p->size * p->life);
-            if (size < 1) size = 1;
-
-            SDL_Rect particle_rect = {(int)p->x - size/2, (int)p->y - size/2, size, size};
-            SDL_RenderFillRect(renderer, &particle_rect);
-        }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        particle_pool_render(&particles, renderer, dot_tex);
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        governor_end_frame(&gov); // ~60fps
 
         // Check if fire has reached the top of the screen - reset when top rows are burning
         bool fire_at_top = false;
@@ -365,16 +362,21 @@ int main(int argc, char *argv[]) {
             animation_time = 0;
             // Reset fire system
             memset(&fire_sys, 0, sizeof(FireSystem));
+            particle_pool_clear(&particles);
             fire_sys.fire_intensity[5][FIRE_GRID_SIZE-5] = 0.8f;
             fire_sys.fire_intensity[FIRE_GRID_SIZE-5][FIRE_GRID_SIZE-5] = 0.8f;
             fire_sys.fire_intensity[FIRE_GRID_SIZE/2][FIRE_GRID_SIZE-5] = 0.6f;
         }
     }
 
+    governor_log_summary(&gov, "paperfire");
+
     // Cleanup - restore cursor visibility
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
     // Cleanup
+    particle_pool_destroy(&particles);
+    SDL_DestroyTexture(dot_tex);
     SDL_DestroyTexture(paper_tex);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
@@ -1,16 +1,169 @@
 #include <SDL.h>
+#include <SDL_image.h>
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h> // for getopt
 #include <math.h>
+#include "assets/rain_tile_distant.h"
+#include "assets/rain_tile_mid.h"
+#include "assets/rain_tile_near.h"
+#include "common/particles.h"
+#include "common/quality_governor.h"
 
 extern char *optarg;
 
+#define RAIN_LAYER_COUNT 3
+#define RAIN_TILE_SLANT 0.2f        // Streaks in the tiles lean 1 px right per 5 px down
+#define RAIN_REFERENCE_HEIGHT 1080.0f
+#define MAX_SPLASH_PARTICLES 6000   // Pool capacity (headroom for the quality governor)
+#define DEFAULT_SPLASH_PARTICLES 1500
+#define MIN_SPLASH_PARTICLES 100
+
+// Rain is three layers of a wrapping streak tile scrolled along the streaks.
+// However heavy the rain, each layer is one draw of the handful of tile
+// quads that cover the screen; intensity only changes their opacity.
+typedef struct {
+    const unsigned char *png;
+    unsigned int len;
+    float scale;                    // Tile size relative to the PNG at 1080p
+    float speed;                    // Fall speed, screen heights per second
+    float shear;                    // Slant added on top of RAIN_TILE_SLANT
+    Uint8 alpha;                    // Opacity at full intensity
+} RainLayerSpec;
+
+static const RainLayerSpec rain_layer_specs[RAIN_LAYER_COUNT] = {
+    {rain_tile_distant, sizeof(rain_tile_distant), 0.5f, 0.45f, 0.00f, 170},
+    {rain_tile_mid, sizeof(rain_tile_mid), 0.75f, 0.8f, 0.03f, 220},
+    {rain_tile_near, sizeof(rain_tile_near), 1.0f, 1.2f, 0.06f, 255},
+};
+
+typedef struct {
+    const RainLayerSpec *spec;
+    SDL_Texture *texture;
+    float tile_w, tile_h;           // Drawn tile size, px
+    float u, v;                     // Scroll offset in unsheared tile space, px
+    SDL_Vertex *vertices;
+    int *indices;
+    int max_quads;
+} RainLayer;
+
+static void rain_layer_destroy(RainLayer *layer) {
+    if (layer->texture) SDL_DestroyTexture(layer->texture);
+    free(layer->vertices);
+    free(layer->indices);
+    SDL_memset(layer, 0, sizeof(*layer));
+}
+
+static int rain_layer_init(RainLayer *layer, SDL_Renderer *renderer, const RainLayerSpec *spec, int W, int H) {
+    SDL_memset(layer, 0, sizeof(*layer));
+    layer->spec = spec;
+
+    SDL_RWops *rw = SDL_RWFromConstMem(spec->png, (int)spec->len);
+    SDL_Surface *surf = rw ? IMG_Load_RW(rw, 1) : NULL;
+    if (!surf) return -1;
+    float tex_w = (float)surf->w, tex_h = (float)surf->h;
+    layer->texture = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    if (!layer->texture) return -1;
+    SDL_SetTextureBlendMode(layer->texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(layer->texture, SDL_ScaleModeLinear);
+
+    // Same look at any resolution: tiles grow with the display
+    layer->tile_h = tex_h * spec->scale * (H / RAIN_REFERENCE_HEIGHT);
+    layer->tile_w = layer->tile_h * tex_w / tex_h;
+    layer->u = (rand() % 1000) * 0.001f * layer->tile_w;
+    layer->v = (rand() % 1000) * 0.001f * layer->tile_h;
+
+    int cols = (int)ceilf((W + fabsf(spec->shear) * H) / layer->tile_w) + 2;
+    int rows = (int)ceilf(H / layer->tile_h) + 2;
+    layer->max_quads = cols * rows;
+    layer->vertices = malloc(sizeof(SDL_Vertex) * 4 * (size_t)layer->max_quads);
+    layer->indices = malloc(sizeof(int) * 6 * (size_t)layer->max_quads);
+    if (!layer->vertices || !layer->indices) {
+        rain_layer_destroy(layer);
+        return -1;
+    }
+    for (int q = 0; q < layer->max_quads; q++) {
+        int *idx = &layer->indices[q * 6];
+        idx[0] = q * 4;
+        idx[1] = q * 4 + 1;
+        idx[2] = q * 4 + 2;
+        idx[3] = q * 4;
+        idx[4] = q * 4 + 2;
+        idx[5] = q * 4 + 3;
+    }
+    return 0;
+}
+
+/**
+ * Scroll along the streaks: down at the layer speed and sideways by the
+ * tiles' own slant (the shear adds the rest when drawn)
+ */
+static void rain_layer_update(RainLayer *layer, float dt, float gust, int H) {
+    float fall = layer->spec->speed * H * gust * dt;
+    layer->v = fmodf(layer->v + fall, layer->tile_h);
+    layer->u = fmodf(layer->u + fall * RAIN_TILE_SLANT, layer->tile_w);
+}
+
+/**
+ * Draw the tile grid covering the screen, sheared so that tile-space
+ * (x, y) lands on screen at (x + shear * y, y), in one call
+ */
+static void rain_layer_draw(RainLayer *layer, SDL_Renderer *renderer, int W, int H, SDL_Color color) {
+    float s = layer->spec->shear;
+    float tw = layer->tile_w, th = layer->tile_h;
+
+    // Tile-space x range that shears onto the screen, snapped to the grid
+    float x_lo = fminf(0.0f, -s * H);
+    float x_hi = W + fmaxf(0.0f, -s * H);
+    float x_start = x_lo - fmodf(fmodf(x_lo - layer->u, tw) + tw, tw);
+    float y_start = -fmodf(fmodf(-layer->v, th) + th, th);
+
+    int quads = 0;
+    for (float y0 = y_start; y0 < H && quads < layer->max_quads; y0 += th) {
+        float y1 = y0 + th;
+        for (float x0 = x_start; x0 < x_hi && quads < layer->max_quads; x0 += tw) {
+            SDL_Vertex *v = &layer->vertices[quads * 4];
+            v[0].position = (SDL_FPoint){x0 + s * y0, y0};
+            v[0].tex_coord = (SDL_FPoint){0, 0};
+            v[1].position = (SDL_FPoint){x0 + tw + s * y0, y0};
+            v[1].tex_coord = (SDL_FPoint){1, 0};
+            v[2].position = (SDL_FPoint){x0 + tw + s * y1, y1};
+            v[2].tex_coord = (SDL_FPoint){1, 1};
+            v[3].position = (SDL_FPoint){x0 + s * y1, y1};
+            v[3].tex_coord = (SDL_FPoint){0, 1};
+            v[0].color = v[1].color = v[2].color = v[3].color = color;
+            quads++;
+        }
+    }
+    SDL_RenderGeometry(renderer, layer->texture, layer->vertices, quads * 4, layer->indices, quads * 6);
+}
+
+/**
+ * A drop hitting the ground: a few droplets flung up that fall back and fade
+ */
+static void rain_splash(ParticlePool *splashes, int limit, float x, float y) {
+    int droplets = 2 + rand() % 3;
+    for (int k = 0; k < droplets && splashes->live < limit; k++) {
+        float vx = (rand() % 160 - 80) * 1.0f;
+        float vy = -(60.0f + rand() % 120);
+        int p = particle_spawn(splashes, x, y, vx, vy);
+        if (p < 0) return;
+        splashes->ay[p] = 900.0f;
+        splashes->decay[p] = 2.5f + (rand() % 100) * 0.02f;
+        splashes->size[p] = 3.0f + rand() % 3;
+        splashes->color[p] = (SDL_Color){200, 210, 255, 200};
+    }
+}
+
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -i F    Rain intensity, 0.1 drizzle to 1 downpour (default: 0.6)\n");
+    fprintf(stderr, "  -p 0|1  Splashes on the ground (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -18,9 +171,20 @@ int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int adaptive_quality = 1;
+    float intensity = 0.6f;
+    int splashes_on = 1;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "i:p:s:f:q:h")) != -1) {
         switch (opt) {
+            case 'i':
+                intensity = atof(optarg);
+                if (intensity < 0.1f) intensity = 0.1f;
+                if (intensity > 1.0f) intensity = 1.0f;
+                break;
+            case 'p':
+                splashes_on = atoi(optarg);
+                break;
             case 's':
                 speed_mult = atof(optarg);
                 if (speed_mult <= 0.1f) speed_mult = 0.1f;
@@ -29,6 +193,9 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -43,9 +210,16 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
+    if (!(IMG_Init(IMG_INIT_PNG))) {
+        SDL_Log("IMG_Init Error: %s", IMG_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
     SDL_Window *window = SDL_CreateWindow("Rainstorm", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 800, 600, SDL_WINDOW_SHOWN);
     if (window == NULL) {
         SDL_Log("SDL_CreateWindow Error: %s", SDL_GetError());
+        IMG_Quit();
         SDL_Quit();
         return 1;
     }
@@ -54,6 +228,7 @@ int main(int argc, char *argv[]) {
     if (renderer == NULL) {
         SDL_Log("SDL_CreateRenderer Error: %s", SDL_GetError());
         SDL_DestroyWindow(window);
+        IMG_Quit();
         SDL_Quit();
         return 1;
     }
@@ -67,18 +242,35 @@ int main(int argc, char *argv[]) {
     int W, H;
     SDL_GetRendererOutputSize(renderer, &W, &H);
 
-    // Rain droplet data - single layer, full screen
-    #define MAX_DROPS 150
-    struct drop {
-        float x, y;
-    };
-    struct drop drops[MAX_DROPS];
-
-    // Initialize drops with extended horizontal coverage for angled rain
-    for (int i = 0; i < MAX_DROPS; i++) {
-        drops[i].x = (rand() % (W + 220)) - 110; // 10% additional coverage beyond borders
-        drops[i].y = (float)(rand() % H);  // Start at random Y for distribution
+    RainLayer layers[RAIN_LAYER_COUNT] = {0};
+    ParticlePool splashes = {0};
+    SDL_Texture *dot_tex = NULL;
+    int ok = particle_pool_init(&splashes, MAX_SPLASH_PARTICLES, 0) == 0 &&
+             (dot_tex = particle_dot_texture(renderer, 8)) != NULL;
+    for (int l = 0; l < RAIN_LAYER_COUNT && ok; l++) {
+        ok = rain_layer_init(&layers[l], renderer, &rain_layer_specs[l], W, H) == 0;
     }
+    if (!ok) {
+        SDL_Log("Error loading embedded rain tiles: %s", SDL_GetError());
+        for (int l = 0; l < RAIN_LAYER_COUNT; l++) rain_layer_destroy(&layers[l]);
+        particle_pool_destroy(&splashes);
+        if (dot_tex) SDL_DestroyTexture(dot_tex);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
+    }
+    SDL_SetTextureBlendMode(dot_tex, SDL_BLENDMODE_BLEND);
+    particle_pool_set_bounds(&splashes, -16.0f, -16.0f, W + 16.0f, H + 16.0f);
+
+    // Live splash droplets are the density knob scaled by the quality
+    // governor; the rain layers cost the same at any intensity
+    int splash_limit = DEFAULT_SPLASH_PARTICLES;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    governor_register_knob(&gov, "splashes", &splash_limit, MIN_SPLASH_PARTICLES, MAX_SPLASH_PARTICLES);
+    float splash_credit = 0;
 
     // Flash timing
     float next_flash_time = 4.0f + (rand() % 4); // 4-7 seconds
@@ -90,8 +282,11 @@ int main(int argc, char *argv[]) {
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    float time_s = 0;
 
     while (!quit) {
+        governor_begin_frame(&gov);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 quit = 1;
@@ -105,7 +300,9 @@ int main(int argc, char *argv[]) {
         }
 
         Uint32 current_time = SDL_GetTicks();
-        float time_s = (current_time - start_time) / 1000.0f;
+        float prev_time_s = time_s;
+        time_s = (current_time - start_time) / 1000.0f;
+        float dt = fminf(time_s - prev_time_s, 0.1f);
 
         // Check for flash trigger
         if (current_flash_remaining <= 0.0f && time_s - last_flash_time >= next_flash_time) {
@@ -114,26 +311,25 @@ int main(int argc, char *argv[]) {
             next_flash_time = 4.0f + (rand() % 5); // Next flash 4-8 seconds from now
         }
 
-        // Update drops - continuous fall with 15 deg slant and variable speed
-        float base_speed = 16.0f;
-        float max_speed = base_speed * 1.5f;
-        float varying_speed = base_speed + (max_speed - base_speed) * 0.5f * (1 + sinf(time_s * 0.5f)); // Oscillate speed
-        varying_speed *= speed_mult;
-
-        for (int i = 0; i < MAX_DROPS; i++) {
-            drops[i].y += varying_speed;  // Variable fall speed
-            drops[i].x += (int)(varying_speed * 0.268f);  // tan(15°) ≈ 0.268 for slant proportional to speed
+        // Layers fall faster and slower in slow gusts
+        float gust = (1.0f + 0.25f * (1 + sinf(time_s * 0.5f))) * speed_mult;
+        for (int l = 0; l < RAIN_LAYER_COUNT; l++) {
+            rain_layer_update(&layers[l], dt, gust, H);
+        }
 
-            // Respawn at top when off bottom with extended coverage
-            if (drops[i].y > H + 20) {
-                drops[i].x = (rand() % (W + 220)) - 110; // 10% additional coverage
-                drops[i].y = -10;
+        // Splashes land in the bottom fifth, more of them in heavier rain
+        if (splashes_on) {
+            splash_credit += intensity * gust * (W / 1920.0f) * 120.0f * dt;
+            while (splash_credit >= 1.0f) {
+                rain_splash(&splashes, splash_limit, (float)(rand() % W), H * (0.8f + (rand() % 200) * 0.001f));
+                splash_credit -= 1.0f;
             }
+            particle_pool_update(&splashes, dt * speed_mult);
         }
 
         // Update flash
         if (current_flash_remaining > 0.0f) {
-            current_flash_remaining -= 0.016f; // Assuming 60fps
+            current_flash_remaining -= dt;
         }
 
         // Render
@@ -144,23 +340,30 @@ int main(int argc, char *argv[]) {
         }
         SDL_RenderClear(renderer);
 
-        // Draw angled rain drops (white lines from top to bottom)
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 180);
-        for (int i = 0; i < MAX_DROPS; i++) {
-            int length = 15;
-            float tan15 = 0.268f; // tan(15°)
-            int dx = (int)(length * tan15);
-            SDL_RenderDrawLine(renderer, (int)drops[i].x, (int)drops[i].y,
-                              (int)drops[i].x + dx, (int)drops[i].y + length);
+        // Far to near, then splashes: four draws whatever the intensity
+        for (int l = 0; l < RAIN_LAYER_COUNT; l++) {
+            Uint8 alpha = (Uint8)(layers[l].spec->alpha * (0.35f + 0.65f * intensity));
+            rain_layer_draw(&layers[l], renderer, W, H, (SDL_Color){255, 255, 255, alpha});
+        }
+        if (splashes_on) {
+            particle_pool_render(&splashes, renderer, dot_tex);
         }
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16); // ~60fps
+        governor_end_frame(&gov); // ~60fps
     }
 
+    governor_log_summary(&gov, "rainstorm");
+
     // Cleanup
+    for (int l = 0; l < RAIN_LAYER_COUNT; l++) {
+        rain_layer_destroy(&layers[l]);
+    }
+    particle_pool_destroy(&splashes);
+    SDL_DestroyTexture(dot_tex);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
+    IMG_Quit();
     SDL_Quit();
     return 0;
 }
@@ -5,8 +5,17 @@
 #include <unistd.h> // for getopt
 #include <stdlib.h>
 #include "assets/omarchy_logo.h"
+#include "common/sprite_batch.h"
 
-#define PI 3.141592653589793f
+#define MAX_SPOTLIGHTS 256
+#define SPOT_RADIUS 200.0f      // One light; more lights share the area
+#define SPOT_MIN_RADIUS 60.0f
+#define SPOT_CORE 0.55f         // Fraction of the radius at full brightness
+#define MASK_SIZE 256           // Falloff texture, scaled to each light
+
+typedef struct {
+    float x, y, vx, vy;
+} Spotlight;
 
 extern char *optarg;
 
@@ -15,15 +24,47 @@ static void usage(const char *prog) {
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -n N    Number of spotlights (default: 1, max: %d)\n", MAX_SPOTLIGHTS);
     fprintf(stderr, "  -h      Show this help\n");
 }
 
+/**
+ * Radial falloff for one light: full brightness over the core, then a
+ * smoothstep down to black at the rim. Stored as intensity in RGB and drawn
+ * additively, so overlapping beams brighten each other.
+ */
+static SDL_Texture *falloff_texture(SDL_Renderer *renderer, int size) {
+    SDL_Surface *surf = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surf) return NULL;
+
+    float c = size / 2.0f;
+    for (int y = 0; y < size; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surf->pixels + y * surf->pitch);
+        for (int x = 0; x < size; x++) {
+            float dx = x + 0.5f - c;
+            float dy = y + 0.5f - c;
+            float t = (1.0f - sqrtf(dx * dx + dy * dy) / c) / (1.0f - SPOT_CORE);
+            t = fminf(fmaxf(t, 0.0f), 1.0f);
+            Uint32 v = (Uint32)(t * t * (3.0f - 2.0f * t) * 255.0f + 0.5f);
+            row[x] = 0xFF000000u | (v << 16) | (v << 8) | v;
+        }
+    }
+
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    if (!tex) return NULL;
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_ADD);
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeLinear);
+    return tex;
+}
+
 int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int spot_count = 1;
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:n:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -33,6 +74,11 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'n':
+                spot_count = atoi(optarg);
+                if (spot_count < 1) spot_count = 1;
+                if (spot_count > MAX_SPOTLIGHTS) spot_count = MAX_SPOTLIGHTS;
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -157,32 +203,44 @@ int main(int argc, char *argv[]) {
     }
     SDL_FreeSurface(screenshot_surf);
 
-    // Spotlight properties
-    float radius = 200.0f;
-
-    // Geometry setup for circular spotlight
-    const int segments = 64; // more segments for smoother circle
-    SDL_Vertex vertices[segments + 1];
-    int indices[segments * 3];
-
-    // Initialize triangle fan indices
-    for (int i = 0; i < segments; i++) {
-        int a = i;
-        int b = (i + 1) % segments;
-        indices[i * 3] = 0;
-        indices[i * 3 + 1] = a + 1;
-        indices[i * 3 + 2] = b + 1;
+    // Lights are drawn from one falloff mask into a screen-sized light map,
+    // all in one batch, and the light map then multiplies the screenshot in
+    // a single full-screen pass, so the cost barely grows with -n
+    SDL_Texture *mask_tex = falloff_texture(renderer, MASK_SIZE);
+    SDL_Texture *light_tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, W, H);
+    SpriteBatch batch;
+    if (!mask_tex || !light_tex || sprite_batch_init(&batch, mask_tex, MASK_SIZE, MASK_SIZE, spot_count) != 0) {
+        SDL_Log("Cannot create spotlight textures: %s", SDL_GetError());
+        if (mask_tex) SDL_DestroyTexture(mask_tex);
+        if (light_tex) SDL_DestroyTexture(light_tex);
+        SDL_DestroyTexture(bg_tex);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
+    SDL_SetTextureBlendMode(light_tex, SDL_BLENDMODE_MOD);
+    const AtlasFrame mask_frame = {0, 0, MASK_SIZE, MASK_SIZE};
+    const SDL_Color white = {255, 255, 255, 255};
 
     // Get texture dimensions
     int tex_width, tex_height;
     SDL_QueryTexture(bg_tex, NULL, NULL, &tex_width, &tex_height);
     SDL_Log("Texture size: width=%d height=%d", tex_width, tex_height);
-    float scale_factor = 1.0f; // stretch to fill for both modes
-    float spotlight_x = W / 2.0f;
-    float spotlight_y = H / 2.0f;
-    float spotlight_vx = (rand() % 400 - 200) * 1.0f;
-    float spotlight_vy = (rand() % 400 - 200) * 1.0f;
+
+    // Spotlight properties: the first starts in the middle, the rest anywhere
+    float radius = SPOT_RADIUS / sqrtf((float)spot_count);
+    if (radius < SPOT_MIN_RADIUS) radius = SPOT_MIN_RADIUS;
+    if (radius > SDL_min(W, H) / 2.0f) radius = SDL_min(W, H) / 2.0f;
+    Spotlight spots[MAX_SPOTLIGHTS];
+    for (int i = 0; i < spot_count; i++) {
+        spots[i].x = i == 0 ? W / 2.0f : radius + (rand() % 10000) * 0.0001f * (W - 2.0f * radius);
+        spots[i].y = i == 0 ? H / 2.0f : radius + (rand() % 10000) * 0.0001f * (H - 2.0f * radius);
+        spots[i].vx = (rand() % 400 - 200) * 1.0f;
+        spots[i].vy = (rand() % 400 - 200) * 1.0f;
+    }
+    SDL_Log("spotlight: %d lights of radius %.0f px", spot_count, radius);
 
     // Main loop
     SDL_Event e;
@@ -204,45 +262,37 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        // Update spotlight movement
+        // Update spotlight movement, bouncing off walls
         float dt = 0.016f;
-        spotlight_x += spotlight_vx * dt * speed_mult;
-        spotlight_y += spotlight_vy * dt * speed_mult;
-
-        // Bounce off walls
-        if (spotlight_x <= radius || spotlight_x >= W - radius) {
-            spotlight_vx = -spotlight_vx;
-            spotlight_x = spotlight_x <= radius ? radius : W - radius;
-        }
-        if (spotlight_y <= radius || spotlight_y >= H - radius) {
-            spotlight_vy = -spotlight_vy;
-            spotlight_y = spotlight_y <= radius ? radius : H - radius;
+        for (int i = 0; i < spot_count; i++) {
+            Spotlight *sp = &spots[i];
+            sp->x += sp->vx * dt * speed_mult;
+            sp->y += sp->vy * dt * speed_mult;
+            if (sp->x <= radius || sp->x >= W - radius) {
+                sp->vx = -sp->vx;
+                sp->x = sp->x <= radius ? radius : W - radius;
+            }
+            if (sp->y <= radius || sp->y >= H - radius) {
+                sp->vy = -sp->vy;
+                sp->y = sp->y <= radius ? radius : H - radius;
+            }
         }
 
-        // Render
+        // Accumulate the light map
+        SDL_SetRenderTarget(renderer, light_tex);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
-
-        // Update geometry vertices for the circular spotlight
-        vertices[0].position.x = spotlight_x;
-        vertices[0].position.y = spotlight_y;
-        vertices[0].tex_coord.x = (spotlight_x / W) * scale_factor;
-        vertices[0].tex_coord.y = (spotlight_y / H) * scale_factor;
-        vertices[0].color = (SDL_Color){255, 255, 255, 255};
-
-        for (int i = 0; i < segments; i++) {
-            float angle = 2.0f * PI * i / segments;
-            float px = spotlight_x + cosf(angle) * radius;
-            float py = spotlight_y + sinf(angle) * radius;
-            vertices[i + 1].position.x = px;
-            vertices[i + 1].position.y = py;
-            vertices[i + 1].tex_coord.x = (px / W) * scale_factor;
-            vertices[i + 1].tex_coord.y = (py / H) * scale_factor;
-            vertices[i + 1].color = (SDL_Color){255, 255, 255, 255};
+        for (int i = 0; i < spot_count; i++) {
+            SDL_FRect dst = {spots[i].x - radius, spots[i].y - radius, 2.0f * radius, 2.0f * radius};
+            sprite_batch_add(&batch, &mask_frame, &dst, 0, white);
         }
+        sprite_batch_flush(&batch, renderer);
+        SDL_SetRenderTarget(renderer, NULL);
 
-        // Render only the circular spotlight area from the background texture
-        SDL_RenderGeometry(renderer, bg_tex, vertices, segments + 1, indices, segments * 3);
+        // Screenshot stretched to fill, darkened everywhere the light is not
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, bg_tex, NULL, NULL);
+        SDL_RenderCopy(renderer, light_tex, NULL, NULL);
 
         SDL_RenderPresent(renderer);
         SDL_Delay(16); // ~60fps
@@ -252,7 +302,12 @@ int main(int argc, char *argv[]) {
     system("(hyprctl dispatch fullscreen > /dev/null 2>&1)");
     SDL_Delay(200); // Allow Hyprland to process fullscreen exit
 
+    sprite_batch_log_summary(&batch, "spotlight");
+
     // Cleanup
+    sprite_batch_destroy(&batch);
+    SDL_DestroyTexture(light_tex);
+    SDL_DestroyTexture(mask_tex);
     if (bg_tex) SDL_DestroyTexture(bg_tex);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
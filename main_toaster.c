@@ -1,26 +1,28 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
-#include "assets/toaster_sprite.h"
-#include "assets/toast0.h"
-#include "assets/toast1.h"
-#include "assets/toast2.h"
-#include "assets/toast3.h"
+#include "assets/toaster_atlas.h"
 #include <math.h>
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/simd.h"
+#include "common/sprite_batch.h"
 extern char *optarg;
 
 #define WINDOW_WIDTH 0  // fullscreen
 #define WINDOW_HEIGHT 0
 #define SPRITE_SIZE 64
 #define TOASTER_FRAME_COUNT 4
+#define FLEET_MAX 100000        // Toasters plus toast
+#define FLEET_DEPTH_LAYERS 4    // Far layers are smaller, slower and dimmer; the classic flight is nearest
+#define FLEET_MIN_SPEED 70.0f   // px/s along each axis for generated flights, times -s
+#define FLEET_MAX_SPEED 160.0f
 
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
-    fprintf(stderr, "  -t N    Number of toasters (default: all)\n");
-    fprintf(stderr, "  -m N    Number of toast pieces (default: all)\n");
+    fprintf(stderr, "  -t N    Number of toasters (default: 30, max %d)\n", FLEET_MAX);
+    fprintf(stderr, "  -m N    Number of toast pieces (default: 10, max %d)\n", FLEET_MAX);
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
@@ -47,6 +49,7 @@ const struct AnimParam anim_params[14] = {
     {16.0, 0.0, 0}, // tst2
     {24.0, 0.0, 0}, // tst3
     {24.0, 12.0, 0}, // tst4
+    {24.0, 12.0, 0}, // wave 5 toast (entities use 13; was left zeroed)
 };
 
 struct Pos {
@@ -150,6 +153,202 @@ const Entity entities[] = {
     {1, 8, 26, -1}, // t9 p26
 };
 
+/**
+ * Every flight in closed form: at time t an entity that started at `delay`
+ * is a fraction frac((t - delay) / period) along a straight line from
+ * (x0, y0) by (dx, dy), so positions and flap frames come from one
+ * branch-free SIMD pass with no per-entity state to advance. Entities are
+ * stored far layer first, toast before toasters within a layer, which is
+ * also the draw order.
+ */
+typedef struct {
+    int count;
+    int padded;                         // count rounded up to SIMD_WIDTH
+    float *x0, *y0;                     // Top-left at the start of a cycle, px
+    float *dx, *dy;                     // Travel per cycle, px
+    float *inv_period;                  // 1 / cycle length, 1/s
+    float *delay;                       // Start time, s (negative = already mid-flight)
+    float *flap;                        // 1 = flap, -1 = flap reversed, 0 = toast (no flap)
+    float *first;                       // First atlas frame of the sprite
+    float *size;                        // px
+    Uint8 *shade;                       // Colour mod for the depth layer
+
+    // Evaluated each frame
+    float *x, *y;
+    int *frame;                         // Atlas frame, -1 = not started or off screen
+    void *arena;
+} Fleet;
+
+typedef struct {
+    float x0, y0, dx, dy, period, delay, size;
+    int flap, sprite, layer, is_toaster;
+} FlightSpec;
+
+static int fleet_alloc(Fleet *f, int count) {
+    SDL_memset(f, 0, sizeof(*f));
+    f->count = count;
+    f->padded = simd_round_up(count > 0 ? count : 1);
+    size_t n = (size_t)f->padded;
+    char *p = calloc(n, sizeof(float) * 11 + sizeof(int) + 1);
+    if (!p) return -1;
+    f->arena = p;
+    float **fields[] = {&f->x0, &f->y0, &f->dx, &f->dy, &f->inv_period, &f->delay,
+                        &f->flap, &f->first, &f->size, &f->x, &f->y};
+    for (size_t k = 0; k < sizeof(fields) / sizeof(fields[0]); k++) {
+        *fields[k] = (float *)p + n * k;
+    }
+    f->frame = (int *)(f->y + n);
+    f->shade = (Uint8 *)(f->frame + n);
+    return 0;
+}
+
+static void fleet_destroy(Fleet *f) {
+    free(f->arena);
+    SDL_memset(f, 0, sizeof(*f));
+}
+
+static float frand(void) {
+    return (rand() % 10000) * 0.0001f;
+}
+
+/**
+ * A random flight in `layer` that crosses the screen diagonally and is
+ * already somewhere along its cycle
+ */
+static FlightSpec fleet_random_flight(int is_toaster, int layer, int W, int H, float speed_mult) {
+    FlightSpec s;
+    float depth = (float)layer / (FLEET_DEPTH_LAYERS - 1); // 0 far .. 1 near
+    s.size = SPRITE_SIZE * (0.45f + 0.55f * depth);
+
+    // Flights move down-left, so x + y is constant along one; pick that line
+    // anywhere it crosses the screen and start just off the top or right edge
+    float k = -s.size + frand() * (W + H + s.size);
+    s.y0 = fmaxf(-s.size, k - W) - frand() * SPRITE_SIZE;
+    s.x0 = k - s.y0;
+    // Cycle ends as it leaves the bottom or left edge, so the wrap back to
+    // the start is never seen and no time is spent flying off screen
+    float travel = fminf(H - s.y0, s.x0 + s.size) + 1.0f;
+    s.dx = -travel;
+    s.dy = travel;
+
+    float speed = (FLEET_MIN_SPEED + frand() * (FLEET_MAX_SPEED - FLEET_MIN_SPEED)) *
+                  (0.5f + 0.5f * depth) * speed_mult;
+    s.period = travel / speed;
+    s.delay = -frand() * s.period;
+    s.layer = layer;
+    s.is_toaster = is_toaster;
+    s.flap = is_toaster ? ((rand() & 1) ? 1 : -1) : 0;
+    s.sprite = is_toaster ? TOASTER_ATLAS_TOASTER : TOASTER_ATLAS_TOAST0 + rand() % 4;
+    return s;
+}
+
+/**
+ * Fill the fleet with the classic flights from entities[] first (nearest
+ * layer), then random flights spread over every layer until the counts are met
+ */
+static int fleet_init(Fleet *f, int toaster_count, int toast_count, int W, int H, float speed_mult) {
+    int count = toaster_count + toast_count;
+    FlightSpec *specs = malloc(sizeof(FlightSpec) * (size_t)(count > 0 ? count : 1));
+    if (!specs || fleet_alloc(f, count) != 0) {
+        free(specs);
+        return -1;
+    }
+
+    int n = 0;
+    int toasters = 0, toasts = 0;
+    size_t entity_count = sizeof(entities) / sizeof(entities[0]);
+    for (size_t i = 0; i < entity_count; i++) {
+        const Entity ent = entities[i];
+        if (ent.is_toaster ? toasters >= toaster_count : toasts >= toast_count) continue;
+        const struct AnimParam ap = anim_params[ent.anim_type];
+        const struct Pos pos = poses[ent.pos_index];
+        FlightSpec *s = &specs[n++];
+        s->x0 = W - (pos.right_pct / 100.0f * W) - SPRITE_SIZE / 2.0f;
+        s->y0 = (pos.top_pct / 100.0f * H) - SPRITE_SIZE / 2.0f;
+        s->dx = -1600.0f * speed_mult;
+        s->dy = 1600.0f * speed_mult;
+        s->period = ap.fly_duration;
+        s->delay = ap.delay;
+        s->size = SPRITE_SIZE;
+        s->flap = ap.flap_direction;
+        s->sprite = ent.is_toaster ? TOASTER_ATLAS_TOASTER : TOASTER_ATLAS_TOAST0 + ent.toast_type;
+        s->layer = FLEET_DEPTH_LAYERS - 1;
+        s->is_toaster = ent.is_toaster;
+        if (ent.is_toaster) toasters++; else toasts++;
+    }
+    for (; toasters < toaster_count; toasters++) {
+        specs[n++] = fleet_random_flight(1, rand() % FLEET_DEPTH_LAYERS, W, H, speed_mult);
+    }
+    for (; toasts < toast_count; toasts++) {
+        specs[n++] = fleet_random_flight(0, rand() % FLEET_DEPTH_LAYERS, W, H, speed_mult);
+    }
+
+    // Lay the flights out in draw order once, so no per-frame sort is needed
+    int out = 0;
+    for (int key = 0; key < FLEET_DEPTH_LAYERS * 2; key++) {
+        for (int i = 0; i < n; i++) {
+            const FlightSpec *s = &specs[i];
+            if (s->layer * 2 + s->is_toaster != key) continue;
+            f->x0[out] = s->x0;
+            f->y0[out] = s->y0;
+            f->dx[out] = s->dx;
+            f->dy[out] = s->dy;
+            f->inv_period[out] = 1.0f / s->period;
+            f->delay[out] = s->delay;
+            f->flap[out] = (float)s->flap;
+            f->first[out] = (float)toaster_atlas_sprites[s->sprite].first;
+            f->size[out] = s->size;
+            f->shade[out] = (Uint8)(255 * (0.55f + 0.45f * s->layer / (FLEET_DEPTH_LAYERS - 1)));
+            out++;
+        }
+    }
+    free(specs);
+
+    // Padding lanes sit left of the screen with no size, so they are always culled
+    for (int i = out; i < f->padded; i++) {
+        f->x0[i] = -1.0f;
+    }
+    return 0;
+}
+
+/**
+ * Evaluate every position and flap frame at time_s and cull what is off screen
+ */
+static void fleet_update(Fleet *f, float time_s, int W, int H) {
+    const f32x4 t = simd_splat(time_s);
+    const f32x4 zero = simd_splat(0.0f);
+    const f32x4 half = simd_splat(0.5f);
+    const f32x4 three = simd_splat(3.0f);
+    const f32x4 right = simd_splat((float)W);
+    const f32x4 bottom = simd_splat((float)H);
+
+    for (int i = 0; i < f->padded; i += SIMD_WIDTH) {
+        f32x4 local = t - simd_load(f->delay + i);
+        f32x4 cycles = local * simd_load(f->inv_period + i);
+        f32x4 fly = cycles - simd_floor(cycles);
+        f32x4 x = simd_load(f->x0 + i) + simd_load(f->dx + i) * fly;
+        f32x4 y = simd_load(f->y0 + i) + simd_load(f->dy + i) * fly;
+        f32x4 size = simd_load(f->size + i);
+        simd_store(f->x + i, x);
+        simd_store(f->y + i, y);
+
+        // 0.4 s flap: frames 0..3 over the first half, back down 3..1 over
+        // the second; reversed flappers run it backwards
+        f32x4 flap_t = local * 2.5f;
+        f32x4 c = flap_t - simd_floor(flap_t);
+        f32x4 up = simd_floor(c * 8.0f);
+        f32x4 down = three - simd_floor((c - half) * 6.0f);
+        f32x4 frame = simd_clamp(simd_select(c < half, up, down), 0.0f, 3.0f);
+        f32x4 flap = simd_load(f->flap + i);
+        frame = simd_select(flap > zero, frame, simd_select(flap < zero, three - frame, zero));
+        frame += simd_load(f->first + i);
+
+        i32x4 hidden = (local < zero) | (x >= right) | (y >= bottom) | (x + size <= zero) | (y + size <= zero);
+        i32x4 frames = __builtin_convertvector(frame, i32x4) | hidden; // hidden lanes are all ones = -1
+        memcpy(f->frame + i, &frames, sizeof(frames));
+    }
+}
+
 int main(int argc, char *argv[]) {
     int opt;
     int toaster_count = 30;
@@ -180,6 +379,11 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    if (toaster_count < 0) toaster_count = 0;
+    if (toaster_count > FLEET_MAX) toaster_count = FLEET_MAX;
+    if (toast_count < 0) toast_count = 0;
+    if (toast_count > FLEET_MAX - toaster_count) toast_count = FLEET_MAX - toaster_count;
+
     setenv("SDL_VIDEODRIVER", "wayland", 1); // Force Wayland for Hyprland
     srand(time(NULL));
 
@@ -220,71 +424,49 @@ int main(int argc, char *argv[]) {
     int W, H;
     SDL_GetRendererOutputSize(renderer, &W, &H);
 
-    // Load textures
-    SDL_Texture *toaster_tex;
-    {
-        SDL_RWops *rw = SDL_RWFromConstMem(toaster_sprite, toaster_sprite_len);
-        if (!rw) {
-            SDL_Log("Error creating RWops for embedded toaster_sprite: %s", SDL_GetError());
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        SDL_Surface *surf = IMG_Load_RW(rw, 1); // 1 to autoclose
-        if (!surf) {
-            SDL_Log("Error loading embedded toaster_sprite: %s", IMG_GetError());
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        toaster_tex = SDL_CreateTextureFromSurface(renderer, surf);
-        SDL_FreeSurface(surf);
+    // Load the sprite atlas: toaster flap frames and all four toasts in one
+    // texture (regenerate with `make atlases`)
+    SDL_RWops *rw = SDL_RWFromConstMem(toaster_atlas, toaster_atlas_len);
+    if (!rw) {
+        SDL_Log("Error creating RWops for embedded toaster atlas: %s", SDL_GetError());
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
-
-    SDL_Texture *toast_texs[4];
-    for (int i = 0; i < 4; i++) {
-        const unsigned char *data = NULL;
-        unsigned int len = 0;
-        switch (i) {
-            case 0: data = toast0; len = toast0_len; break;
-            case 1: data = toast1; len = toast1_len; break;
-            case 2: data = toast2; len = toast2_len; break;
-            case 3: data = toast3; len = toast3_len; break;
-        }
-        SDL_RWops *rw = SDL_RWFromConstMem(data, len);
-        if (!rw) {
-            SDL_Log("Error creating RWops for embedded toast%d: %s", i, SDL_GetError());
-            SDL_DestroyTexture(toaster_tex);
-            for (int j = 0; j < i; j++) SDL_DestroyTexture(toast_texs[j]);
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        SDL_Surface *surf = IMG_Load_RW(rw, 1); // 1 to autoclose
-        if (!surf) {
-            SDL_Log("Error loading embedded toast%d: %s", i, IMG_GetError());
-            SDL_DestroyTexture(toaster_tex);
-            for (int j = 0; j < i; j++) SDL_DestroyTexture(toast_texs[j]);
-            SDL_DestroyRenderer(renderer);
-            SDL_DestroyWindow(window);
-            IMG_Quit();
-            SDL_Quit();
-            return 1;
-        }
-        toast_texs[i] = SDL_CreateTextureFromSurface(renderer, surf);
-        SDL_FreeSurface(surf);
+    SDL_Surface *surf = IMG_Load_RW(rw, 1); // 1 to autoclose
+    if (!surf) {
+        SDL_Log("Error loading embedded toaster atlas: %s", IMG_GetError());
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
+    }
+    SDL_Texture *atlas_tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    SpriteBatch batch = {0};
+    Fleet fleet = {0};
+    if (!atlas_tex ||
+        sprite_batch_init(&batch, atlas_tex, TOASTER_ATLAS_WIDTH, TOASTER_ATLAS_HEIGHT, toaster_count + toast_count) != 0 ||
+        fleet_init(&fleet, toaster_count, toast_count, W, H, speed_mult) != 0) {
+        SDL_Log("Error creating toaster atlas or fleet of %d: %s", toaster_count + toast_count, SDL_GetError());
+        sprite_batch_destroy(&batch);
+        if (atlas_tex) SDL_DestroyTexture(atlas_tex);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        IMG_Quit();
+        SDL_Quit();
+        return 1;
     }
 
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    Uint64 update_ticks = 0;
+    Uint32 update_frames = 0;
 
     while (!quit) {
         while (SDL_PollEvent(&e)) {
@@ -307,102 +489,37 @@ int main(int argc, char *argv[]) {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
 
-        size_t entity_count = sizeof(entities) / sizeof(entities[0]);
-
-        // Render toast first (behind)
-        int drawn_toast = 0;
-        for (size_t i = 0; i < entity_count; i++) {
-            const Entity ent = entities[i];
-            if (ent.is_toaster) continue; // Skip toasters
-            if (drawn_toast >= toast_count) continue; // Limit count
-            const struct AnimParam ap = anim_params[ent.anim_type];
-            const struct Pos pos = poses[ent.pos_index];
-
-            // Calculate start position
-            float start_x = W - (pos.right_pct / 100.0f * W) - SPRITE_SIZE / 2.0f;
-            float start_y = (pos.top_pct / 100.0f * H) - SPRITE_SIZE / 2.0f;
-
-            // Animation timing
-            float local_time = time_s - ap.delay;
-            if (local_time < 0) continue; // not started yet
-
-            float cycle_time = fmodf(local_time, ap.fly_duration);
-            float fly_f = cycle_time / ap.fly_duration;
-
-            float current_x = start_x + (-1600.0f * fly_f * speed_mult);
-            float current_y = start_y + (1600.0f * fly_f * speed_mult);
-
-            SDL_Rect dstrect = {(int)current_x, (int)current_y, SPRITE_SIZE, SPRITE_SIZE};
-
-            // Toast
-            SDL_RenderCopy(renderer, toast_texs[ent.toast_type], NULL, &dstrect);
-            drawn_toast++;
-        }
-
-        // Render toasters second (in front)
-        int drawn_toasters = 0;
-        for (size_t i = 0; i < entity_count; i++) {
-            const Entity ent = entities[i];
-            if (!ent.is_toaster) continue; // Skip toast
-            if (drawn_toasters >= toaster_count) continue; // Limit count
-            const struct AnimParam ap = anim_params[ent.anim_type];
-            const struct Pos pos = poses[ent.pos_index];
-
-            // Calculate start position
-            float start_x = W - (pos.right_pct / 100.0f * W) - SPRITE_SIZE / 2.0f;
-            float start_y = (pos.top_pct / 100.0f * H) - SPRITE_SIZE / 2.0f;
-
-            // Animation timing
-            float local_time = time_s - ap.delay;
-            if (local_time < 0) continue; // not started yet
-
-            float cycle_time = fmodf(local_time, ap.fly_duration);
-            float fly_f = cycle_time / ap.fly_duration;
-
-            float current_x = start_x + (-1600.0f * fly_f * speed_mult);
-            float current_y = start_y + (1600.0f * fly_f * speed_mult);
-
-            SDL_Rect dstrect = {(int)current_x, (int)current_y, SPRITE_SIZE, SPRITE_SIZE};
-
-            // Calculate flap frame
-            float flap_cycle = fmodf(local_time, 0.4f);
-            int flap_frame = 0;
-            if (ap.flap_direction == 1) {
-                // alternate: 0->1->2->3->2->1->0
-                if (flap_cycle < 0.2f) {
-                    flap_frame = (int)(flap_cycle / 0.2f * 4);
-                } else {
-                    flap_frame = 3 - (int)((flap_cycle - 0.2f) / 0.2f * 3);
-                }
-            } else if (ap.flap_direction == -1) {
-                // alternate-reverse: 3->2->1->0->1->2
-                if (flap_cycle < 0.2f) {
-                    flap_frame = 3 - (int)(flap_cycle / 0.2f * 4);
-                } else {
-                    flap_frame = (int)((flap_cycle - 0.2f) / 0.2f * 3);
-                }
-            }
-            // Clamp
-            if (flap_frame < 0) flap_frame = 0;
-            if (flap_frame > 3) flap_frame = 3;
-
-            SDL_Rect srcrect = {flap_frame * SPRITE_SIZE, 0, SPRITE_SIZE, SPRITE_SIZE};
-            SDL_RenderCopy(renderer, toaster_tex, &srcrect, &dstrect);
-            drawn_toasters++;
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        fleet_update(&fleet, time_s, W, H);
+        update_ticks += SDL_GetPerformanceCounter() - t0;
+        update_frames++;
+
+        // Far layers first, toast behind toasters within each, all in one draw
+        for (int i = 0; i < fleet.count; i++) {
+            if (fleet.frame[i] < 0) continue;
+            SDL_FRect dstrect = {fleet.x[i], fleet.y[i], fleet.size[i], fleet.size[i]};
+            SDL_Color shade = {fleet.shade[i], fleet.shade[i], fleet.shade[i], 255};
+            sprite_batch_add(&batch, &toaster_atlas_frames[fleet.frame[i]], &dstrect, 0, shade);
         }
+        sprite_batch_flush(&batch, renderer);
 
         SDL_RenderPresent(renderer);
         SDL_Delay(16); // ~60fps
     }
 
+    if (update_frames > 0) {
+        SDL_Log("toastersaver: %d entities, %.3f ms per position update",
+                fleet.count, 1000.0 * update_ticks / SDL_GetPerformanceFrequency() / update_frames);
+    }
+    sprite_batch_log_summary(&batch, "toastersaver");
+
     // Cleanup - restore cursor visibility
     system("hyprctl keyword cursor:invisible false 2>/dev/null");
 
     // Cleanup
-    SDL_DestroyTexture(toaster_tex);
-    for (int i = 0; i < 4; i++) {
-        SDL_DestroyTexture(toast_texs[i]);
-    }
+    fleet_destroy(&fleet);
+    sprite_batch_destroy(&batch);
+    SDL_DestroyTexture(atlas_tex);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
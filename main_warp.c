@@ -3,22 +3,345 @@
 #include <stdint.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h> // for getopt
 #include "assets/star1.h"
 #include "assets/star2.h"
 #include "assets/star3.h"
 #include "assets/star4.h"
+#include "common/mipmap.h"
+#include "common/simd.h"
 
 #define PI 3.14159f
+#define WARP_LAYER_COUNT 18
+#define WARP_CYCLE 2.0f         // Seconds per zoom cycle
+#define WARP_MIN_OPACITY 2      // Layers fainter than this are not drawn
+#define WARP_MIP_MIN_SIZE 64    // Smallest mip level kept
+
+#define WARP_MODE_BITMAP 0
+#define WARP_MODE_PROCEDURAL 1
+
+#define STARFIELD_DEFAULT_STARS 20000
+#define STARFIELD_MAX_STARS 500000
+#define STARFIELD_DOT_SIZE 32           // Soft-dot texture size
+#define STARFIELD_STAR_PX 2.5f          // Star diameter at scale 1.0 on a 1080-line display
+#define STARFIELD_STREAK 0.02f          // Cycle fraction a motion streak trails behind
+
+// Layers sharing a texture and cycle phase draw identical images, so they are
+// drawn once with their opacities combined
+typedef struct {
+    int tex_idx;
+    float phase;                        // Delay of the earliest layer, seconds
+    float delays[WARP_LAYER_COUNT];     // Start time of every layer in the group
+    int count;
+} WarpGroup;
+
+// Per-run overdraw statistics, in screens (1.0 = every pixel blended once)
+typedef struct {
+    double overdraw_total;
+    double naive_total;                 // What drawing all layers full size would cost
+    double texels_total;                // Source texels sampled
+    float overdraw_peak;
+    Uint32 layers_drawn;
+    Uint32 layers_skipped;
+    Uint32 frames;
+} WarpStats;
+
+// Procedural stars in structure-of-arrays form, padded to SIMD_WIDTH. Each
+// star repeats the bitmap layers' zoom cycle on its own phase and speed.
+typedef struct {
+    int count;
+    int padded;
+    float *x, *y;                       // Offset from the screen centre at scale 1.0, pixels
+    float *z;                           // Position in the zoom cycle, 0..1
+    float *speed;                       // Cycles per second
+
+    // Projected quad corners and alpha, rewritten every frame
+    float *qx[4], *qy[4];
+    float *alpha;
+    float *area;
+
+    float radius;                       // Star radius at scale 1.0, pixels
+    void *arena;
+    SDL_Vertex *vertices;
+    int *indices;
+    SDL_Texture *dot;
+} Starfield;
 
 extern char *optarg;
 
+/**
+ * Opacity (0..1) and scale at `frac` of the cycle, following the CSS keyframes
+ */
+static void warp_keyframe(float frac, float *scale, float *opacity) {
+    if (frac < 0.5f) {
+        // 0% to 50%: opacity 0 to 1, scale 0.5 to ~1.0 (ease-in)
+        *opacity = frac * 2.0f;
+        *scale = 0.5f + frac * 2.0f * (1.0f - 0.5f);
+    } else if (frac < 0.85f) {
+        // 50% to 85%: opacity 1, scale 1.0 to 2.8 (linear)
+        *opacity = 1.0f;
+        *scale = 1.0f + (frac - 0.5f) / (0.85f - 0.5f) * (2.8f - 1.0f);
+    } else {
+        // 85% to 100%: opacity 1 to 0, scale 2.8 to 3.5 (linear)
+        *opacity = 1.0f - (frac - 0.85f) / 0.15f;
+        *scale = 2.8f + (frac - 0.85f) / 0.15f * (3.5f - 2.8f);
+    }
+}
+
+/**
+ * Draw one star layer centered at `scale` times the screen size. Magnified
+ * layers only sample the part of the source that lands on screen; minified
+ * layers use the smallest mip level that still covers the destination.
+ * Returns the number of screen pixels blended.
+ */
+static float warp_draw_layer(SDL_Renderer *renderer, const MipTexture *mip, int W, int H,
+                             float scale, Uint8 opacity, double *texels) {
+    float dst_w = W * scale;
+    float dst_h = H * scale;
+    SDL_FRect dst;
+    SDL_Rect src;
+    SDL_Texture *tex;
+
+    if (scale > 1.0f) {
+        int lw = mip->widths[0];
+        int lh = mip->heights[0];
+        float px = dst_w / lw; // Screen pixels per texel
+        float py = dst_h / lh;
+
+        // Centre 1/scale of the source, widened by a texel so edges stay covered
+        src.w = SDL_min(lw, (int)ceilf(lw / scale) + 2);
+        src.h = SDL_min(lh, (int)ceilf(lh / scale) + 2);
+        src.x = (lw - src.w) / 2;
+        src.y = (lh - src.h) / 2;
+
+        dst.x = W / 2.0f - (lw / 2.0f - src.x) * px;
+        dst.y = H / 2.0f - (lh / 2.0f - src.y) * py;
+        dst.w = src.w * px;
+        dst.h = src.h * py;
+        tex = mip->levels[0];
+    } else {
+        int level = mip_pick(mip, (int)ceilf(dst_w), (int)ceilf(dst_h));
+        src.x = 0;
+        src.y = 0;
+        src.w = mip->widths[level];
+        src.h = mip->heights[level];
+
+        dst.x = (W - dst_w) / 2.0f;
+        dst.y = (H - dst_h) / 2.0f;
+        dst.w = dst_w;
+        dst.h = dst_h;
+        tex = mip->levels[level];
+    }
+
+    SDL_SetTextureAlphaMod(tex, opacity);
+    SDL_RenderCopyF(renderer, tex, &src, &dst);
+
+    *texels += (double)src.w * src.h;
+    return SDL_min(dst_w, (float)W) * SDL_min(dst_h, (float)H);
+}
+
+/**
+ * Soft white dot, alpha falling off smoothly to zero at the edge
+ */
+static SDL_Texture *starfield_create_dot(SDL_Renderer *renderer) {
+    SDL_Surface *surf = SDL_CreateRGBSurfaceWithFormat(0, STARFIELD_DOT_SIZE, STARFIELD_DOT_SIZE, 32,
+                                                       SDL_PIXELFORMAT_ARGB8888);
+    if (!surf) return NULL;
+
+    float c = (STARFIELD_DOT_SIZE - 1) / 2.0f;
+    for (int y = 0; y < STARFIELD_DOT_SIZE; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surf->pixels + y * surf->pitch);
+        for (int x = 0; x < STARFIELD_DOT_SIZE; x++) {
+            float d2 = ((x - c) * (x - c) + (y - c) * (y - c)) / (c * c);
+            float a = d2 < 1.0f ? (1.0f - d2) * (1.0f - d2) : 0.0f;
+            row[x] = ((Uint32)(a * 255.0f) << 24) | 0x00FFFFFF;
+        }
+    }
+
+    SDL_Texture *tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    if (!tex) return NULL;
+    SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_ADD);
+    SDL_SetTextureScaleMode(tex, SDL_ScaleModeLinear);
+    return tex;
+}
+
+static void starfield_destroy(Starfield *sf) {
+    if (sf->dot) SDL_DestroyTexture(sf->dot);
+    free(sf->arena);
+    SDL_memset(sf, 0, sizeof(*sf));
+}
+
+static int starfield_init(Starfield *sf, SDL_Renderer *renderer, int count, int W, int H) {
+    SDL_memset(sf, 0, sizeof(*sf));
+    sf->count = count;
+    sf->padded = simd_round_up(count);
+
+    // One allocation: 14 float streams, then the vertex and index buffers
+    size_t floats = (size_t)sf->padded * 14;
+    size_t vertex_bytes = (size_t)count * 4 * sizeof(SDL_Vertex);
+    size_t index_bytes = (size_t)count * 6 * sizeof(int);
+    sf->arena = calloc(1, floats * sizeof(float) + vertex_bytes + index_bytes);
+    if (!sf->arena) return -1;
+
+    float *p = sf->arena;
+    sf->x = p; p += sf->padded;
+    sf->y = p; p += sf->padded;
+    sf->z = p; p += sf->padded;
+    sf->speed = p; p += sf->padded;
+    for (int k = 0; k < 4; k++) {
+        sf->qx[k] = p; p += sf->padded;
+        sf->qy[k] = p; p += sf->padded;
+    }
+    sf->alpha = p; p += sf->padded;
+    sf->area = p; p += sf->padded;
+    sf->vertices = (SDL_Vertex *)p;
+    sf->indices = (int *)(sf->vertices + (size_t)count * 4);
+
+    // Same footprint as the bitmaps: uniform over the screen at scale 1.0
+    for (int i = 0; i < count; i++) {
+        do {
+            sf->x[i] = ((float)rand() / RAND_MAX - 0.5f) * W;
+            sf->y[i] = ((float)rand() / RAND_MAX - 0.5f) * H;
+        } while (fabsf(sf->x[i]) < 0.5f && fabsf(sf->y[i]) < 0.5f);
+        sf->z[i] = (float)rand() / RAND_MAX;
+        sf->speed[i] = (0.8f + 0.4f * rand() / RAND_MAX) / WARP_CYCLE;
+    }
+
+    // Quads never change topology, so the index buffer is built once
+    for (int i = 0; i < count; i++) {
+        int *idx = &sf->indices[i * 6];
+        int v = i * 4;
+        idx[0] = v;
+        idx[1] = v + 1;
+        idx[2] = v + 2;
+        idx[3] = v;
+        idx[4] = v + 2;
+        idx[5] = v + 3;
+    }
+
+    sf->radius = STARFIELD_STAR_PX * 0.5f * H / 1080.0f;
+    if (sf->radius < 0.75f) sf->radius = 0.75f;
+
+    sf->dot = starfield_create_dot(renderer);
+    if (!sf->dot) {
+        starfield_destroy(sf);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * warp_keyframe for four cycle positions at once
+ */
+static inline void starfield_keyframe(f32x4 z, f32x4 *scale, f32x4 *opacity) {
+    i32x4 ramp = z < simd_splat(0.5f);
+    i32x4 hold = z < simd_splat(0.85f);
+    f32x4 fade = (z - 0.85f) / 0.15f;
+
+    *opacity = simd_select(ramp, z * 2.0f, simd_select(hold, simd_splat(1.0f), 1.0f - fade));
+    *scale = simd_select(ramp, 0.5f + z,
+                         simd_select(hold, 1.0f + (z - 0.5f) / (0.85f - 0.5f) * (2.8f - 1.0f),
+                                     2.8f + fade * (3.5f - 2.8f)));
+}
+
+/**
+ * Advance every star by dt seconds and project it to a screen-space quad
+ * stretched from where it was STARFIELD_STREAK of a cycle ago to where it is
+ * now. Stars that are invisible or off screen get alpha 0.
+ */
+static void starfield_update(Starfield *sf, float dt, int W, int H) {
+    f32x4 cx = simd_splat(W / 2.0f);
+    f32x4 cy = simd_splat(H / 2.0f);
+    f32x4 vdt = simd_splat(dt);
+
+    for (int i = 0; i < sf->padded; i += SIMD_WIDTH) {
+        f32x4 z = simd_load(sf->z + i) + simd_load(sf->speed + i) * vdt;
+        z -= simd_floor(z);
+        simd_store(sf->z + i, z);
+
+        f32x4 scale, opacity, tail_scale, unused;
+        starfield_keyframe(z, &scale, &opacity);
+        starfield_keyframe(simd_max(z - STARFIELD_STREAK, simd_splat(0.0f)), &tail_scale, &unused);
+
+        f32x4 x = simd_load(sf->x + i);
+        f32x4 y = simd_load(sf->y + i);
+        f32x4 hx = x * scale, hy = y * scale;
+        f32x4 tx = x * tail_scale, ty = y * tail_scale;
+        f32x4 r = sf->radius * scale;
+
+        // Unit vector along the streak, pointing away from the centre
+        f32x4 dx = hx - tx, dy = hy - ty;
+        f32x4 len = simd_sqrt(dx * dx + dy * dy);
+        i32x4 moving = len > simd_splat(1e-4f);
+        f32x4 inv = 1.0f / simd_max(len, simd_splat(1e-4f));
+        f32x4 ux = simd_select(moving, dx * inv, simd_splat(1.0f)) * r;
+        f32x4 uy = simd_select(moving, dy * inv, simd_splat(0.0f)) * r;
+
+        // Back and front edges, each pushed out by the radius so the dot's
+        // round ends fit inside the quad
+        f32x4 bx = cx + tx - ux, by = cy + ty - uy;
+        f32x4 fx = cx + hx + ux, fy = cy + hy + uy;
+        simd_store(sf->qx[0] + i, bx - uy);
+        simd_store(sf->qy[0] + i, by + ux);
+        simd_store(sf->qx[1] + i, fx - uy);
+        simd_store(sf->qy[1] + i, fy + ux);
+        simd_store(sf->qx[2] + i, fx + uy);
+        simd_store(sf->qy[2] + i, fy - ux);
+        simd_store(sf->qx[3] + i, bx + uy);
+        simd_store(sf->qy[3] + i, by - ux);
+
+        // The head is always the outermost point, so the quad is on screen
+        // when either end is
+        f32x4 minx = simd_min(bx, fx) - r, maxx = simd_max(bx, fx) + r;
+        f32x4 miny = simd_min(by, fy) - r, maxy = simd_max(by, fy) + r;
+        i32x4 visible = (maxx > 0.0f) & (minx < (float)W) & (maxy > 0.0f) & (miny < (float)H) &
+                        (opacity > 1.0f / 255.0f);
+        simd_store(sf->alpha + i, simd_select(visible, opacity * 255.0f, simd_splat(0.0f)));
+        simd_store(sf->area + i, simd_select(visible, (len + 2.0f * r) * 2.0f * r, simd_splat(0.0f)));
+    }
+}
+
+/**
+ * Emit every visible star as one quad and draw them all in a single
+ * SDL_RenderGeometry call. Returns the number of stars drawn and adds the
+ * blended area to *fill.
+ */
+static int starfield_render(Starfield *sf, SDL_Renderer *renderer, double *fill) {
+    static const SDL_FPoint uv[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    int drawn = 0;
+
+    for (int i = 0; i < sf->count; i++) {
+        if (sf->alpha[i] < 1.0f) continue;
+
+        SDL_Vertex *v = &sf->vertices[drawn * 4];
+        SDL_Color color = {255, 255, 255, (Uint8)sf->alpha[i]};
+        for (int k = 0; k < 4; k++) {
+            v[k].position.x = sf->qx[k][i];
+            v[k].position.y = sf->qy[k][i];
+            v[k].color = color;
+            v[k].tex_coord = uv[k];
+        }
+        *fill += sf->area[i];
+        drawn++;
+    }
+
+    if (drawn > 0) {
+        SDL_RenderGeometry(renderer, sf->dot, sf->vertices, drawn * 4, sf->indices, drawn * 6);
+    }
+    return drawn;
+}
+
 static void usage(const char *prog) {
     fprintf(stderr, "Usage: %s [options]\n", prog);
     fprintf(stderr, "Options:\n");
     fprintf(stderr, "  -s F    Speed multiplier (default: 1.0)\n");
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
+    fprintf(stderr, "  -m STR  Mode: bitmap or procedural (default: bitmap)\n");
+    fprintf(stderr, "  -n N    Number of stars in procedural mode (default: %d)\n", STARFIELD_DEFAULT_STARS);
+    fprintf(stderr, "  -c HEX  Star color as RRGGBB (default: FFFFFF)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -26,8 +349,11 @@ int main(int argc, char *argv[]) {
     int opt;
     float speed_mult = 1.0f;
     int do_fullscreen = 1;
+    int mode = WARP_MODE_BITMAP;
+    int star_count = STARFIELD_DEFAULT_STARS;
+    SDL_Color tint = {255, 255, 255, 255};
 
-    while ((opt = getopt(argc, argv, "s:f:h")) != -1) {
+    while ((opt = getopt(argc, argv, "s:f:m:n:c:h")) != -1) {
         switch (opt) {
             case 's':
                 speed_mult = atof(optarg);
@@ -37,6 +363,28 @@ int main(int argc, char *argv[]) {
             case 'f':
                 do_fullscreen = atoi(optarg);
                 break;
+            case 'm':
+                if (strcmp(optarg, "bitmap") == 0) {
+                    mode = WARP_MODE_BITMAP;
+                } else if (strcmp(optarg, "procedural") == 0) {
+                    mode = WARP_MODE_PROCEDURAL;
+                } else {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'n':
+                star_count = atoi(optarg);
+                if (star_count < 1) star_count = 1;
+                if (star_count > STARFIELD_MAX_STARS) star_count = STARFIELD_MAX_STARS;
+                break;
+            case 'c': {
+                unsigned long rgb = strtoul(optarg, NULL, 16);
+                tint.r = (rgb >> 16) & 0xFF;
+                tint.g = (rgb >> 8) & 0xFF;
+                tint.b = rgb & 0xFF;
+                break;
+            }
             case 'h':
             default:
                 usage(argv[0]);
@@ -85,9 +433,11 @@ int main(int argc, char *argv[]) {
     int W, H;
     SDL_GetRendererOutputSize(renderer, &W, &H);
 
-    // Load star textures from embedded assets
-    SDL_Texture *star_texs[4];
-    for (int i = 0; i < 4; i++) {
+    // Load star textures from embedded assets; procedural mode needs none
+    MipTexture star_mips[4];
+    int tex_count = (mode == WARP_MODE_BITMAP) ? 4 : 0;
+    size_t source_bytes = 0;
+    for (int i = 0; i < tex_count; i++) {
         const unsigned char *data;
         unsigned int len;
 
@@ -132,12 +482,35 @@ int main(int argc, char *argv[]) {
             SDL_Quit();
             return 1;
         }
-        star_texs[i] = SDL_CreateTextureFromSurface(renderer, surf);
+        // The art is white on transparency: keep one channel at display size
+        source_bytes += (size_t)surf->w * surf->h * 4;
+        SDL_Surface *fitted = mip_resize(surf, SDL_min(W, surf->w), SDL_min(H, surf->h));
         SDL_FreeSurface(surf);
+        int mip_failed = !fitted || mip_create_luma(&star_mips[i], renderer, fitted, WARP_MIP_MIN_SIZE);
+        if (fitted) SDL_FreeSurface(fitted);
+        if (mip_failed) {
+            SDL_Log("Error creating star%d texture: %s", i + 1, SDL_GetError());
+            for (int j = 0; j < i; j++) mip_destroy(&star_mips[j]);
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        for (int l = 0; l < star_mips[i].count; l++) {
+            SDL_SetTextureColorMod(star_mips[i].levels[l], tint.r, tint.g, tint.b);
+        }
+    }
+    if (tex_count > 0) {
+        size_t bytes = 0;
+        for (int i = 0; i < tex_count; i++) bytes += star_mips[i].bytes;
+        SDL_Log("Warp: star layers at %dx%d, %.1f MB with mips (source RGBA %.1f MB)",
+                star_mips[0].widths[0], star_mips[0].heights[0],
+                bytes / 1048576.0, source_bytes / 1048576.0);
     }
 
     // Warp layer data: {tex_index, delay_seconds}
-    int warp_layers[18][2] = {
+    int warp_layers[WARP_LAYER_COUNT][2] = {
         {0, 0},    // stars1 delay 0
         {1, 250},  // stars2 delay 0.25
         {2, 500},  // stars3 delay 0.5
@@ -157,10 +530,50 @@ int main(int argc, char *argv[]) {
         {0, 4000}  // stars1 delay 4
     };
 
+    // Group layers that always show the same image
+    WarpGroup groups[WARP_LAYER_COUNT];
+    int group_count = 0;
+    for (int i = 0; i < WARP_LAYER_COUNT; i++) {
+        int tex_idx = warp_layers[i][0];
+        int phase_ms = warp_layers[i][1] % (int)(WARP_CYCLE * 1000);
+        float delay = warp_layers[i][1] / 1000.0f;
+
+        WarpGroup *g = NULL;
+        for (int j = 0; j < group_count; j++) {
+            if (groups[j].tex_idx == tex_idx && (int)(groups[j].phase * 1000.0f + 0.5f) == phase_ms) {
+                g = &groups[j];
+                break;
+            }
+        }
+        if (!g) {
+            g = &groups[group_count++];
+            g->tex_idx = tex_idx;
+            g->phase = phase_ms / 1000.0f;
+            g->count = 0;
+        }
+        g->delays[g->count++] = delay;
+    }
+
+    Starfield starfield = {0};
+    if (mode == WARP_MODE_PROCEDURAL) {
+        if (starfield_init(&starfield, renderer, star_count, W, H) != 0) {
+            SDL_Log("Error creating procedural starfield: %s", SDL_GetError());
+            SDL_DestroyRenderer(renderer);
+            SDL_DestroyWindow(window);
+            IMG_Quit();
+            SDL_Quit();
+            return 1;
+        }
+        SDL_SetTextureColorMod(starfield.dot, tint.r, tint.g, tint.b);
+    }
+
+    WarpStats stats = {0};
+
     // Main loop
     SDL_Event e;
     int quit = 0;
     Uint32 start_time = SDL_GetTicks();
+    Uint32 last_time = start_time;
 
     while (!quit) {
         while (SDL_PollEvent(&e)) {
@@ -184,51 +597,80 @@ int main(int argc, char *argv[]) {
         SDL_RenderClear(renderer);
 
         // Render warp starfields
-        for (int i = 0; i < 18; i++) {
-            int tex_idx = warp_layers[i][0];
-            float delay_ms = warp_layers[i][1] / 1000.0f;
-            float local_time = fmodf(time_ms - delay_ms, 2.0f);
-            float frac = local_time / 2.0f;
-
-            // Calculate scale and opacity based on CSS keyframes
-            float scale;
-            uint8_t opacity;
-
-            if (frac < 0.5f) {
-                // 0% to 50%: opacity 0 to 1, scale 0.5 to ~1.0 (ease-in)
-                opacity = (uint8_t)(frac * 2.0f * 255);
-                scale = 0.5f + frac * 2.0f * (1.0f - 0.5f);
-            } else if (frac < 0.85f) {
-                // 50% to 85%: opacity 1, scale 1.0 to 2.8 (linear)
-                opacity = 255;
-                scale = 1.0f + (frac - 0.5f) / (0.85f - 0.5f) * (2.8f - 1.0f);
-            } else {
-                // 85% to 100%: opacity 1 to 0, scale 2.8 to 3.5 (linear)
-                opacity = (uint8_t)((1.0f - (frac - 0.85f) / 0.15f) * 255);
-                scale = 2.8f + (frac - 0.85f) / 0.15f * (3.5f - 2.8f);
-            }
+        float screen_area = (float)W * H;
+        float frame_overdraw = 0.0f;
+        if (mode == WARP_MODE_PROCEDURAL) {
+            float dt = (current_time - last_time) / 1000.0f;
+            if (dt > 0.1f) dt = 0.1f;
+            starfield_update(&starfield, dt * speed_mult, W, H);
+
+            double fill = 0.0;
+            stats.layers_drawn += starfield_render(&starfield, renderer, &fill);
+            frame_overdraw = (float)(fill / screen_area);
+        } else {
+            for (int i = 0; i < group_count; i++) {
+                WarpGroup *g = &groups[i];
+
+                float frac = fmodf(time_ms - g->phase, WARP_CYCLE) / WARP_CYCLE;
+                if (frac < 0.0f) frac += 1.0f;
+                float scale, alpha;
+                warp_keyframe(frac, &scale, &alpha);
+                stats.naive_total += g->count * SDL_min(scale, 1.0f) * SDL_min(scale, 1.0f);
+
+                // Layers only join once their delay has passed
+                int active = 0;
+                for (int j = 0; j < g->count; j++) {
+                    if (time_ms >= g->delays[j]) active++;
+                }
+                if (active == 0) {
+                    stats.layers_skipped += g->count;
+                    continue;
+                }
 
-            // Set texture alpha
-            SDL_SetTextureAlphaMod(star_texs[tex_idx], opacity);
+                // Layers blend additively, so `active` copies at alpha a add
+                // up to active * a
+                float combined = SDL_min(1.0f, alpha * (float)active);
+                Uint8 opacity = (Uint8)(combined * 255.0f);
 
-            // Render centered and scaled
-            int dst_w = (int)(W * scale);
-            int dst_h = (int)(H * scale);
-            int dst_x = W / 2 - dst_w / 2;
-            int dst_y = H / 2 - dst_h / 2;
-            SDL_Rect dst_rect = {dst_x, dst_y, dst_w, dst_h};
+                if (opacity < WARP_MIN_OPACITY) {
+                    stats.layers_skipped += g->count;
+                    continue;
+                }
 
-            SDL_RenderCopy(renderer, star_texs[tex_idx], NULL, &dst_rect);
+                frame_overdraw += warp_draw_layer(renderer, &star_mips[g->tex_idx], W, H,
+                                                  scale, opacity, &stats.texels_total) / screen_area;
+                stats.layers_drawn++;
+                stats.layers_skipped += g->count - 1;
+            }
         }
+        last_time = current_time;
+
+        stats.overdraw_total += frame_overdraw;
+        if (frame_overdraw > stats.overdraw_peak) stats.overdraw_peak = frame_overdraw;
+        stats.frames++;
 
         SDL_RenderPresent(renderer);
         SDL_Delay(16); // ~60fps
     }
 
+    if (stats.frames > 0 && mode == WARP_MODE_PROCEDURAL) {
+        SDL_Log("Warp: %d procedural stars, %.0f drawn/frame in one batch, overdraw avg %.3f screens/frame (peak %.3f)",
+                starfield.count, (float)stats.layers_drawn / stats.frames,
+                stats.overdraw_total / stats.frames, stats.overdraw_peak);
+    } else if (stats.frames > 0) {
+        SDL_Log("Warp: overdraw avg %.2f screens/frame (peak %.2f, %.2f drawing every layer full size)",
+                stats.overdraw_total / stats.frames, stats.overdraw_peak,
+                stats.naive_total / stats.frames);
+        SDL_Log("Warp: %.1f layers drawn/frame, %.1f skipped, %.1f Mtexels sampled/frame",
+                (float)stats.layers_drawn / stats.frames, (float)stats.layers_skipped / stats.frames,
+                stats.texels_total / stats.frames / 1e6);
+    }
+
     // Cleanup
-    for (int i = 0; i < 4; i++) {
-        SDL_DestroyTexture(star_texs[i]);
+    for (int i = 0; i < tex_count; i++) {
+        mip_destroy(&star_mips[i]);
     }
+    starfield_destroy(&starfield);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     IMG_Quit();
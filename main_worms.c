@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h> // for getopt
+#include "common/quality_governor.h"
 
 #define PI 3.141592653589793f
 
@@ -37,6 +38,7 @@ static void usage(const char *prog) {
     fprintf(stderr, "  -f 0|1  Fullscreen (1=yes, 0=windowed) (default: 1)\n");
     fprintf(stderr, "  -w F    Wiggle factor (0=straight, 1=max wiggle) (default: 0.02)\n");
     fprintf(stderr, "  -a 0|1  Audio (1=on, 0=off) (default: 1)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default: 1)\n");
     fprintf(stderr, "  -h      Show this help\n");
 }
 
@@ -56,8 +58,9 @@ int main(int argc, char *argv[]) {
     int do_fullscreen = 1;
     float wiggle = 0.02f;
     int audio_enabled = 0; // default audio off; enable with -a 1
+    int adaptive_quality = 1;
 
-    while ((opt = getopt(argc, argv, "n:l:s:f:w:a:h")) != -1) {
+    while ((opt = getopt(argc, argv, "n:l:s:f:w:a:q:h")) != -1) {
         switch (opt) {
             case 'n':
                 worm_count = atoi(optarg);
@@ -85,6 +88,9 @@ int main(int argc, char *argv[]) {
             case 'a':
                 audio_enabled = atoi(optarg);
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -290,6 +296,13 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // Worms beyond active_worms are parked (not moved or drawn) while the
+    // quality governor holds the count down
+    int active_worms = worm_count;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    governor_register_knob(&gov, "worms", &active_worms, 1, worm_count);
+
     // Hide cursor
     system("hyprctl keyword cursor:invisible true &>/dev/null");
 
@@ -308,6 +321,8 @@ int main(int argc, char *argv[]) {
     if (body_surf) { body_tex_base = SDL_CreateTextureFromSurface(renderer, body_surf); SDL_FreeSurface(body_surf); }
 
     while (!quit) {
+        governor_begin_frame(&gov);
+
         while (SDL_PollEvent(&e)) {
             if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN || e.type == SDL_MOUSEBUTTONDOWN) {
                 SDL_Log("Screensaver quit triggered: event type %d", e.type);
@@ -326,7 +341,7 @@ int main(int argc, char *argv[]) {
     float dt = (now - last_ticks) / 1000.0f;
     if (dt > 0.05f) dt = 0.05f; // clamp large frame gaps
     last_ticks = now;
-        for (int i = 0; i < worm_count; i++) {
+        for (int i = 0; i < active_worms; i++) {
             Worm *w = &worms[i];
             // Squiggle: small random turn
             float turn = (rand() % 21 - 10) * wiggle;
@@ -356,8 +371,8 @@ int main(int argc, char *argv[]) {
             }
         }
         // Worm-worm collisions
-        for (int i = 0; i < worm_count; i++) {
-            for (int j = i + 1; j < worm_count; j++) {
+        for (int i = 0; i < active_worms; i++) {
+            for (int j = i + 1; j < active_worms; j++) {
                 Worm *w1 = &worms[i];
                 Worm *w2 = &worms[j];
                 float radius = 10.0f;
@@ -427,7 +442,7 @@ int main(int argc, char *argv[]) {
             }
         }
         // Update segments
-        for (int i = 0; i < worm_count; i++) {
+        for (int i = 0; i < active_worms; i++) {
             Worm *w = &worms[i];
             for (int j = w->length - 1; j > 0; j--) {
                 w->segments[j] = w->segments[j - 1];
@@ -439,7 +454,7 @@ int main(int argc, char *argv[]) {
         // Draw trails (make black to hide screenshot)
         SDL_SetRenderTarget(renderer, trails_tex);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // opaque black
-        for (int i = 0; i < worm_count; i++) {
+        for (int i = 0; i < active_worms; i++) {
             Worm *w = &worms[i];
             for (int j = 0; j < w->length - 1; j++) {
                 // Thickness tapering: head thick, tail thin
@@ -464,7 +479,7 @@ int main(int argc, char *argv[]) {
         }
         // Render worms on top
         float rainbow_time = (now - start_time) / 1000.0f;
-        for (int i = 0; i < worm_count; i++) {
+        for (int i = 0; i < active_worms; i++) {
             Worm *w = &worms[i];
             int head_w=0, head_h=0;
             if (head_tex) SDL_QueryTexture(head_tex, NULL, NULL, &head_w, &head_h);
@@ -491,9 +506,11 @@ int main(int argc, char *argv[]) {
         }
 
         SDL_RenderPresent(renderer);
-        SDL_Delay(16);
+        governor_end_frame(&gov);
     }
 
+    governor_log_summary(&gov, "worms");
+
     // Exit fullscreen on quit to show Waybar immediately
     system("(hyprctl dispatch fullscreen > /dev/null 2>&1)");
     SDL_Delay(200); // Allow Hyprland to process fullscreen exit
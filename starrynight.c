@@ -8,6 +8,7 @@
  * - -s F: speed multiplier (default 1.0)
  * - -d N: star density (0=sparse, 1=dense, default 0.5)
  * - -m F: meteor frequency multiplier (default 1.0, higher = more meteors)
+ * - -q 0|1: adaptive quality, scales star counts to hold 60 fps (default 1)
  *
  * Requires: SDL2, mesa/opengl (wayland)
  * Build: gcc -o starrynight starrynight.c -lSDL2 -lGL -lm
@@ -22,6 +23,8 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <stdbool.h>
+#include "common/particles.h"
+#include "common/quality_governor.h"
 
 #define PI 3.14159265359f
 #define STAR_COUNT 500  // Space for drifting sky stars only
@@ -172,24 +175,15 @@ Building buildings[CITY_BUILDINGS]; // Static building array - temporary
 // Gap stars - fill spaces between buildings
 Star *gap_stars; // Stars that specifically fill gaps between buildings
 
-typedef struct {
-    float x, y;           // Current position
-    float vx, vy;         // Velocity
-    float life;           // 0-1 lifetime remaining
-    float tail_particlesx[METEOR_PARTICLES]; // Positions for tail effect
-    float tail_particlesy[METEOR_PARTICLES];
-    float tail_alphas[METEOR_PARTICLES];
-    int active;           // Currently animating
-} Meteor;
+// Meteors are particles in a pool with a METEOR_PARTICLES-step trail
 
 // FUNCTION PROTOTYPES - Extended for Urban System Complexity
 void init_stars(Star *stars, int count, int screen_width, int screen_height);
 void update_stars(Star *stars, int count, float dt, int screen_width, int screen_height);
 void render_stars(Star *stars, int count, int screen_width, int screen_height);
 void render_gradient_background(int screen_width, int screen_height);
-void init_meteor(Meteor *meteor, int screen_width, int screen_height);
-void render_meteor(Meteor *meteor, int screen_width, int screen_height);
-void update_meteor(Meteor *meteor, float dt, int screen_width, int screen_height);
+void spawn_meteor(ParticlePool *meteors, int screen_width, int screen_height);
+void render_meteors(const ParticlePool *meteors);
 void init_opengl(int width, int height);
 void usage(const char *prog);
 
@@ -752,9 +746,10 @@ int main(int argc, char *argv[]) {
     float speed_mult = 1.0f;
     float star_density = 0.5f;
     float meteor_freq = 1.0f;
+    int adaptive_quality = 1;
     int ch;
 
-    while ((ch = getopt(argc, argv, "s:d:m:h")) != -1) {
+    while ((ch = getopt(argc, argv, "s:d:m:q:h")) != -1) {
         switch (ch) {
             case 's':
                 speed_mult = atof(optarg);
@@ -769,6 +764,9 @@ int main(int argc, char *argv[]) {
                 if (meteor_freq < 0) meteor_freq = 0;
                 if (meteor_freq > 5) meteor_freq = 5;
                 break;
+            case 'q':
+                adaptive_quality = atoi(optarg);
+                break;
             case 'h':
             default:
                 usage(argv[0]);
@@ -911,14 +909,31 @@ int main(int argc, char *argv[]) {
     Star *stars = (Star *)malloc(actual_star_count * sizeof(Star));
     init_stars(stars, actual_star_count, screen_width, screen_height);
 
-    // Initialize meteor system
-    Meteor meteors[METEOR_COUNT];
-    for (int i = 0; i < METEOR_COUNT; i++) {
-        meteors[i].life = 0;  // Start inactive
+    // Initialize meteor system; meteors die when faded or off the right or bottom edge
+    ParticlePool meteors;
+    if (particle_pool_init(&meteors, METEOR_COUNT, METEOR_PARTICLES) != 0) {
+        fprintf(stderr, "Out of memory for meteors\n");
+        free(stars);
+        SDL_GL_DeleteContext(gl_context);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
     }
+    particle_pool_set_bounds(&meteors, -FLT_MAX, -100.0f, screen_width + 100.0f, FLT_MAX);
 
     // OLD BACKGROUND STAR SYSTEM REMOVED - Replaced with gap stars that fill spaces between buildings
 
+    // ADAPTIVE QUALITY - star counts are density knobs scaled by the governor.
+    // Sky stars never exceed the -d density; gap stars may thin out to 10%.
+    int active_star_count = actual_star_count;
+    int active_gap_stars = GAP_STAR_COUNT;
+    int min_sky_stars = (int)(STAR_COUNT * 0.3f);
+    if (min_sky_stars > actual_star_count) min_sky_stars = actual_star_count;
+    QualityGovernor gov;
+    governor_init(&gov, 60, adaptive_quality);
+    governor_register_knob(&gov, "sky stars", &active_star_count, min_sky_stars, actual_star_count);
+    governor_register_knob(&gov, "gap stars", &active_gap_stars, GAP_STAR_COUNT / 10, GAP_STAR_COUNT);
+
     Uint64 last_time = SDL_GetTicks64();
     float meteor_timer = 0;
 
@@ -927,6 +942,8 @@ int main(int argc, char *argv[]) {
     bool running = true;
 
     while (running) {
+        governor_begin_frame(&gov);
+
         // Handle events
         while (SDL_PollEvent(&event)) {
             switch (event.type) {
@@ -947,8 +964,8 @@ int main(int argc, char *argv[]) {
         last_time = current_time;
 
         // Update sky stars and gap stars
-        update_stars(stars, actual_star_count, dt * speed_mult, screen_width, screen_height);
-        update_stars(gap_stars, GAP_STAR_COUNT, dt * speed_mult, screen_width, screen_height);
+        update_stars(stars, active_star_count, dt * speed_mult, screen_width, screen_height);
+        update_stars(gap_stars, active_gap_stars, dt * speed_mult, screen_width, screen_height);
 
         // Update and handle meteors - much more frequent for visibility
         meteor_timer += dt * speed_mult;
@@ -957,21 +974,11 @@ int main(int argc, char *argv[]) {
         if (meteor_timer >= meteor_interval) {
             meteor_timer -= meteor_interval;
 
-            // Find inactive meteor to activate
-            for (int i = 0; i < METEOR_COUNT; i++) {
-                if (meteors[i].life <= 0) {
-                    init_meteor(&meteors[i], screen_width, screen_height);
-                    break;
-                }
-            }
+            spawn_meteor(&meteors, screen_width, screen_height);
         }
 
         // Update active meteors
-        for (int i = 0; i < METEOR_COUNT; i++) {
-            if (meteors[i].life > 0) {
-                update_meteor(&meteors[i], dt * speed_mult, screen_width, screen_height);
-            }
-        }
+        particle_pool_update(&meteors, dt * speed_mult);
 
         // WINDOW RANDOM ILLUMINATION UPDATE - Every 0.75 seconds toggle some windows randomly for dynamic lighting effect
         window_update_timer += dt;
@@ -1053,10 +1060,10 @@ int main(int argc, char *argv[]) {
 
         // Render sky stars (buildings static, stars work normally)
         glPointSize(1.0f); // Ensure proper star point size
-        render_stars(stars, actual_star_count, screen_width, screen_height);
+        render_stars(stars, active_star_count, screen_width, screen_height);
 
         // RENDER GAP STARS BETWEEN BUILDINGS - NO STENCIL NEEDED, they are in open areas
-        render_stars(gap_stars, GAP_STAR_COUNT, screen_width, screen_height);
+        render_stars(gap_stars, active_gap_stars, screen_width, screen_height);
 
         // No stencil operations needed for gap stars - they render in open spaces
 
@@ -1098,11 +1105,7 @@ int main(int argc, char *argv[]) {
         glLineWidth(1.0f); // Reset line width for subsequent rendering
 
         // Render meteors
-        for (int i = 0; i < METEOR_COUNT; i++) {
-            if (meteors[i].life > 0) {
-                render_meteor(&meteors[i], screen_width, screen_height);
-            }
-        }
+        render_meteors(&meteors);
 
         // CHUNK 2: AIRCRAFT WARNING BEACON SYSTEM - Aviation Safety Lighting
         // Render FAA-compliant red beacons on tall buildings for aircraft safety
@@ -1126,10 +1129,13 @@ int main(int argc, char *argv[]) {
 
         // Swap buffers
         SDL_GL_SwapWindow(window);
-        SDL_Delay(16); // Cap at ~60 FPS
+        governor_end_frame(&gov); // Cap at ~60 FPS
     }
 
+    governor_log_summary(&gov, "starrynight");
+
     // Cleanup
+    particle_pool_destroy(&meteors);
     free(stars);
     SDL_GL_DeleteContext(gl_context);
     SDL_DestroyWindow(window);
@@ -1145,6 +1151,7 @@ void usage(const char *prog) {
     fprintf(stderr, "  -s F    Speed multiplier (default 1.0)\n");
     fprintf(stderr, "  -d F    Star density 0.0-1.0 (default 0.5)\n");
     fprintf(stderr, "  -m F    Meteor frequency multiplier (default 1.0)\n");
+    fprintf(stderr, "  -q 0|1  Adaptive quality (1=on, 0=off) (default 1)\n");
     fprintf(stderr, "  -h      Show this help\n\n");
     fprintf(stderr, "Run with: SDL_VIDEODRIVER=wayland ./starrynight\n");
     fprintf(stderr, "Exit with ESC or mouse/keyboard input after 5s delay\n");
@@ -1262,13 +1269,13 @@ void render_stars(Star *stars, int count, int screen_width __attribute__((unused
     glEnd();
 }
 
-void init_meteor(Meteor *meteor, int screen_width, int screen_height) {
+void spawn_meteor(ParticlePool *meteors, int screen_width, int screen_height) {
     // Random start position within visible sky area, well above all buildings
     // Maximum building height ~20% of screen + 50px base = ensure 30% safe margin
     int min_sky_y = screen_height * 0.3f; // 30% down screen from top (well above tallest buildings)
 
-    meteor->x = rand() % screen_width; // Anywhere across full screen width (0 to screen_width)
-    meteor->y = min_sky_y + rand() % (screen_height - min_sky_y); // From 30% height to top
+    float x = rand() % screen_width; // Anywhere across full screen width (0 to screen_width)
+    float y = min_sky_y + rand() % (screen_height - min_sky_y); // From 30% height to top
 
     // Random direction and speed for natural-looking movement across sky
     // Movement should generally be downward and horizontal for realistic meteor trajectories
@@ -1276,77 +1283,56 @@ void init_meteor(Meteor *meteor, int screen_width, int screen_height) {
     float speed = 150 + rand() % 200; // 150-350 pixels/second
 
     // Convert angle to velocity components, weighted toward diagonal movement
-    meteor->vx = cosf(angle) * speed;
-    meteor->vy = sinf(angle) * speed * 0.7f; // Slightly less vertical for more horizontal movement
-    meteor->vy += 50; // Add steady downward component for visibility
-
-    meteor->life = 1.0f; // Full life
-    meteor->active = true;
-
-    // Initialize particle trail positions
-    for (int i = 0; i < METEOR_PARTICLES; i++) {
-        meteor->tail_particlesx[i] = meteor->x;
-        meteor->tail_particlesy[i] = meteor->y;
-        meteor->tail_alphas[i] = 0.0f;
-    }
-}
-
-void update_meteor(Meteor *meteor, float dt, int screen_width,
-                  __attribute__((unused)) int screen_height) {
-    if (meteor->life <= 0) return;
-
-    meteor->x += meteor->vx * dt;
-    meteor->y -= meteor->vy * dt; // Downward
-    meteor->life -= dt * 1.2f;    // Fade over ~1.2-2.0 seconds
-
-    // Update particle trail
-    for (int i = METEOR_PARTICLES - 1; i > 0; i--) {
-        meteor->tail_particlesx[i] = meteor->tail_particlesx[i-1];
-        meteor->tail_particlesy[i] = meteor->tail_particlesy[i-1];
-        meteor->tail_alphas[i] = meteor->tail_alphas[i-1];
-    }
-
-    meteor->tail_particlesx[0] = meteor->x;
-    meteor->tail_particlesy[0] = meteor->y;
-    meteor->tail_alphas[0] = meteor->life;
+    float vx = cosf(angle) * speed;
+    float vy = sinf(angle) * speed * 0.7f; // Slightly less vertical for more horizontal movement
+    vy += 50; // Add steady downward component for visibility
 
-    // Deactivate when off screen or faded
-    if (meteor->life <= 0 || meteor->x > screen_width + 100 || meteor->y < -100) {
-        meteor->active = false;
-        meteor->life = 0;
-    }
+    // GL y points up, so downward is negative; the trail starts empty
+    int m = particle_spawn(meteors, x, y, vx, -vy);
+    if (m >= 0) meteors->decay[m] = 1.2f; // Fade over ~0.8 seconds
 }
 
-void render_meteor(Meteor *meteor, int screen_width __attribute__((unused)), int screen_height __attribute__((unused))) {
-    if (meteor->life <= 0 || !meteor->active) return;
+void render_meteors(const ParticlePool *meteors) {
+    if (meteors->live == 0) return;
 
-    // Render particle trail
+    // Render particle trails, all meteors in one batch
+    glPointSize(1.0f);
     glBegin(GL_POINTS);
-    glColor3f(0.8f, 0.9f, 1.0f); // Bright blue-white
-
-    for (int i = 0; i < METEOR_PARTICLES; i++) {
-        if (meteor->tail_alphas[i] > 0.1f) {
-            glColor4f(0.8f, 0.9f, 1.0f, meteor->tail_alphas[i]);
-            glVertex2f(meteor->tail_particlesx[i], meteor->tail_particlesy[i]);
+    for (int m = 0; m < meteors->high; m++) {
+        if (meteors->life[m] <= 0) continue;
+        for (int i = 0; i < METEOR_PARTICLES; i++) {
+            float x, y, alpha;
+            particle_trail(meteors, m, i, &x, &y, &alpha);
+            if (alpha > 0.1f) {
+                glColor4f(0.8f, 0.9f, 1.0f, alpha); // Bright blue-white
+                glVertex2f(x, y);
+            }
         }
     }
     glEnd();
 
-    // Render EXTRA-BRIGHT head of meteor with enhanced glow
+    // Render EXTRA-BRIGHT heads of meteors with enhanced glow
     glPointSize(4.0f); // Larger head for extra brightness
 
     // Main bright center core
     glBegin(GL_POINTS);
-    glColor4f(1.0f, 1.0f, 1.0f, meteor->life * 1.2f); // Slightly brighter than max
-    glVertex2f(meteor->x, meteor->y);
+    for (int m = 0; m < meteors->high; m++) {
+        if (meteors->life[m] <= 0) continue;
+        glColor4f(1.0f, 1.0f, 1.0f, meteors->life[m] * 1.2f); // Slightly brighter than max
+        glVertex2f(meteors->x[m], meteors->y[m]);
+    }
     glEnd();
 
     // GLOWING AURA - Extra brightness halo
     glPointSize(8.0f); // Wide glow halo
     glBegin(GL_POINTS);
-    glColor4f(1.0f, 1.0f, 1.0f, meteor->life * 0.6f); // Dimmer halo for glow effect
-    glVertex2f(meteor->x, meteor->y);
+    for (int m = 0; m < meteors->high; m++) {
+        if (meteors->life[m] <= 0) continue;
+        glColor4f(1.0f, 1.0f, 1.0f, meteors->life[m] * 0.6f); // Dimmer halo for glow effect
+        glVertex2f(meteors->x[m], meteors->y[m]);
+    }
     glEnd();
+    glPointSize(1.0f);
 }
 
 /**
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+
+# Compare the tiled CPU rasterizer (-R cpu) with SDL's own software
+# renderer on the primitive-heavy savers, as on a machine without a GPU:
+#
+#   make bench                     # or: python3 utils/bench_raster.py [seconds]
+#
+# Every case runs windowed under SDL_RENDER_DRIVER=software, once per
+# backend, and is stopped with SIGINT (which SDL turns into SDL_QUIT) so
+# the saver prints its exit summary. The average frame rates and the
+# rasterizer's own timings go to stdout and bench_output.txt.
+
+import os
+import re
+import signal
+import subprocess
+import sys
+import time
+
+CASES = [
+    ('bouncingball', ['-n', '1000']),
+    ('bouncingball', ['-n', '10000']),
+    ('bouncingball', ['-n', '50000']),
+    ('lifeforms', ['-p', '0']),
+]
+
+FPS = re.compile(r'avg ([0-9.]+) fps')
+RASTER = re.compile(r'cpu raster, .*')
+
+
+def run(saver, args, seconds):
+    env = dict(os.environ, SDL_RENDER_DRIVER='software')
+    proc = subprocess.Popen([os.path.join('build', saver), '-f', '0'] + args, env=env,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    time.sleep(seconds)
+    proc.send_signal(signal.SIGINT)
+    try:
+        out, _ = proc.communicate(timeout=10)
+    except subprocess.TimeoutExpired:
+        proc.kill()
+        out, _ = proc.communicate()
+    fps = FPS.search(out)
+    raster = RASTER.search(out)
+    return (float(fps.group(1)) if fps else None), (raster.group(0) if raster else '')
+
+
+def main():
+    seconds = float(sys.argv[1]) if len(sys.argv) > 1 else 10.0
+    lines = []
+    for saver, args in CASES:
+        name = ' '.join([saver] + args)
+        sdl_fps, _ = run(saver, args + ['-R', 'sdl'], seconds)
+        cpu_fps, raster = run(saver, args + ['-R', 'cpu'], seconds)
+        fmt = lambda fps: f'{fps:6.1f} fps' if fps is not None else '   n/a    '
+        lines.append(f'{name:28} sdl {fmt(sdl_fps)}   cpu {fmt(cpu_fps)}   {raster}')
+        print(lines[-1], flush=True)
+
+    with open('bench_output.txt', 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -3,26 +3,8 @@
 import sys
 import os
 
-if len(sys.argv) != 4:
-    print("Usage: python3 png_to_c.py <png_file> <output_h_file> <asset_name>")
-    sys.exit(1)
-
-png_file = sys.argv[1]
-h_file = sys.argv[2]
-asset_name = sys.argv[3]
-
-with open(png_file, 'rb') as f:
-    data = f.read()
-
-upper_name = asset_name.upper()
-var_name = asset_name.lower()
-len_name = f"{asset_name.lower()}_len"
-
-with open(h_file, 'w') as f:
-    f.write(f'#ifndef {upper_name}_H\n')
-    f.write(f'#define {upper_name}_H\n\n')
-    f.write(f'unsigned char {var_name}[] = {{\n')
 
+def write_bytes(f, data):
     for i in range(len(data)):
         if i % 16 == 0:
             f.write('    ')
@@ -36,4 +18,136 @@ with open(h_file, 'w') as f:
     if len(data) % 16 != 0:
         f.write('\n')
 
-    f.write(f'}};\nunsigned int {len_name} = sizeof({var_name});\n\n#endif\n')
+
+def embed(png_file, h_file, asset_name):
+    with open(png_file, 'rb') as f:
+        data = f.read()
+
+    upper_name = asset_name.upper()
+    var_name = asset_name.lower()
+    len_name = f"{asset_name.lower()}_len"
+
+    with open(h_file, 'w') as f:
+        f.write(f'#ifndef {upper_name}_H\n')
+        f.write(f'#define {upper_name}_H\n\n')
+        f.write(f'unsigned char {var_name}[] = {{\n')
+        write_bytes(f, data)
+        f.write(f'}};\nunsigned int {len_name} = sizeof({var_name});\n\n#endif\n')
+
+
+# Atlas packing
+#
+# Every sprite is given as name=image[:frame_width[:frame_count]]. Sheets are
+# cut into frames of frame_width (default: the whole image), keeping only the
+# first frame_count frames if given. All frames are shelf-packed into one
+# PNG with ATLAS_PADDING transparent pixels around each, so filtering never
+# bleeds between neighbours. The header holds the PNG bytes plus a frame
+# table in atlas pixels and a per-sprite {first frame, frame count} table.
+
+ATLAS_PADDING = 2
+ATLAS_MAX_WIDTH = 2048
+
+
+def pack_atlas(h_file, asset_name, specs):
+    from PIL import Image
+    import io
+
+    sprites = []
+    frames = []
+    for spec in specs:
+        name, _, rest = spec.partition('=')
+        parts = rest.split(':')
+        image = Image.open(parts[0]).convert('RGBA')
+        frame_w = int(parts[1]) if len(parts) > 1 else image.width
+        count = image.width // frame_w
+        if len(parts) > 2:
+            count = min(count, int(parts[2]))
+        sprites.append((name, len(frames), count))
+        for k in range(count):
+            frames.append(image.crop((k * frame_w, 0, (k + 1) * frame_w, image.height)))
+
+    # Shelf packing, tallest frames first, at whichever power-of-two width
+    # gives the smallest (then the squarest) atlas
+    order = sorted(range(len(frames)), key=lambda i: (-frames[i].height, -frames[i].width))
+    widest = max(fr.width for fr in frames) + 2 * ATLAS_PADDING
+
+    def shelf_pack(width):
+        rects = [None] * len(frames)
+        x = y = shelf_h = 0
+        for i in order:
+            fw = frames[i].width + 2 * ATLAS_PADDING
+            fh = frames[i].height + 2 * ATLAS_PADDING
+            if x + fw > width:
+                x = 0
+                y += shelf_h
+                shelf_h = 0
+            rects[i] = (x + ATLAS_PADDING, y + ATLAS_PADDING, frames[i].width, frames[i].height)
+            x += fw
+            shelf_h = max(shelf_h, fh)
+        height = 1
+        while height < y + shelf_h:
+            height *= 2
+        return rects, height
+
+    best = None
+    width = 64
+    while width <= ATLAS_MAX_WIDTH:
+        if width >= widest:
+            rects, height = shelf_pack(width)
+            key = (width * height, max(width, height))
+            if height <= ATLAS_MAX_WIDTH and (best is None or key < best[0]):
+                best = (key, width, rects, height)
+        width *= 2
+    if best is None:
+        sys.exit(f'{h_file}: frames do not fit in {ATLAS_MAX_WIDTH}x{ATLAS_MAX_WIDTH}')
+    _, width, rects, height = best
+
+    atlas = Image.new('RGBA', (width, height), (0, 0, 0, 0))
+    for fr, (fx, fy, _, _) in zip(frames, rects):
+        atlas.paste(fr, (fx, fy))
+    out = io.BytesIO()
+    atlas.save(out, 'PNG', optimize=True)
+    data = out.getvalue()
+
+    upper_name = asset_name.upper()
+    var_name = asset_name.lower()
+
+    with open(h_file, 'w') as f:
+        f.write(f'#ifndef {upper_name}_H\n')
+        f.write(f'#define {upper_name}_H\n\n')
+        f.write(f'// Generated by utils/png_to_c.py --atlas from:\n')
+        for spec in specs:
+            f.write(f'//   {spec}\n')
+        f.write('\n#ifndef ATLAS_TYPES_DEFINED\n#define ATLAS_TYPES_DEFINED\n')
+        f.write('typedef struct { int x, y, w, h; } AtlasFrame;      // Atlas pixels\n')
+        f.write('typedef struct { int first, count; } AtlasSprite;   // Range in the frame table\n')
+        f.write('#endif\n\n')
+        f.write(f'#define {upper_name}_WIDTH {width}\n')
+        f.write(f'#define {upper_name}_HEIGHT {height}\n\n')
+        f.write('enum {\n')
+        for name, _, _ in sprites:
+            f.write(f'    {upper_name}_{name.upper()},\n')
+        f.write(f'    {upper_name}_SPRITE_COUNT\n}};\n\n')
+        f.write(f'static const AtlasSprite {var_name}_sprites[] = {{\n')
+        for name, first, count in sprites:
+            f.write(f'    {{{first}, {count}}}, // {name}\n')
+        f.write('};\n\n')
+        f.write(f'static const AtlasFrame {var_name}_frames[] = {{\n')
+        for fx, fy, fw, fh in rects:
+            f.write(f'    {{{fx}, {fy}, {fw}, {fh}}},\n')
+        f.write('};\n\n')
+        f.write(f'static const unsigned char {var_name}[] = {{\n')
+        write_bytes(f, data)
+        f.write(f'}};\nstatic const unsigned int {var_name}_len = sizeof({var_name});\n\n#endif\n')
+
+    print(f'{h_file}: {len(frames)} frames from {len(sprites)} sprites in {width}x{height}, {len(data)} bytes')
+
+
+if len(sys.argv) >= 5 and sys.argv[1] == '--atlas':
+    pack_atlas(sys.argv[2], sys.argv[3], sys.argv[4:])
+elif len(sys.argv) == 4:
+    embed(sys.argv[1], sys.argv[2], sys.argv[3])
+else:
+    print("Usage: python3 png_to_c.py <png_file> <output_h_file> <asset_name>")
+    print("       python3 png_to_c.py --atlas <output_h_file> <asset_name> name=image[:frame_w[:frames]] ...")
+    sys.exit(1)
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+# Local stand-in for the quotable.io API, for trying the message savers'
+# quote fetcher without network access:
+#
+#   python3 utils/quote_stub.py 8000 [quotes.txt] [--delay SECONDS]
+#   ./build/messages -u http://127.0.0.1:8000/random
+#
+# Every GET answers {"content": ..., "author": ...} with a random line of
+# quotes.txt (or a few built-in quotes). --delay holds each reply back to
+# mimic a slow connection.
+
+import json
+import random
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+QUOTES = [
+    "The best way out is always through.",
+    "Simplicity is prerequisite for reliability.",
+    "Well done is better than well said.",
+    "Nothing will work unless you do.",
+    "Stay hungry, stay foolish.",
+]
+
+
+def make_handler(quotes, delay):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            if delay > 0:
+                time.sleep(delay)
+            body = json.dumps({'content': random.choice(quotes), 'author': 'quote_stub'},
+                              ensure_ascii=False).encode('utf-8')
+            self.send_response(200)
+            self.send_header('Content-Type', 'application/json; charset=utf-8')
+            self.send_header('Content-Length', str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, fmt, *args):
+            sys.stderr.write('quote_stub: ' + fmt % args + '\n')
+
+    return Handler
+
+
+def main():
+    args = sys.argv[1:]
+    delay = 0.0
+    if '--delay' in args:
+        i = args.index('--delay')
+        delay = float(args[i + 1])
+        del args[i:i + 2]
+    if not args:
+        print(f'Usage: {sys.argv[0]} <port> [quotes.txt] [--delay SECONDS]')
+        sys.exit(1)
+
+    quotes = QUOTES
+    if len(args) > 1:
+        with open(args[1], encoding='utf-8') as f:
+            quotes = [line.strip() for line in f if line.strip()]
+
+    server = ThreadingHTTPServer(('127.0.0.1', int(args[0])), make_handler(quotes, delay))
+    print(f'Serving {len(quotes)} quotes on http://127.0.0.1:{args[0]}/random')
+    server.serve_forever()
+
+
+if __name__ == '__main__':
+    main()